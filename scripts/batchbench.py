@@ -0,0 +1,39 @@
+import os
+import time
+import assimp_py
+from pathlib import Path
+
+
+models = sorted(str(p.absolute()) for p in Path(__file__).parent.parent.joinpath("tests/models").rglob("*.obj"))
+post_flags = (
+    assimp_py.Process_Triangulate | assimp_py.Process_GenNormals | assimp_py.Process_CalcTangentSpace
+)
+files = models * 16
+
+
+def sequential():
+    for f in files:
+        assimp_py.import_file(f, post_flags)
+
+
+def batch(num_threads):
+    for _, scene in assimp_py.import_files(files, post_flags, num_threads):
+        if isinstance(scene, Exception):
+            raise scene
+
+
+def files_per_sec(func, *args):
+    start = time.perf_counter()
+    func(*args)
+    return len(files) / (time.perf_counter() - start)
+
+
+sequential()  # warm up file cache
+baseline = files_per_sec(sequential)
+print(f"{'mode':>16} {'files/sec':>10} {'speedup':>8}")
+print(f"{'import_file loop':>16} {baseline:>10.1f} {1.0:>7.2f}x")
+threads = 1
+while threads <= (os.cpu_count() or 1):
+    rate = files_per_sec(batch, threads)
+    print(f"{f'import_files x{threads}':>16} {rate:>10.1f} {rate / baseline:>7.2f}x")
+    threads *= 2
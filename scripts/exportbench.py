@@ -0,0 +1,27 @@
+import time
+import assimp_py
+from pathlib import Path
+
+
+models = sorted(str(p.absolute()) for p in Path(__file__).parent.parent.joinpath("tests/models").rglob("*.obj"))
+post_flags = (
+    assimp_py.Process_Triangulate | assimp_py.Process_GenNormals | assimp_py.Process_CalcTangentSpace
+)
+scenes = [assimp_py.import_file(f, post_flags, retain_scene=True) for f in models] * 16
+formats = ["glb2", "plyb", "stlb", "objnomtl"]
+
+
+def export_all(format_id):
+    size = 0
+    for scene in scenes:
+        size += len(assimp_py.export(scene, None, format_id))
+    return size
+
+
+print(f"{'format':>10} {'scenes/sec':>11} {'MB/sec':>8}")
+for format_id in formats:
+    export_all(format_id)  # warm up
+    start = time.perf_counter()
+    size = export_all(format_id)
+    elapsed = time.perf_counter() - start
+    print(f"{format_id:>10} {len(scenes) / elapsed:>11.1f} {size / elapsed / 1e6:>8.1f}")
@@ -0,0 +1,79 @@
+import json
+import resource
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+import numpy as np
+import assimp_py
+
+
+def write_glb(path, num_vertices):
+    """Grid mesh with positions, normals and UVs in one BIN chunk."""
+    side = int(num_vertices ** 0.5)
+    u, v = np.meshgrid(np.linspace(0, 1, side, dtype=np.float32), np.linspace(0, 1, side, dtype=np.float32))
+    positions = np.stack([u.ravel(), v.ravel(), np.zeros(side * side, np.float32)], 1)
+    normals = np.tile(np.array([0, 0, 1], np.float32), (side * side, 1))
+    uvs = np.stack([u.ravel(), v.ravel()], 1)
+    quads = (np.arange(side - 1)[:, None] * side + np.arange(side - 1)[None, :]).ravel().astype(np.uint32)
+    indices = np.stack([quads, quads + 1, quads + side, quads + 1, quads + side + 1, quads + side], 1).ravel()
+
+    arrays = [positions, normals, uvs, indices]
+    views, offset = [], 0
+    for array in arrays:
+        views.append({"buffer": 0, "byteOffset": offset, "byteLength": array.nbytes})
+        offset += array.nbytes
+    gltf = {
+        "asset": {"version": "2.0"},
+        "scenes": [{"nodes": [0]}],
+        "nodes": [{"mesh": 0}],
+        "meshes": [{"primitives": [{"attributes": {"POSITION": 0, "NORMAL": 1, "TEXCOORD_0": 2}, "indices": 3}]}],
+        "buffers": [{"byteLength": offset}],
+        "bufferViews": views,
+        "accessors": [
+            {"bufferView": 0, "componentType": 5126, "count": len(positions), "type": "VEC3",
+             "min": [0, 0, 0], "max": [1, 1, 0]},
+            {"bufferView": 1, "componentType": 5126, "count": len(normals), "type": "VEC3"},
+            {"bufferView": 2, "componentType": 5126, "count": len(uvs), "type": "VEC2"},
+            {"bufferView": 3, "componentType": 5125, "count": len(indices), "type": "SCALAR"},
+        ],
+    }
+    text = json.dumps(gltf).encode()
+    text += b" " * (-len(text) % 4)
+    body = b"".join(array.tobytes() for array in arrays)
+    with open(path, "wb") as f:
+        f.write(struct.pack("<4sII", b"glTF", 2, 12 + 8 + len(text) + 8 + len(body)))
+        f.write(struct.pack("<I4s", len(text), b"JSON") + text)
+        f.write(struct.pack("<I4s", len(body), b"BIN\0") + body)
+
+
+def child(path, mode):
+    start = time.perf_counter()
+    if mode == "file":
+        scene = assimp_py.import_file(path, 0)
+    else:
+        scene = assimp_py.import_bytes(Path(path).read_bytes(), 0, "glb")
+    elapsed = time.perf_counter() - start
+    peak_mb = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss / 1024
+    print(f"{elapsed:.3f} {peak_mb:.0f} {scene.meshes[0].num_vertices}")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) == 4 and sys.argv[1] == "--child":
+        child(sys.argv[2], sys.argv[3])
+        sys.exit()
+
+    # Every run is a fresh process, so the peak RSS is that of one import
+    print(f"{'vertices':>10} {'file MB':>8} {'mode':>6} {'seconds':>8} {'peak RSS MB':>12}")
+    with tempfile.TemporaryDirectory() as tmp:
+        for num_vertices in (1 << 20, 1 << 22, 1 << 24):
+            path = str(Path(tmp) / "grid.glb")
+            write_glb(path, num_vertices)
+            size_mb = Path(path).stat().st_size / 1e6
+            for mode in ("file", "bytes"):
+                out = subprocess.run([sys.executable, __file__, "--child", path, mode],
+                                     capture_output=True, text=True, check=True).stdout.split()
+                print(f"{num_vertices:>10} {size_mb:>8.0f} {mode:>6} {float(out[0]):>8.3f} {float(out[1]):>12.0f}")
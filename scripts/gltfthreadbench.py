@@ -0,0 +1,79 @@
+import json
+import os
+import struct
+import tempfile
+import time
+from pathlib import Path
+
+import numpy as np
+import assimp_py
+
+
+def write_glb(path, num_primitives, side):
+    """One mesh of `num_primitives` grid primitives of side * side vertices,
+    each with its own position, normal, UV and index accessors."""
+    u, v = np.meshgrid(np.linspace(0, 1, side, dtype=np.float32), np.linspace(0, 1, side, dtype=np.float32))
+    positions = np.stack([u.ravel(), v.ravel(), np.zeros(side * side, np.float32)], 1)
+    normals = np.tile(np.array([0, 0, 1], np.float32), (side * side, 1))
+    uvs = np.stack([u.ravel(), v.ravel()], 1)
+    quads = (np.arange(side - 1)[:, None] * side + np.arange(side - 1)[None, :]).ravel().astype(np.uint32)
+    indices = np.stack([quads, quads + 1, quads + side, quads + 1, quads + side + 1, quads + side], 1).ravel()
+
+    views, accessors, primitives, chunks, offset = [], [], [], [], 0
+    for p in range(num_primitives):
+        # Offset every primitive so none of them share data
+        arrays = [positions + np.float32(p), normals, uvs, indices]
+        for array in arrays:
+            views.append({"buffer": 0, "byteOffset": offset, "byteLength": array.nbytes})
+            chunks.append(array.tobytes())
+            offset += array.nbytes
+        first = len(accessors)
+        accessors += [
+            {"bufferView": first, "componentType": 5126, "count": len(positions), "type": "VEC3",
+             "min": [p, p, p], "max": [p + 1, p + 1, p]},
+            {"bufferView": first + 1, "componentType": 5126, "count": len(normals), "type": "VEC3"},
+            {"bufferView": first + 2, "componentType": 5126, "count": len(uvs), "type": "VEC2"},
+            {"bufferView": first + 3, "componentType": 5125, "count": len(indices), "type": "SCALAR"},
+        ]
+        primitives.append({"attributes": {"POSITION": first, "NORMAL": first + 1, "TEXCOORD_0": first + 2},
+                           "indices": first + 3})
+    gltf = {
+        "asset": {"version": "2.0"},
+        "scenes": [{"nodes": [0]}],
+        "nodes": [{"mesh": 0}],
+        "meshes": [{"primitives": primitives}],
+        "buffers": [{"byteLength": offset}],
+        "bufferViews": views,
+        "accessors": accessors,
+    }
+    text = json.dumps(gltf).encode()
+    text += b" " * (-len(text) % 4)
+    body = b"".join(chunks)
+    with open(path, "wb") as f:
+        f.write(struct.pack("<4sII", b"glTF", 2, 12 + 8 + len(text) + 8 + len(body)))
+        f.write(struct.pack("<I4s", len(text), b"JSON") + text)
+        f.write(struct.pack("<I4s", len(body), b"BIN\0") + body)
+
+
+def best_time(path, threads, repeat=3):
+    best = float("inf")
+    for _ in range(repeat):
+        start = time.perf_counter()
+        scene = assimp_py.import_file(path, 0, threads=threads)
+        best = min(best, time.perf_counter() - start)
+    return best, scene
+
+
+if __name__ == "__main__":
+    print(f"{os.cpu_count()} hardware threads")
+    print(f"{'primitives':>10} {'vertices':>9} {'threads':>7} {'seconds':>8} {'speedup':>8}")
+    with tempfile.TemporaryDirectory() as tmp:
+        for num_primitives, side in ((4096, 32), (1024, 128), (64, 512)):
+            path = str(Path(tmp) / "primitives.glb")
+            write_glb(path, num_primitives, side)
+            serial = None
+            for threads in (1, 2, 4, 8, 16):
+                seconds, scene = best_time(path, threads)
+                assert len(scene.meshes) == num_primitives
+                serial = serial or seconds
+                print(f"{num_primitives:>10} {side * side:>9} {threads:>7} {seconds:>8.3f} {serial / seconds:>7.2f}x")
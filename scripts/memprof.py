@@ -7,13 +7,15 @@ model_a = Path(__file__).parent.parent.joinpath("tests/models/cyborg/cyborg.obj"
 model_b = Path(__file__).parent.parent.joinpath("tests/models/planet/planet.obj")
 
 @profile
-def func(model):
+def func(model, zero_copy=False):
     post_flags = (
         assimp_py.Process_GenNormals | assimp_py.Process_CalcTangentSpace
     )
-    scn = assimp_py.import_file(str(model.absolute()), post_flags)
+    scn = assimp_py.import_file(str(model.absolute()), post_flags, zero_copy=zero_copy)
     del scn
 
 for _ in range(10):
     func(model_a)
-    func(model_b)
\ No newline at end of file
+    func(model_b)
+    func(model_a, zero_copy=True)
+    func(model_b, zero_copy=True)
\ No newline at end of file
@@ -0,0 +1,56 @@
+import os
+import tempfile
+from pathlib import Path
+
+import numpy as np
+import assimp_py
+
+FLAGS = (assimp_py.Process_Triangulate | assimp_py.Process_GenSmoothNormals |
+         assimp_py.Process_JoinIdenticalVertices | assimp_py.Process_CalcTangentSpace |
+         assimp_py.Process_ImproveCacheLocality)
+STEPS = ("Triangulate", "GenSmoothNormals", "JoinIdenticalVertices", "CalcTangentSpace", "ImproveCacheLocality",
+         "MeshPass")
+
+
+def write_obj(path, num_meshes, side):
+    """`num_meshes` objects, each a bumpy grid of side * side vertices in quads, with UVs and no normals."""
+    u, v = np.meshgrid(np.linspace(0, 1, side), np.linspace(0, 1, side))
+    quads = (np.arange(side - 1)[:, None] * side + np.arange(side - 1)[None, :]).ravel() + 1
+    faces = np.stack([quads, quads + 1, quads + side + 1, quads + side], 1)
+    with open(path, "w") as f:
+        for m in range(num_meshes):
+            first = m * side * side
+            height = 0.1 * np.sin(u * (m % 7 + 1) * np.pi) * np.cos(v * np.pi)
+            f.write(f"o grid{m}\n")
+            np.savetxt(f, np.stack([u.ravel() + m, v.ravel(), height.ravel()], 1), "v %.5f %.5f %.5f")
+            np.savetxt(f, np.stack([u.ravel(), v.ravel()], 1), "vt %.5f %.5f")
+            f.writelines("f " + " ".join(f"{i}/{i}" for i in face) + "\n" for face in (faces + first).tolist())
+
+
+def best_stats(path, threads, fuse_steps, repeat=3):
+    """Post-processing seconds per step of the fastest of `repeat` imports."""
+    best = None
+    for _ in range(repeat):
+        scene = assimp_py.import_file(path, FLAGS, threads=threads, fuse_steps=fuse_steps, stats=True)
+        steps = scene.import_stats["postprocess"]
+        if best is None or sum(steps.values()) < sum(best.values()):
+            best = steps
+    return best
+
+
+if __name__ == "__main__":
+    print(f"{os.cpu_count()} hardware threads, post-processing seconds")
+    print(f"{'meshes':>6} {'threads':>7} {'fused':>5} " + " ".join(f"{step[:12]:>12}" for step in STEPS) + f" {'total':>7} {'speedup':>8}")
+    with tempfile.TemporaryDirectory() as tmp:
+        for num_meshes, side in ((2000, 16), (200, 64)):
+            path = str(Path(tmp) / "grids.obj")
+            write_obj(path, num_meshes, side)
+            serial = None
+            for fuse_steps in (False, True):
+                for threads in (1, 2, 4, 8, 16):
+                    steps = best_stats(path, threads, fuse_steps)
+                    total = sum(steps.values())
+                    serial = serial or total
+                    print(f"{num_meshes:>6} {threads:>7} {'yes' if fuse_steps else 'no':>5} " +
+                          " ".join(f"{steps.get(step, 0):>12.3f}" for step in STEPS) +
+                          f" {total:>7.3f} {serial / total:>7.2f}x")
@@ -0,0 +1,29 @@
+import os
+import time
+import assimp_py
+from pathlib import Path
+from concurrent.futures import ThreadPoolExecutor
+
+
+models = sorted(str(p.absolute()) for p in Path(__file__).parent.parent.joinpath("tests/models").rglob("*.obj"))
+post_flags = (
+    assimp_py.Process_Triangulate | assimp_py.Process_GenNormals | assimp_py.Process_CalcTangentSpace
+)
+files = models * 8
+
+
+def run(num_threads):
+    start = time.perf_counter()
+    with ThreadPoolExecutor(max_workers=num_threads) as pool:
+        list(pool.map(lambda f: assimp_py.import_file(f, post_flags), files))
+    return time.perf_counter() - start
+
+
+run(1)  # warm up file cache
+baseline = run(1)
+print(f"{'threads':>8} {'seconds':>8} {'speedup':>8}")
+threads = 1
+while threads <= (os.cpu_count() or 1):
+    elapsed = baseline if threads == 1 else run(threads)
+    print(f"{threads:>8} {elapsed:>8.3f} {baseline / elapsed:>7.2f}x")
+    threads *= 2
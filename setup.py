@@ -61,6 +61,13 @@ class CMakeBuild(build_ext):
             '-DASSIMP_BUILD_TESTS=OFF',
             '-DASSIMP_WARNINGS_AS_ERRORS=OFF',
             '-DASSIMP_BUILD_ALL_EXPORTERS_BY_DEFAULT=FALSE',
+            # Exporters behind assimp_py.export()
+            '-DASSIMP_BUILD_GLTF_EXPORTER=TRUE',
+            '-DASSIMP_BUILD_OBJ_EXPORTER=TRUE',
+            '-DASSIMP_BUILD_PLY_EXPORTER=TRUE',
+            '-DASSIMP_BUILD_STL_EXPORTER=TRUE',
+            # Entries of assimp_py.ImportCache
+            '-DASSIMP_BUILD_ASSBIN_EXPORTER=TRUE',
 
             # XXX Uncomment the following lines to get lighter OBJ only build for development
             # '-DASSIMP_BUILD_ALL_IMPORTERS_BY_DEFAULT=FALSE',
@@ -92,6 +99,8 @@ setup(
     exclude_package_data={
         'assimp_py': [
             '*.c',
+            '*.cpp',
+            '*.h',
         ]
     }
 )
@@ -138,11 +138,22 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 	// then becomes very large, too. Assimp doesn't support
 	// streaming for its output data structures so the net win with
 	// streaming input data would be very low.
+	// binary files are tokenized in place when the stream holds the file
+	// in memory (e.g. a memory-mapped file), ASCII files need a copy with
+	// a terminating zero. The binary tokenizer is then bounded by the file
+	// size rather than the size of the copy: the terminating zero is not
+	// part of the file, and binary files end with their null record and
+	// footer, so it was never needed there.
 	std::vector<char> contents;
-	contents.resize(stream->FileSize() + 1);
-	stream->Read(&*contents.begin(), 1, contents.size() - 1);
-	contents[contents.size() - 1] = 0;
-	const char *const begin = &*contents.begin();
+	const char *begin = reinterpret_cast<const char *>(stream->GetDirectPointer());
+	size_t length = stream->FileSize();
+	if (!begin || length < 18 || strncmp(begin, "Kaydara FBX Binary", 18)) {
+		contents.resize(length + 1);
+		stream->Read(&*contents.begin(), 1, length);
+		contents[length] = 0;
+		begin = &*contents.begin();
+		length = contents.size();
+	}
 
 	// broad-phase tokenized pass in which we identify the core
 	// syntax elements of FBX (brackets, commas, key:value mappings)
@@ -152,7 +163,7 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 		bool is_binary = false;
 		if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
 			is_binary = true;
-            TokenizeBinary(tokens, begin, contents.size(), tempAllocator);
+            TokenizeBinary(tokens, begin, length, tempAllocator);
 		} else {
             Tokenize(tokens, begin, tempAllocator);
 		}
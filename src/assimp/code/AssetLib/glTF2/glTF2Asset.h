@@ -497,7 +497,9 @@ public:
 
     void Read(Value &obj, Asset &r);
 
-    bool LoadFromStream(IOStream &stream, size_t length = 0, size_t baseOffset = 0);
+    /// Loads `length` bytes (the whole stream if 0) at `baseOffset`. Streams holding the file in memory
+    /// (IOStream::GetDirectPointer) are referenced in place and kept open as long as the buffer.
+    bool LoadFromStream(shared_ptr<IOStream> stream, size_t length = 0, size_t baseOffset = 0);
 
     /// \fn void EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t* pDecodedData, const size_t pDecodedData_Length, const std::string& pID)
     /// Mark region of "bufferView" as encoded. When data is request from such region then "bufferView" use decoded data.
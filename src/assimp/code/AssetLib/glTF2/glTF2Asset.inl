@@ -611,10 +611,9 @@ inline void Buffer::Read(Value &obj, Asset &r) {
         if (byteLength > 0) {
             std::string dir = !r.mCurrentAssetDir.empty() ? (r.mCurrentAssetDir.back() == '/' ? r.mCurrentAssetDir : r.mCurrentAssetDir + '/') : "";
 
-            IOStream *file = r.OpenFile(dir + uri, "rb");
+            shared_ptr<IOStream> file(r.OpenFile(dir + uri, "rb"));
             if (file) {
-                bool ok = LoadFromStream(*file, byteLength);
-                delete file;
+                bool ok = LoadFromStream(file, byteLength);
 
                 if (!ok)
                     throw DeadlyImportError("GLTF: error while reading referenced file \"", uri, "\"");
@@ -625,20 +624,31 @@ inline void Buffer::Read(Value &obj, Asset &r) {
     }
 }
 
-inline bool Buffer::LoadFromStream(IOStream &stream, size_t length, size_t baseOffset) {
-    byteLength = length ? length : stream.FileSize();
+inline bool Buffer::LoadFromStream(shared_ptr<IOStream> stream, size_t length, size_t baseOffset) {
+    byteLength = length ? length : stream->FileSize();
 
-    if (byteLength > stream.FileSize()) {
+    if (byteLength > stream->FileSize()) {
         throw DeadlyImportError("GLTF: Invalid byteLength exceeds size of actual data.");
     }
 
+    // Reference memory-mapped or caller-provided files in place: the buffer
+    // shares ownership of the stream, which keeps the memory valid. Buffers
+    // read from files are never written to.
+    if (const uint8_t *data = stream->GetDirectPointer()) {
+        if (baseOffset > stream->FileSize() || byteLength > stream->FileSize() - baseOffset) {
+            return false;
+        }
+        mData = shared_ptr<uint8_t>(stream, const_cast<uint8_t *>(data + baseOffset));
+        return true;
+    }
+
     if (baseOffset) {
-        stream.Seek(baseOffset, aiOrigin_SET);
+        stream->Seek(baseOffset, aiOrigin_SET);
     }
 
     mData.reset(new uint8_t[byteLength], std::default_delete<uint8_t[]>());
 
-    if (stream.Read(mData.get(), byteLength, 1) != 1) {
+    if (stream->Read(mData.get(), byteLength, 1) != 1) {
         return false;
     }
     return true;
@@ -1035,6 +1045,8 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
 
     outData = new T[usedCount];
 
+    // Whole elements are copied with a constant size, which compilers turn
+    // into plain loads and stores
     if (remappingIndices != nullptr) {
         const unsigned int maxIndexCount = static_cast<unsigned int>(maxSize / stride);
         for (size_t i = 0; i < usedCount; ++i) {
@@ -1042,7 +1054,11 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
             if (srcIdx >= maxIndexCount) {
                 throw DeadlyImportError("GLTF: index*stride ", (srcIdx * stride), " > maxSize ", maxSize, " in ", getContextForErrorMessages(id, name));
             }
-            memcpy(outData + i, data + srcIdx * stride, elemSize);
+            if (targetElemSize == elemSize) {
+                memcpy(outData + i, data + srcIdx * stride, sizeof(T));
+            } else {
+                memcpy(outData + i, data + srcIdx * stride, elemSize);
+            }
         }
     } else { // non-indexed cases
         if (usedCount * stride > maxSize) {
@@ -1050,6 +1066,10 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
         }
         if (stride == elemSize && targetElemSize == elemSize) {
             memcpy(outData, data, totalSize);
+        } else if (targetElemSize == elemSize) {
+            for (size_t i = 0; i < usedCount; ++i) {
+                memcpy(outData + i, data + i * stride, sizeof(T));
+            }
         } else {
             for (size_t i = 0; i < usedCount; ++i) {
                 memcpy(outData + i, data + i * stride, elemSize);
@@ -2021,7 +2041,7 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
 
     // Fill the buffer instance for the current file embedded contents
     if (mBodyLength > 0) {
-        if (!mBodyBuffer->LoadFromStream(*stream, mBodyLength, mBodyOffset)) {
+        if (!mBodyBuffer->LoadFromStream(stream, mBodyLength, mBodyOffset)) {
             throw DeadlyImportError("GLTF: Unable to read gltf file");
         }
     }
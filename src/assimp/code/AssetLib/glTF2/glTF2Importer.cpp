@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "AssetLib/glTF2/glTF2Importer.h"
 #include "AssetLib/glTF2/glTF2Asset.h"
+#include "Common/ParallelFor.h"
 #include "PostProcessing/MakeVerboseFormat.h"
 
 #if !defined(ASSIMP_BUILD_NO_EXPORT)
@@ -460,6 +461,20 @@ aiColor4D *GetVertexColorsForType(Ref<Accessor> input, std::vector<unsigned int>
     return output;
 }
 
+// True if the remapping table keeps every one of `count` vertices in order,
+// so the accessors can be extracted without it, in bulk
+static bool IsIdentityRemapping(const std::vector<unsigned int> &table, size_t count) {
+    if (table.size() != count) {
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (table[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
     ASSIMP_LOG_DEBUG("Importing ", r.meshes.Size(), " meshes");
     std::vector<std::unique_ptr<aiMesh>> meshes;
@@ -476,411 +491,433 @@ void glTF2Importer::ImportMeshes(glTF2::Asset &r) {
     }
     meshOffsets.push_back(num_aiMeshes); // add a last element so we can always do meshOffsets[n+1] - meshOffsets[n]
 
-    std::vector<unsigned int> reverseMappingIndices;
-    std::vector<unsigned int> indexBuffer;
-    meshes.reserve(num_aiMeshes);
+    meshes.resize(num_aiMeshes);
     mVertexRemappingTables.resize(num_aiMeshes);
 
+    // Each primitive becomes its own aiMesh, built on up to mNumThreads threads
+    // into its slot of `meshes`, so their order does not depend on the threads
+    std::vector<std::pair<unsigned int, unsigned int>> primitives; // Mesh and primitive index of each aiMesh
+    primitives.reserve(num_aiMeshes);
     for (unsigned int m = 0; m < r.meshes.Size(); ++m) {
-        Mesh &mesh = r.meshes[m];
+        for (unsigned int p = 0; p < r.meshes[m].primitives.size(); ++p) {
+            primitives.emplace_back(m, p);
+        }
+    }
 
-        for (unsigned int p = 0; p < mesh.primitives.size(); ++p) {
-            Mesh::Primitive &prim = mesh.primitives[p];
+    // Workers collect their warnings per slot; they are logged in mesh order
+    // on this thread once every primitive is built
+    std::vector<std::vector<std::string>> warnings(num_aiMeshes);
 
-            Mesh::Primitive::Attributes &attr = prim.attributes;
+    ParallelFor(num_aiMeshes, mNumThreads, [&](size_t slot) {
+        std::vector<std::string> &slotWarnings = warnings[slot];
+        const unsigned int p = primitives[slot].second;
+        Mesh &mesh = r.meshes[primitives[slot].first];
+        Mesh::Primitive &prim = mesh.primitives[p];
+        std::vector<unsigned int> reverseMappingIndices;
+        std::vector<unsigned int> indexBuffer;
 
-            // Find out the maximum number of vertices:
-            size_t numAllVertices = 0;
-            if (!attr.position.empty() && attr.position[0]) {
-                numAllVertices = attr.position[0]->count;
+        Mesh::Primitive::Attributes &attr = prim.attributes;
+
+        // Find out the maximum number of vertices:
+        size_t numAllVertices = 0;
+        if (!attr.position.empty() && attr.position[0]) {
+            numAllVertices = attr.position[0]->count;
+        }
+
+        // Extract used vertices:
+        bool useIndexBuffer = prim.indices;
+        std::vector<unsigned int> *vertexRemappingTable = nullptr;
+        
+        if (useIndexBuffer) {
+            size_t count = prim.indices->count;
+            indexBuffer.resize(count);
+            reverseMappingIndices.clear();
+            vertexRemappingTable = &mVertexRemappingTables[slot];
+            vertexRemappingTable->reserve(count / 3); // this is a very rough heuristic to reduce re-allocations
+            Accessor::Indexer data = prim.indices->GetIndexer();
+            if (!data.IsValid()) {
+                throw DeadlyImportError("GLTF: Invalid accessor without data in mesh ", getContextForErrorMessages(mesh.id, mesh.name));
             }
 
-            // Extract used vertices:
-            bool useIndexBuffer = prim.indices;
-            std::vector<unsigned int> *vertexRemappingTable = nullptr;
-            
-            if (useIndexBuffer) {
-                size_t count = prim.indices->count;
-                indexBuffer.resize(count);
-                reverseMappingIndices.clear();
-                vertexRemappingTable = &mVertexRemappingTables[meshes.size()];
-                vertexRemappingTable->reserve(count / 3); // this is a very rough heuristic to reduce re-allocations
-                Accessor::Indexer data = prim.indices->GetIndexer();
-                if (!data.IsValid()) {
-                    throw DeadlyImportError("GLTF: Invalid accessor without data in mesh ", getContextForErrorMessages(mesh.id, mesh.name));
+            // Build the vertex remapping table and the modified index buffer (used later instead of the original one)
+            // In case no index buffer is used, the original vertex arrays are being used so no remapping is required in the first place.
+            const unsigned int unusedIndex = ~0u;
+            for (unsigned int i = 0; i < count; ++i) {
+                unsigned int index = data.GetUInt(i);
+                if (index >= numAllVertices) {
+                    // Out-of-range indices will be filtered out when adding the faces and then lead to a warning. At this stage, we just keep them.
+                    indexBuffer[i] = index;
+                    continue; 
                 }
-
-                // Build the vertex remapping table and the modified index buffer (used later instead of the original one)
-                // In case no index buffer is used, the original vertex arrays are being used so no remapping is required in the first place.
-                const unsigned int unusedIndex = ~0u;
-                for (unsigned int i = 0; i < count; ++i) {
-                    unsigned int index = data.GetUInt(i);
-                    if (index >= numAllVertices) {
-                        // Out-of-range indices will be filtered out when adding the faces and then lead to a warning. At this stage, we just keep them.
-                        indexBuffer[i] = index;
-                        continue; 
-                    }
-                    if (index >= reverseMappingIndices.size()) {
-                        reverseMappingIndices.resize(index + 1, unusedIndex);
-                    }
-                    if (reverseMappingIndices[index] == unusedIndex) {
-                        reverseMappingIndices[index] = static_cast<unsigned int>(vertexRemappingTable->size());
-                        vertexRemappingTable->push_back(index);
-                    }
-                    indexBuffer[i] = reverseMappingIndices[index];
+                if (index >= reverseMappingIndices.size()) {
+                    reverseMappingIndices.resize(index + 1, unusedIndex);
                 }
+                if (reverseMappingIndices[index] == unusedIndex) {
+                    reverseMappingIndices[index] = static_cast<unsigned int>(vertexRemappingTable->size());
+                    vertexRemappingTable->push_back(index);
+                }
+                indexBuffer[i] = reverseMappingIndices[index];
             }
+            if (IsIdentityRemapping(*vertexRemappingTable, numAllVertices)) {
+                vertexRemappingTable = nullptr;
+            }
+        }
 
-            aiMesh *aim = new aiMesh();
-            meshes.push_back(std::unique_ptr<aiMesh>(aim));
-
-            aim->mName = mesh.name.empty() ? mesh.id : mesh.name;
+        aiMesh *aim = new aiMesh();
+        meshes[slot].reset(aim);
 
-            if (mesh.primitives.size() > 1) {
-                ai_uint32 &len = aim->mName.length;
-                aim->mName.data[len] = '-';
-                len += 1 + ASSIMP_itoa10(aim->mName.data + len + 1, unsigned(AI_MAXLEN - len - 1), p);
-            }
+        aim->mName = mesh.name.empty() ? mesh.id : mesh.name;
 
-            switch (prim.mode) {
-            case PrimitiveMode_POINTS:
-                aim->mPrimitiveTypes |= aiPrimitiveType_POINT;
-                break;
+        if (mesh.primitives.size() > 1) {
+            ai_uint32 &len = aim->mName.length;
+            aim->mName.data[len] = '-';
+            len += 1 + ASSIMP_itoa10(aim->mName.data + len + 1, unsigned(AI_MAXLEN - len - 1), p);
+        }
 
-            case PrimitiveMode_LINES:
-            case PrimitiveMode_LINE_LOOP:
-            case PrimitiveMode_LINE_STRIP:
-                aim->mPrimitiveTypes |= aiPrimitiveType_LINE;
-                break;
+        switch (prim.mode) {
+        case PrimitiveMode_POINTS:
+            aim->mPrimitiveTypes |= aiPrimitiveType_POINT;
+            break;
 
-            case PrimitiveMode_TRIANGLES:
-            case PrimitiveMode_TRIANGLE_STRIP:
-            case PrimitiveMode_TRIANGLE_FAN:
-                aim->mPrimitiveTypes |= aiPrimitiveType_TRIANGLE;
-                break;
-            }
+        case PrimitiveMode_LINES:
+        case PrimitiveMode_LINE_LOOP:
+        case PrimitiveMode_LINE_STRIP:
+            aim->mPrimitiveTypes |= aiPrimitiveType_LINE;
+            break;
 
-            if (!attr.position.empty() && attr.position[0]) {
-                aim->mNumVertices = static_cast<unsigned int>(attr.position[0]->ExtractData(aim->mVertices, vertexRemappingTable));
-            }
+        case PrimitiveMode_TRIANGLES:
+        case PrimitiveMode_TRIANGLE_STRIP:
+        case PrimitiveMode_TRIANGLE_FAN:
+            aim->mPrimitiveTypes |= aiPrimitiveType_TRIANGLE;
+            break;
+        }
 
-            if (!attr.normal.empty() && attr.normal[0]) {
-                    if (attr.normal[0]->count != numAllVertices) {
-                    DefaultLogger::get()->warn("Normal count in mesh \"", mesh.name, "\" does not match the vertex count, normals ignored.");
-                } else {
-                    attr.normal[0]->ExtractData(aim->mNormals, vertexRemappingTable);
+        if (!attr.position.empty() && attr.position[0]) {
+            aim->mNumVertices = static_cast<unsigned int>(attr.position[0]->ExtractData(aim->mVertices, vertexRemappingTable));
+        }
 
-                    // only extract tangents if normals are present
-                    if (!attr.tangent.empty() && attr.tangent[0]) {
-                        if (attr.tangent[0]->count != numAllVertices) {
-                            DefaultLogger::get()->warn("Tangent count in mesh \"", mesh.name, "\" does not match the vertex count, tangents ignored.");
-                        } else {
-                            // generate bitangents from normals and tangents according to spec
-                            Tangent *tangents = nullptr;
+        if (!attr.normal.empty() && attr.normal[0]) {
+                if (attr.normal[0]->count != numAllVertices) {
+                slotWarnings.push_back(Formatter::format() << "Normal count in mesh \"" << mesh.name << "\" does not match the vertex count, normals ignored.");
+            } else {
+                attr.normal[0]->ExtractData(aim->mNormals, vertexRemappingTable);
 
-                            attr.tangent[0]->ExtractData(tangents, vertexRemappingTable);
+                // only extract tangents if normals are present
+                if (!attr.tangent.empty() && attr.tangent[0]) {
+                    if (attr.tangent[0]->count != numAllVertices) {
+                        slotWarnings.push_back(Formatter::format() << "Tangent count in mesh \"" << mesh.name << "\" does not match the vertex count, tangents ignored.");
+                    } else {
+                        // generate bitangents from normals and tangents according to spec
+                        Tangent *tangents = nullptr;
 
-                            aim->mTangents = new aiVector3D[aim->mNumVertices];
-                            aim->mBitangents = new aiVector3D[aim->mNumVertices];
+                        attr.tangent[0]->ExtractData(tangents, vertexRemappingTable);
 
-                            for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
-                                aim->mTangents[i] = tangents[i].xyz;
-                                aim->mBitangents[i] = (aim->mNormals[i] ^ tangents[i].xyz) * tangents[i].w;
-                            }
+                        aim->mTangents = new aiVector3D[aim->mNumVertices];
+                        aim->mBitangents = new aiVector3D[aim->mNumVertices];
 
-                            delete[] tangents;
+                        for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+                            aim->mTangents[i] = tangents[i].xyz;
+                            aim->mBitangents[i] = (aim->mNormals[i] ^ tangents[i].xyz) * tangents[i].w;
                         }
+
+                        delete[] tangents;
                     }
                 }
             }
+        }
 
-            for (size_t c = 0; c < attr.color.size() && c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
-                if (attr.color[c]->count != numAllVertices) {
-                    DefaultLogger::get()->warn("Color stream size in mesh \"", mesh.name,
-                            "\" does not match the vertex count");
-                    continue;
-                }
+        for (size_t c = 0; c < attr.color.size() && c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+            if (attr.color[c]->count != numAllVertices) {
+                slotWarnings.push_back(Formatter::format() << "Color stream size in mesh \"" << mesh.name
+                        << "\" does not match the vertex count");
+                continue;
+            }
 
-                auto componentType = attr.color[c]->componentType;
-                if (componentType == glTF2::ComponentType_FLOAT) {
-                    attr.color[c]->ExtractData(aim->mColors[c], vertexRemappingTable);
-                } else {
-                    if (componentType == glTF2::ComponentType_UNSIGNED_BYTE) {
-                        aim->mColors[c] = GetVertexColorsForType<unsigned char>(attr.color[c], vertexRemappingTable);
-                    } else if (componentType == glTF2::ComponentType_UNSIGNED_SHORT) {
-                        aim->mColors[c] = GetVertexColorsForType<unsigned short>(attr.color[c], vertexRemappingTable);
-                    }
+            auto componentType = attr.color[c]->componentType;
+            if (componentType == glTF2::ComponentType_FLOAT) {
+                attr.color[c]->ExtractData(aim->mColors[c], vertexRemappingTable);
+            } else {
+                if (componentType == glTF2::ComponentType_UNSIGNED_BYTE) {
+                    aim->mColors[c] = GetVertexColorsForType<unsigned char>(attr.color[c], vertexRemappingTable);
+                } else if (componentType == glTF2::ComponentType_UNSIGNED_SHORT) {
+                    aim->mColors[c] = GetVertexColorsForType<unsigned short>(attr.color[c], vertexRemappingTable);
                 }
             }
-            for (size_t tc = 0; tc < attr.texcoord.size() && tc < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++tc) {
-                if (!attr.texcoord[tc]) {
-                    DefaultLogger::get()->warn("Texture coordinate accessor not found or non-contiguous texture coordinate sets.");
-                    continue;
-                }
+        }
+        for (size_t tc = 0; tc < attr.texcoord.size() && tc < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++tc) {
+            if (!attr.texcoord[tc]) {
+                slotWarnings.emplace_back("Texture coordinate accessor not found or non-contiguous texture coordinate sets.");
+                continue;
+            }
 
-                if (attr.texcoord[tc]->count != numAllVertices) {
-                    DefaultLogger::get()->warn("Texcoord stream size in mesh \"", mesh.name,
-                            "\" does not match the vertex count");
-                    continue;
-                }
+            if (attr.texcoord[tc]->count != numAllVertices) {
+                slotWarnings.push_back(Formatter::format() << "Texcoord stream size in mesh \"" << mesh.name
+                        << "\" does not match the vertex count");
+                continue;
+            }
 
-                attr.texcoord[tc]->ExtractData(aim->mTextureCoords[tc], vertexRemappingTable);
-                aim->mNumUVComponents[tc] = attr.texcoord[tc]->GetNumComponents();
+            attr.texcoord[tc]->ExtractData(aim->mTextureCoords[tc], vertexRemappingTable);
+            aim->mNumUVComponents[tc] = attr.texcoord[tc]->GetNumComponents();
 
-                aiVector3D *values = aim->mTextureCoords[tc];
-                for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
-                    values[i].y = 1 - values[i].y; // Flip Y coords
-                }
+            aiVector3D *values = aim->mTextureCoords[tc];
+            for (unsigned int i = 0; i < aim->mNumVertices; ++i) {
+                values[i].y = 1 - values[i].y; // Flip Y coords
             }
+        }
 
-            std::vector<Mesh::Primitive::Target> &targets = prim.targets;
-            if (!targets.empty()) {
-                aim->mNumAnimMeshes = (unsigned int)targets.size();
-                aim->mAnimMeshes = new aiAnimMesh *[aim->mNumAnimMeshes];
-                std::fill(aim->mAnimMeshes, aim->mAnimMeshes + aim->mNumAnimMeshes, nullptr);
-                for (size_t i = 0; i < targets.size(); i++) {
-                    bool needPositions = targets[i].position.size() > 0;
-                    bool needNormals = (targets[i].normal.size() > 0) && aim->HasNormals();
-                    bool needTangents = (targets[i].tangent.size() > 0) && aim->HasTangentsAndBitangents();
-                    // GLTF morph does not support colors and texCoords
-                    aim->mAnimMeshes[i] = aiCreateAnimMesh(aim,
-                            needPositions, needNormals, needTangents, false, false);
-                    aiAnimMesh &aiAnimMesh = *(aim->mAnimMeshes[i]);
-                    Mesh::Primitive::Target &target = targets[i];
-
-                    if (needPositions) {
-                        if (target.position[0]->count != numAllVertices) {
-                            ASSIMP_LOG_WARN("Positions of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
-                        } else {
-                            aiVector3D *positionDiff = nullptr;
-                            target.position[0]->ExtractData(positionDiff, vertexRemappingTable);
-                            for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
-                                aiAnimMesh.mVertices[vertexId] += positionDiff[vertexId];
-                            }
-                            delete[] positionDiff;
+        std::vector<Mesh::Primitive::Target> &targets = prim.targets;
+        if (!targets.empty()) {
+            aim->mNumAnimMeshes = (unsigned int)targets.size();
+            aim->mAnimMeshes = new aiAnimMesh *[aim->mNumAnimMeshes];
+            std::fill(aim->mAnimMeshes, aim->mAnimMeshes + aim->mNumAnimMeshes, nullptr);
+            for (size_t i = 0; i < targets.size(); i++) {
+                bool needPositions = targets[i].position.size() > 0;
+                bool needNormals = (targets[i].normal.size() > 0) && aim->HasNormals();
+                bool needTangents = (targets[i].tangent.size() > 0) && aim->HasTangentsAndBitangents();
+                // GLTF morph does not support colors and texCoords
+                aim->mAnimMeshes[i] = aiCreateAnimMesh(aim,
+                        needPositions, needNormals, needTangents, false, false);
+                aiAnimMesh &aiAnimMesh = *(aim->mAnimMeshes[i]);
+                Mesh::Primitive::Target &target = targets[i];
+
+                if (needPositions) {
+                    if (target.position[0]->count != numAllVertices) {
+                        slotWarnings.push_back(Formatter::format() << "Positions of target " << i << " in mesh \"" << mesh.name << "\" does not match the vertex count");
+                    } else {
+                        aiVector3D *positionDiff = nullptr;
+                        target.position[0]->ExtractData(positionDiff, vertexRemappingTable);
+                        for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
+                            aiAnimMesh.mVertices[vertexId] += positionDiff[vertexId];
                         }
+                        delete[] positionDiff;
                     }
-                    if (needNormals) {
-                        if (target.normal[0]->count != numAllVertices) {
-                            ASSIMP_LOG_WARN("Normals of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
-                        } else {
-                            aiVector3D *normalDiff = nullptr;
-                            target.normal[0]->ExtractData(normalDiff, vertexRemappingTable);
-                            for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
-                                aiAnimMesh.mNormals[vertexId] += normalDiff[vertexId];
-                            }
-                            delete[] normalDiff;
+                }
+                if (needNormals) {
+                    if (target.normal[0]->count != numAllVertices) {
+                        slotWarnings.push_back(Formatter::format() << "Normals of target " << i << " in mesh \"" << mesh.name << "\" does not match the vertex count");
+                    } else {
+                        aiVector3D *normalDiff = nullptr;
+                        target.normal[0]->ExtractData(normalDiff, vertexRemappingTable);
+                        for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; vertexId++) {
+                            aiAnimMesh.mNormals[vertexId] += normalDiff[vertexId];
                         }
+                        delete[] normalDiff;
                     }
-                    if (needTangents) {
-                        if (!aiAnimMesh.HasNormals()) {
-                            // prevent nullptr access to aiAnimMesh.mNormals below when no normals are available
-                            ASSIMP_LOG_WARN("Bitangents of target ", i, " in mesh \"", mesh.name, "\" can't be computed, because mesh has no normals.");
-                        } else if (target.tangent[0]->count != numAllVertices) {
-                            ASSIMP_LOG_WARN("Tangents of target ", i, " in mesh \"", mesh.name, "\" does not match the vertex count");
-                        } else {
-                            Tangent *tangent = nullptr;
-                            attr.tangent[0]->ExtractData(tangent, vertexRemappingTable);
-
-                            aiVector3D *tangentDiff = nullptr;
-                            target.tangent[0]->ExtractData(tangentDiff, vertexRemappingTable);
-
-                            for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; ++vertexId) {
-                                tangent[vertexId].xyz += tangentDiff[vertexId];
-                                aiAnimMesh.mTangents[vertexId] = tangent[vertexId].xyz;
-                                aiAnimMesh.mBitangents[vertexId] = (aiAnimMesh.mNormals[vertexId] ^ tangent[vertexId].xyz) * tangent[vertexId].w;
-                            }
-                            delete[] tangent;
-                            delete[] tangentDiff;
+                }
+                if (needTangents) {
+                    if (!aiAnimMesh.HasNormals()) {
+                        // prevent nullptr access to aiAnimMesh.mNormals below when no normals are available
+                        slotWarnings.push_back(Formatter::format() << "Bitangents of target " << i << " in mesh \"" << mesh.name << "\" can't be computed, because mesh has no normals.");
+                    } else if (target.tangent[0]->count != numAllVertices) {
+                        slotWarnings.push_back(Formatter::format() << "Tangents of target " << i << " in mesh \"" << mesh.name << "\" does not match the vertex count");
+                    } else {
+                        Tangent *tangent = nullptr;
+                        attr.tangent[0]->ExtractData(tangent, vertexRemappingTable);
+
+                        aiVector3D *tangentDiff = nullptr;
+                        target.tangent[0]->ExtractData(tangentDiff, vertexRemappingTable);
+
+                        for (unsigned int vertexId = 0; vertexId < aim->mNumVertices; ++vertexId) {
+                            tangent[vertexId].xyz += tangentDiff[vertexId];
+                            aiAnimMesh.mTangents[vertexId] = tangent[vertexId].xyz;
+                            aiAnimMesh.mBitangents[vertexId] = (aiAnimMesh.mNormals[vertexId] ^ tangent[vertexId].xyz) * tangent[vertexId].w;
                         }
+                        delete[] tangent;
+                        delete[] tangentDiff;
                     }
-                    if (mesh.weights.size() > i) {
-                        aiAnimMesh.mWeight = mesh.weights[i];
-                    }
-                    if (mesh.targetNames.size() > i) {
-                        aiAnimMesh.mName = mesh.targetNames[i];
-                    }
+                }
+                if (mesh.weights.size() > i) {
+                    aiAnimMesh.mWeight = mesh.weights[i];
+                }
+                if (mesh.targetNames.size() > i) {
+                    aiAnimMesh.mName = mesh.targetNames[i];
                 }
             }
+        }
 
-            aiFace *faces = nullptr;
-            aiFace *facePtr = nullptr;
-            size_t nFaces = 0;
+        aiFace *faces = nullptr;
+        aiFace *facePtr = nullptr;
+        size_t nFaces = 0;
 
-            if (useIndexBuffer) {
-                size_t count = indexBuffer.size();
+        if (useIndexBuffer) {
+            size_t count = indexBuffer.size();
 
-                switch (prim.mode) {
-                case PrimitiveMode_POINTS: {
-                    nFaces = count;
-                    facePtr = faces = new aiFace[nFaces];
-                    for (unsigned int i = 0; i < count; ++i) {
-                        SetFaceAndAdvance1(facePtr, aim->mNumVertices, indexBuffer[i]);
-                    }
-                    break;
+            switch (prim.mode) {
+            case PrimitiveMode_POINTS: {
+                nFaces = count;
+                facePtr = faces = new aiFace[nFaces];
+                for (unsigned int i = 0; i < count; ++i) {
+                    SetFaceAndAdvance1(facePtr, aim->mNumVertices, indexBuffer[i]);
                 }
+                break;
+            }
 
-                case PrimitiveMode_LINES: {
-                    nFaces = count / 2;
-                    if (nFaces * 2 != count) {
-                        ASSIMP_LOG_WARN("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
-                        count = nFaces * 2;
-                    }
-                    facePtr = faces = new aiFace[nFaces];
-                    for (unsigned int i = 0; i < count; i += 2) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1]);
-                    }
-                    break;
+            case PrimitiveMode_LINES: {
+                nFaces = count / 2;
+                if (nFaces * 2 != count) {
+                    slotWarnings.emplace_back("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
+                    count = nFaces * 2;
                 }
+                facePtr = faces = new aiFace[nFaces];
+                for (unsigned int i = 0; i < count; i += 2) {
+                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1]);
+                }
+                break;
+            }
 
-                case PrimitiveMode_LINE_LOOP:
-                case PrimitiveMode_LINE_STRIP: {
-                    nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
-                    facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[1]);
-                    for (unsigned int i = 2; i < count; ++i) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[i - 1], indexBuffer[i]);
-                    }
-                    if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[static_cast<int>(count) - 1], faces[0].mIndices[0]);
-                    }
-                    break;
+            case PrimitiveMode_LINE_LOOP:
+            case PrimitiveMode_LINE_STRIP: {
+                nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
+                facePtr = faces = new aiFace[nFaces];
+                SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[1]);
+                for (unsigned int i = 2; i < count; ++i) {
+                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[i - 1], indexBuffer[i]);
                 }
+                if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
+                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, indexBuffer[static_cast<int>(count) - 1], faces[0].mIndices[0]);
+                }
+                break;
+            }
 
-                case PrimitiveMode_TRIANGLES: {
-                    nFaces = count / 3;
-                    if (nFaces * 3 != count) {
-                        ASSIMP_LOG_WARN("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
-                        count = nFaces * 3;
-                    }
-                    facePtr = faces = new aiFace[nFaces];
-                    for (unsigned int i = 0; i < count; i += 3) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
-                    }
-                    break;
+            case PrimitiveMode_TRIANGLES: {
+                nFaces = count / 3;
+                if (nFaces * 3 != count) {
+                    slotWarnings.emplace_back("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
+                    count = nFaces * 3;
                 }
-                case PrimitiveMode_TRIANGLE_STRIP: {
-                    nFaces = count - 2;
-                    facePtr = faces = new aiFace[nFaces];
-                    for (unsigned int i = 0; i < nFaces; ++i) {
-                        // The ordering is to ensure that the triangles are all drawn with the same orientation
-                        if ((i + 1) % 2 == 0) {
-                            // For even n, vertices n + 1, n, and n + 2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i + 1], indexBuffer[i], indexBuffer[i + 2]);
-                        } else {
-                            // For odd n, vertices n, n+1, and n+2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
-                        }
-                    }
-                    break;
+                facePtr = faces = new aiFace[nFaces];
+                for (unsigned int i = 0; i < count; i += 3) {
+                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
                 }
-                case PrimitiveMode_TRIANGLE_FAN:
-                    nFaces = count - 2;
-                    facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[1], indexBuffer[2]);
-                    for (unsigned int i = 1; i < nFaces; ++i) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[i + 1], indexBuffer[i + 2]);
+                break;
+            }
+            case PrimitiveMode_TRIANGLE_STRIP: {
+                nFaces = count - 2;
+                facePtr = faces = new aiFace[nFaces];
+                for (unsigned int i = 0; i < nFaces; ++i) {
+                    // The ordering is to ensure that the triangles are all drawn with the same orientation
+                    if ((i + 1) % 2 == 0) {
+                        // For even n, vertices n + 1, n, and n + 2 define triangle n
+                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i + 1], indexBuffer[i], indexBuffer[i + 2]);
+                    } else {
+                        // For odd n, vertices n, n+1, and n+2 define triangle n
+                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[i], indexBuffer[i + 1], indexBuffer[i + 2]);
                     }
-                    break;
                 }
-            } else { // no indices provided so directly generate from counts
+                break;
+            }
+            case PrimitiveMode_TRIANGLE_FAN:
+                nFaces = count - 2;
+                facePtr = faces = new aiFace[nFaces];
+                SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[1], indexBuffer[2]);
+                for (unsigned int i = 1; i < nFaces; ++i) {
+                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, indexBuffer[0], indexBuffer[i + 1], indexBuffer[i + 2]);
+                }
+                break;
+            }
+        } else { // no indices provided so directly generate from counts
 
-                // use the already determined count as it includes checks
-                unsigned int count = aim->mNumVertices;
+            // use the already determined count as it includes checks
+            unsigned int count = aim->mNumVertices;
 
-                switch (prim.mode) {
-                case PrimitiveMode_POINTS: {
-                    nFaces = count;
-                    facePtr = faces = new aiFace[nFaces];
-                    for (unsigned int i = 0; i < count; ++i) {
-                        SetFaceAndAdvance1(facePtr, aim->mNumVertices, i);
-                    }
-                    break;
+            switch (prim.mode) {
+            case PrimitiveMode_POINTS: {
+                nFaces = count;
+                facePtr = faces = new aiFace[nFaces];
+                for (unsigned int i = 0; i < count; ++i) {
+                    SetFaceAndAdvance1(facePtr, aim->mNumVertices, i);
                 }
+                break;
+            }
 
-                case PrimitiveMode_LINES: {
-                    nFaces = count / 2;
-                    if (nFaces * 2 != count) {
-                        ASSIMP_LOG_WARN("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
-                        count = (unsigned int)nFaces * 2;
-                    }
-                    facePtr = faces = new aiFace[nFaces];
-                    for (unsigned int i = 0; i < count; i += 2) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, i, i + 1);
-                    }
-                    break;
+            case PrimitiveMode_LINES: {
+                nFaces = count / 2;
+                if (nFaces * 2 != count) {
+                    slotWarnings.emplace_back("The number of vertices was not compatible with the LINES mode. Some vertices were dropped.");
+                    count = (unsigned int)nFaces * 2;
+                }
+                facePtr = faces = new aiFace[nFaces];
+                for (unsigned int i = 0; i < count; i += 2) {
+                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, i, i + 1);
                 }
+                break;
+            }
 
-                case PrimitiveMode_LINE_LOOP:
-                case PrimitiveMode_LINE_STRIP: {
-                    nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
-                    facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, 0, 1);
-                    for (unsigned int i = 2; i < count; ++i) {
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, i - 1, i);
-                    }
-                    if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
-                        SetFaceAndAdvance2(facePtr, aim->mNumVertices, count - 1, 0);
-                    }
-                    break;
+            case PrimitiveMode_LINE_LOOP:
+            case PrimitiveMode_LINE_STRIP: {
+                nFaces = count - ((prim.mode == PrimitiveMode_LINE_STRIP) ? 1 : 0);
+                facePtr = faces = new aiFace[nFaces];
+                SetFaceAndAdvance2(facePtr, aim->mNumVertices, 0, 1);
+                for (unsigned int i = 2; i < count; ++i) {
+                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, i - 1, i);
                 }
+                if (prim.mode == PrimitiveMode_LINE_LOOP) { // close the loop
+                    SetFaceAndAdvance2(facePtr, aim->mNumVertices, count - 1, 0);
+                }
+                break;
+            }
 
-                case PrimitiveMode_TRIANGLES: {
-                    nFaces = count / 3;
-                    if (nFaces * 3 != count) {
-                        ASSIMP_LOG_WARN("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
-                        count = (unsigned int)nFaces * 3;
-                    }
-                    facePtr = faces = new aiFace[nFaces];
-                    for (unsigned int i = 0; i < count; i += 3) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
-                    }
-                    break;
+            case PrimitiveMode_TRIANGLES: {
+                nFaces = count / 3;
+                if (nFaces * 3 != count) {
+                    slotWarnings.emplace_back("The number of vertices was not compatible with the TRIANGLES mode. Some vertices were dropped.");
+                    count = (unsigned int)nFaces * 3;
                 }
-                case PrimitiveMode_TRIANGLE_STRIP: {
-                    nFaces = count - 2;
-                    facePtr = faces = new aiFace[nFaces];
-                    for (unsigned int i = 0; i < nFaces; ++i) {
-                        // The ordering is to ensure that the triangles are all drawn with the same orientation
-                        if ((i + 1) % 2 == 0) {
-                            // For even n, vertices n + 1, n, and n + 2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, i + 1, i, i + 2);
-                        } else {
-                            // For odd n, vertices n, n+1, and n+2 define triangle n
-                            SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
-                        }
-                    }
-                    break;
+                facePtr = faces = new aiFace[nFaces];
+                for (unsigned int i = 0; i < count; i += 3) {
+                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
                 }
-                case PrimitiveMode_TRIANGLE_FAN:
-                    nFaces = count - 2;
-                    facePtr = faces = new aiFace[nFaces];
-                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, 1, 2);
-                    for (unsigned int i = 1; i < nFaces; ++i) {
-                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, i + 1, i + 2);
+                break;
+            }
+            case PrimitiveMode_TRIANGLE_STRIP: {
+                nFaces = count - 2;
+                facePtr = faces = new aiFace[nFaces];
+                for (unsigned int i = 0; i < nFaces; ++i) {
+                    // The ordering is to ensure that the triangles are all drawn with the same orientation
+                    if ((i + 1) % 2 == 0) {
+                        // For even n, vertices n + 1, n, and n + 2 define triangle n
+                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, i + 1, i, i + 2);
+                    } else {
+                        // For odd n, vertices n, n+1, and n+2 define triangle n
+                        SetFaceAndAdvance3(facePtr, aim->mNumVertices, i, i + 1, i + 2);
                     }
-                    break;
                 }
+                break;
             }
-
-            if (faces) {
-                aim->mFaces = faces;
-                const unsigned int actualNumFaces = static_cast<unsigned int>(facePtr - faces);
-                if (actualNumFaces < nFaces) {
-                    ASSIMP_LOG_WARN("Some faces had out-of-range indices. Those faces were dropped.");
-                }
-                if (actualNumFaces == 0) {
-                    throw DeadlyImportError("Mesh \"", aim->mName.C_Str(), "\" has no faces");
+            case PrimitiveMode_TRIANGLE_FAN:
+                nFaces = count - 2;
+                facePtr = faces = new aiFace[nFaces];
+                SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, 1, 2);
+                for (unsigned int i = 1; i < nFaces; ++i) {
+                    SetFaceAndAdvance3(facePtr, aim->mNumVertices, 0, i + 1, i + 2);
                 }
-                aim->mNumFaces = actualNumFaces;
-                ai_assert(CheckValidFacesIndices(faces, actualNumFaces, aim->mNumVertices));
+                break;
             }
+        }
 
-            if (prim.material) {
-                aim->mMaterialIndex = prim.material.GetIndex();
-            } else {
-                aim->mMaterialIndex = mScene->mNumMaterials - 1;
+        if (faces) {
+            aim->mFaces = faces;
+            const unsigned int actualNumFaces = static_cast<unsigned int>(facePtr - faces);
+            if (actualNumFaces < nFaces) {
+                slotWarnings.emplace_back("Some faces had out-of-range indices. Those faces were dropped.");
+            }
+            if (actualNumFaces == 0) {
+                throw DeadlyImportError("Mesh \"", aim->mName.C_Str(), "\" has no faces");
             }
+            aim->mNumFaces = actualNumFaces;
+            ai_assert(CheckValidFacesIndices(faces, actualNumFaces, aim->mNumVertices));
+        }
+
+        if (prim.material) {
+            aim->mMaterialIndex = prim.material.GetIndex();
+        } else {
+            aim->mMaterialIndex = mScene->mNumMaterials - 1;
+        }
+    });
+
+    for (const std::vector<std::string> &slotWarnings : warnings) {
+        for (const std::string &warning : slotWarnings) {
+            ASSIMP_LOG_WARN(warning);
         }
     }
 
@@ -1027,6 +1064,9 @@ static void BuildVertexWeightMapping(Mesh::Primitive &primitive, std::vector<std
     }
 
     size_t num_vertices = 0;
+    if (vertexRemappingTablePtr && IsIdentityRemapping(*vertexRemappingTablePtr, attr.weight[0]->count)) {
+        vertexRemappingTablePtr = nullptr;
+    }
 
     struct Weights {
         float values[4];
@@ -1713,6 +1753,7 @@ void glTF2Importer::InternReadFile(const std::string &pFile, aiScene *pScene, IO
 
 void glTF2Importer::SetupProperties(const Importer *pImp) {
     mSchemaDocumentProvider = static_cast<rapidjson::IRemoteSchemaDocumentProvider *>(pImp->GetPropertyPointer(AI_CONFIG_IMPORT_SCHEMA_DOCUMENT_PROVIDER));
+    mNumThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, AI_CONFIG_IMPORT_NUM_THREADS_DEFAULT)));
 }
 
 #endif // ASSIMP_BUILD_NO_GLTF_IMPORTER
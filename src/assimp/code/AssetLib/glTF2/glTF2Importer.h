@@ -43,6 +43,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define AI_GLTF2IMPORTER_H_INC
 
 #include <assimp/BaseImporter.h>
+#include <assimp/config.h>
 #include <AssetLib/glTF2/glTF2Asset.h>
 
 struct aiNode;
@@ -87,6 +88,9 @@ private:
 
     /// An instance of rapidjson::IRemoteSchemaDocumentProvider
     void *mSchemaDocumentProvider = nullptr;
+
+    /// Threads to build the meshes on, AI_CONFIG_IMPORT_NUM_THREADS
+    unsigned int mNumThreads = AI_CONFIG_IMPORT_NUM_THREADS_DEFAULT;
 };
 
 } // namespace Assimp
@@ -100,8 +100,13 @@ static LogStreamMap gActiveLogStreams;
 /** Local storage of LogStreams allocated by #aiGetPredefinedLogStream */
 static PredefLogStreamMap gPredefinedStreams;
 
-/** Error message of the last failed import process */
+/** Error message of the last failed import process. Kept per thread so that
+ *  concurrent imports on different threads do not race on the message. */
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+static thread_local std::string gLastErrorString;
+#else
 static std::string gLastErrorString;
+#endif
 
 /** Verbose logging active or not? */
 static aiBool gVerboseLogging = false;
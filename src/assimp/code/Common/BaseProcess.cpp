@@ -43,55 +43,142 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include "Importer.h"
+#include "ParallelFor.h"
 #include <assimp/BaseImporter.h>
+#include <assimp/config.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 
+#include <algorithm>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 BaseProcess::BaseProcess() AI_NO_EXCEPT
         : shared(),
-          progress() {
+          progress(),
+          mNumThreads(1) {
     // empty
 }
 
 // ------------------------------------------------------------------------------------------------
-void BaseProcess::ExecuteOnScene(Importer *pImp) {
+bool BaseProcess::SetupForScene(Importer *pImp) {
     ai_assert( nullptr != pImp );
     if (pImp == nullptr) {
-        return;
+        return false;
     }
 
     ai_assert(nullptr != pImp->Pimpl()->mScene);
     if (pImp->Pimpl()->mScene == nullptr) {
-        return;
+        return false;
     }
 
     progress = pImp->GetProgressHandler();
     ai_assert(nullptr != progress);
     if (progress == nullptr) {
-        return;
+        return false;
     }
 
     SetupProperties(pImp);
+    mNumThreads = 1;
+    if (IsParallelSafe()) {
+        mNumThreads = static_cast<unsigned int>(std::max(0, pImp->GetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS,
+                AI_CONFIG_IMPORT_NUM_THREADS_DEFAULT)));
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+static void KillScene(Importer *pImp, const std::exception &err) {
+    // extract error description
+    pImp->Pimpl()->mErrorString = err.what();
+    ASSIMP_LOG_ERROR(pImp->Pimpl()->mErrorString);
+
+    // and kill the partially imported data
+    delete pImp->Pimpl()->mScene;
+    pImp->Pimpl()->mScene = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ExecuteOnScene(Importer *pImp) {
+    if (!SetupForScene(pImp)) {
+        return;
+    }
 
     // catch exceptions thrown inside the PostProcess-Step
     try {
         Execute(pImp->Pimpl()->mScene);
     } catch (const std::exception &err) {
+        KillScene(pImp, err);
+    }
+}
 
-        // extract error description
-        pImp->Pimpl()->mErrorString = err.what();
-        ASSIMP_LOG_ERROR(pImp->Pimpl()->mErrorString);
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ExecuteMeshPassOnScene(Importer *pImp, const std::vector<BaseProcess *> &steps) {
+    unsigned int numThreads = steps.empty() ? 1 : steps.front()->mNumThreads;
+    for (BaseProcess *step : steps) {
+        ai_assert(step->SupportsMeshPass());
+        if (!step->SetupForScene(pImp)) {
+            return;
+        }
+        // All steps use the same number of threads, unless one of them is
+        // not parallel safe
+        numThreads = step->mNumThreads;
+    }
+    for (BaseProcess *step : steps) {
+        if (!step->IsParallelSafe()) {
+            numThreads = 1;
+        }
+    }
 
-        // and kill the partially imported data
-        delete pImp->Pimpl()->mScene;
-        pImp->Pimpl()->mScene = nullptr;
+    aiScene *pScene = pImp->Pimpl()->mScene;
+    try {
+        for (BaseProcess *step : steps) {
+            step->BeginMeshPass(pScene);
+        }
+        ParallelFor(pScene->mNumMeshes, numThreads, [&](size_t a) {
+            for (BaseProcess *step : steps) {
+                step->ProcessMeshInPass(pScene, static_cast<unsigned int>(a));
+            }
+        });
+        for (BaseProcess *step : steps) {
+            step->EndMeshPass(pScene);
+        }
+    } catch (const std::exception &err) {
+        KillScene(pImp, err);
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ExecuteMeshPass(aiScene *pScene) {
+    BeginMeshPass(pScene);
+    ParallelFor(pScene->mNumMeshes, mNumThreads, [&](size_t a) {
+        ProcessMeshInPass(pScene, static_cast<unsigned int>(a));
+    });
+    EndMeshPass(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool BaseProcess::SupportsMeshPass() const {
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::BeginMeshPass(aiScene * /*pScene*/) {
+    // only mesh pass steps implement it
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ProcessMeshInPass(aiScene * /*pScene*/, unsigned int /*meshIndex*/) {
+    // only mesh pass steps implement it
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::EndMeshPass(aiScene * /*pScene*/) {
+    // only mesh pass steps implement it
+}
+
 // ------------------------------------------------------------------------------------------------
 void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
     // the default implementation does nothing
@@ -101,3 +188,8 @@ void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
 bool BaseProcess::RequireVerboseFormat() const {
     return true;
 }
+
+// ------------------------------------------------------------------------------------------------
+bool BaseProcess::IsParallelSafe() const {
+    return false;
+}
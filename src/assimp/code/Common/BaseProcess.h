@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/GenericProperty.h>
 
 #include <map>
+#include <vector>
 
 struct aiScene;
 
@@ -200,6 +201,32 @@ public:
      *  in verbose format. */
     virtual bool RequireVerboseFormat() const;
 
+    // -------------------------------------------------------------------
+    /** Check whether this step only ever touches one mesh at a time, so
+     *  that ExecuteOnScene() may let it process meshes concurrently (see
+     *  #mNumThreads). Steps returning true must keep their per-mesh work
+     *  free of shared mutable state and report progress only from
+     *  Execute() itself, on the calling thread. */
+    virtual bool IsParallelSafe() const;
+
+    // -------------------------------------------------------------------
+    /** Check whether this step can run as part of a mesh pass. Such steps
+     *  split their work into BeginMeshPass(), ProcessMeshInPass() for each
+     *  mesh and EndMeshPass(), and never add, remove or reorder meshes.
+     *  With #AI_CONFIG_PP_FUSE_MESH_STEPS consecutive steps of this kind
+     *  run back to back on one mesh after the other. */
+    virtual bool SupportsMeshPass() const;
+
+    // -------------------------------------------------------------------
+    /** Runs the given mesh pass steps (in pipeline order) as a single pass
+     *  over the meshes of the importer's scene: every BeginMeshPass(), then
+     *  all steps on the first mesh, all steps on the second mesh, ..., then
+     *  every EndMeshPass(). The result is the same as running the steps one
+     *  after the other with ExecuteOnScene(), and so are failures.
+     *  @param pImp Importer instance (pImp->mScene must be valid)
+     *  @param steps Active steps supporting mesh passes */
+    static void ExecuteMeshPassOnScene(Importer *pImp, const std::vector<BaseProcess *> &steps);
+
     // -------------------------------------------------------------------
     /**
      * @brief Executes the post processing step on the given imported data.
@@ -242,12 +269,41 @@ public:
         return shared;
     }
 
+protected:
+    // -------------------------------------------------------------------
+    /** Mesh pass steps: prepare a pass over the meshes of pScene, e.g. check
+     *  the scene and size the per-mesh results. Must not depend on changes
+     *  EndMeshPass() of earlier steps makes to the scene. */
+    virtual void BeginMeshPass(aiScene *pScene);
+
+    // -------------------------------------------------------------------
+    /** Mesh pass steps: process mesh meshIndex of pScene. May run on any
+     *  thread (if IsParallelSafe()), concurrently with other meshes. */
+    virtual void ProcessMeshInPass(aiScene *pScene, unsigned int meshIndex);
+
+    // -------------------------------------------------------------------
+    /** Mesh pass steps: finish a pass, e.g. log the per-mesh results */
+    virtual void EndMeshPass(aiScene *pScene);
+
+    // -------------------------------------------------------------------
+    /** Execute() of mesh pass steps: a pass of this step alone */
+    void ExecuteMeshPass(aiScene *pScene);
+
+private:
+    // Sets up the step for running on pImp's scene, false if it cannot
+    bool SetupForScene(Importer *pImp);
+
 protected:
     /** See the doc of #SharedPostProcessInfo for more details */
     SharedPostProcessInfo *shared;
 
     /** Currently active progress handler */
     ProgressHandler *progress;
+
+    /** Threads the step may process meshes on (with ParallelFor), set by
+     *  ExecuteOnScene() from #AI_CONFIG_IMPORT_NUM_THREADS. Always 1 for
+     *  steps which are not parallel safe. */
+    unsigned int mNumThreads;
 };
 
 } // end of namespace Assimp
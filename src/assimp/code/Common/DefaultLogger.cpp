@@ -62,6 +62,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <mutex>
 #include <thread>
 std::mutex loggerMutex;
+// Guards the streams and the repeated message filter, so that
+// post-processing steps may log from several threads
+std::mutex streamMutex;
 #endif
 
 namespace Assimp {
@@ -323,6 +326,10 @@ bool DefaultLogger::attachStream(LogStream *pStream, unsigned int severity) {
         severity = Logger::Info | Logger::Err | Logger::Warn | Logger::Debugging;
     }
 
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    std::lock_guard<std::mutex> lock(streamMutex);
+#endif
+
     for (StreamIt it = m_StreamArray.begin();
             it != m_StreamArray.end();
             ++it) {
@@ -348,6 +355,10 @@ bool DefaultLogger::detachStream(LogStream *pStream, unsigned int severity) {
         severity = SeverityAll;
     }
 
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    std::lock_guard<std::mutex> lock(streamMutex);
+#endif
+
     bool res(false);
     for (StreamIt it = m_StreamArray.begin(); it != m_StreamArray.end(); ++it) {
         if ((*it)->m_pStream == pStream) {
@@ -387,6 +398,10 @@ DefaultLogger::~DefaultLogger() {
 void DefaultLogger::WriteToStreams(const char *message, ErrorSeverity ErrorSev) {
     ai_assert(nullptr != message);
 
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    std::lock_guard<std::mutex> lock(streamMutex);
+#endif
+
     // Check whether this is a repeated message
     auto thisLen = ::strlen(message);
     if (thisLen == lastLen - 1 && !::strncmp(message, lastMsg, lastLen - 1)) {
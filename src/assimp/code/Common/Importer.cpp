@@ -830,6 +830,8 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
 #endif // ! DEBUG
 
     std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    const bool fuseMeshSteps = GetPropertyBool(AI_CONFIG_PP_FUSE_MESH_STEPS, AI_CONFIG_PP_FUSE_MESH_STEPS_DEFAULT);
+    pimpl->mFusedMeshPasses.clear();
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
         pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
@@ -838,7 +840,31 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
                 profiler->BeginRegion("postprocess");
             }
 
-            process->ExecuteOnScene ( this );
+            if (fuseMeshSteps && process->SupportsMeshPass()) {
+                // Run this step and the active mesh pass steps following it
+                // (up to the next active step which is not) in a single pass
+                std::vector<BaseProcess*> meshPass;
+                unsigned int b = a;
+                for ( ; b < pimpl->mPostProcessingSteps.size(); ++b) {
+                    BaseProcess* step = pimpl->mPostProcessingSteps[b];
+                    if (!step->IsActive(pFlags)) {
+                        continue;
+                    }
+                    if (!step->SupportsMeshPass()) {
+                        break;
+                    }
+                    meshPass.push_back(step);
+                }
+                if (meshPass.size() > 1) {
+                    pimpl->mFusedMeshPasses.push_back(a);
+                    BaseProcess::ExecuteMeshPassOnScene(this, meshPass);
+                    a = b - 1;
+                } else {
+                    process->ExecuteOnScene ( this );
+                }
+            } else {
+                process->ExecuteOnScene ( this );
+            }
 
             if (profiler) {
                 profiler->EndRegion("postprocess");
@@ -126,6 +126,10 @@ public:
     /** Used by post-process steps to share data */
     SharedPostProcessInfo* mPPShared;
 
+    /** Index of the first step of every fused mesh pass (see
+     *  #AI_CONFIG_PP_FUSE_MESH_STEPS) run by the last ApplyPostProcessing() */
+    std::vector< unsigned int > mFusedMeshPasses;
+
     /// The default class constructor.
     ImporterPimpl() AI_NO_EXCEPT;
 
@@ -149,7 +153,8 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mMatrixProperties(),
         mPointerProperties(),
         bExtraVerbose( false ),
-        mPPShared( nullptr ) {
+        mPPShared( nullptr ),
+        mFusedMeshPasses() {
     // empty
 }
 //! @endcond
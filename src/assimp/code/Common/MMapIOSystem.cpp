@@ -0,0 +1,210 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2024, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+/** @file Implementation of IOSystem reading files through memory mappings */
+
+#include <assimp/MMapIOSystem.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Read-only stream over a whole memory-mapped file
+class MMapIOStream : public IOStream {
+public:
+    MMapIOStream(uint8_t *data, size_t size) :
+            mData(data), mSize(size), mPos(0) {
+        // empty
+    }
+
+    ~MMapIOStream() override {
+#ifdef _WIN32
+        ::UnmapViewOfFile(mData);
+#else
+        ::munmap(mData, mSize);
+#endif
+    }
+
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override {
+        ai_assert(nullptr != pvBuffer);
+        ai_assert(0 != pSize);
+
+        const size_t cnt = std::min(pCount, (mSize - mPos) / pSize);
+        const size_t ofs = pSize * cnt;
+
+        ::memcpy(pvBuffer, mData + mPos, ofs);
+        mPos += ofs;
+
+        return cnt;
+    }
+
+    size_t Write(const void *, size_t, size_t) override {
+        return 0; // Opened for reading
+    }
+
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override {
+        if (aiOrigin_SET == pOrigin) {
+            if (pOffset > mSize) {
+                return AI_FAILURE;
+            }
+            mPos = pOffset;
+        } else if (aiOrigin_END == pOrigin) {
+            if (pOffset > mSize) {
+                return AI_FAILURE;
+            }
+            mPos = mSize - pOffset;
+        } else {
+            if (pOffset + mPos > mSize) {
+                return AI_FAILURE;
+            }
+            mPos += pOffset;
+        }
+        return AI_SUCCESS;
+    }
+
+    size_t Tell() const override {
+        return mPos;
+    }
+
+    size_t FileSize() const override {
+        return mSize;
+    }
+
+    void Flush() override {
+        // empty
+    }
+
+    const uint8_t *GetDirectPointer() const override {
+        return mData;
+    }
+
+private:
+    uint8_t *mData;
+    size_t mSize;
+    size_t mPos;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Map the whole file at `path`, returns nullptr to fall back to stdio
+IOStream *MapFile(const char *path) {
+#ifdef _WIN32
+    int size = MultiByteToWideChar(CP_UTF8, 0, path, -1, nullptr, 0);
+    if (size <= 1) {
+        return nullptr;
+    }
+    std::wstring name(static_cast<size_t>(size) - 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, path, -1, &name[0], size);
+
+    HANDLE file = ::CreateFileW(name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    LARGE_INTEGER fileSize;
+    HANDLE mapping = nullptr;
+    if (::GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0 &&
+            static_cast<unsigned long long>(fileSize.QuadPart) <= SIZE_MAX) {
+        mapping = ::CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    }
+    ::CloseHandle(file);
+    if (!mapping) {
+        return nullptr;
+    }
+    void *data = ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    ::CloseHandle(mapping); // The view keeps the mapping alive
+    if (!data) {
+        return nullptr;
+    }
+    return new MMapIOStream(static_cast<uint8_t *>(data), static_cast<size_t>(fileSize.QuadPart));
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+            static_cast<unsigned long long>(st.st_size) > SIZE_MAX) {
+        ::close(fd);
+        return nullptr;
+    }
+    void *data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps the file open
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    return new MMapIOStream(static_cast<uint8_t *>(data), static_cast<size_t>(st.st_size));
+#endif
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Open a new file with a given path.
+IOStream *MMapIOSystem::Open(const char *strFile, const char *strMode) {
+    ai_assert(strFile != nullptr);
+    ai_assert(strMode != nullptr);
+
+    bool readOnly = mMap && std::strchr(strMode, 'r') && !std::strpbrk(strMode, "wa+");
+#ifdef _WIN32
+    readOnly = readOnly && std::strchr(strMode, 'b'); // Text mode translates line endings
+#endif
+    if (readOnly) {
+        if (IOStream *stream = MapFile(strFile)) {
+            return stream;
+        }
+    }
+    return DefaultIOSystem::Open(strFile, strMode);
+}
@@ -0,0 +1,140 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2024, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ParallelFor.h
+ *  @brief Runs independent tasks, indexed 0 to count-1, on a pool of threads
+ */
+#pragma once
+#ifndef AI_PARALLELFOR_H_INC
+#define AI_PARALLELFOR_H_INC
+
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#endif
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** @brief Returns the number of threads ParallelFor runs `count` tasks on
+ *  when asked for `numThreads` (0 for one per hardware thread).
+ */
+inline unsigned int ParallelForThreads(size_t count, unsigned int numThreads) {
+#ifdef ASSIMP_BUILD_SINGLETHREADED
+    (void)count;
+    (void)numThreads;
+    return 1;
+#else
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return static_cast<unsigned int>(std::min<size_t>(numThreads, std::max<size_t>(count, 1)));
+#endif
+}
+
+// ---------------------------------------------------------------------------
+/** @brief Calls `task(i)` for every i in [0, count), on up to `numThreads`
+ *  threads (0 for one per hardware thread), and returns once all are done.
+ *
+ *  Tasks are handed out in index order, one at a time, so uneven tasks
+ *  balance out. They must only write to state of their own index. With one
+ *  thread the tasks run in order on the calling thread.
+ *
+ *  If tasks throw, the remaining ones are skipped and the exception of the
+ *  lowest failed index is rethrown, the one a serial loop would have thrown
+ *  unless an earlier task would have been skipped.
+ */
+template <class Task>
+void ParallelFor(size_t count, unsigned int numThreads, Task task) {
+    numThreads = ParallelForThreads(count, numThreads);
+    if (numThreads <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+#ifndef ASSIMP_BUILD_SINGLETHREADED
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::vector<std::exception_ptr> errors(count);
+    auto worker = [&]() {
+        for (size_t i = next++; i < count && !failed; i = next++) {
+            try {
+                task(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    try {
+        for (unsigned int t = 1; t < numThreads; ++t) {
+            threads.emplace_back(worker);
+        }
+    } catch (const std::system_error &) {
+        // Out of threads, run on those already started
+    }
+    worker(); // The calling thread works too
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    for (const std::exception_ptr &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+#endif
+}
+
+} // namespace Assimp
+
+#endif // AI_PARALLELFOR_H_INC
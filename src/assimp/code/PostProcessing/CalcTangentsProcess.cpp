@@ -66,6 +66,17 @@ bool CalcTangentsProcess::IsActive(unsigned int pFlags) const {
     return (pFlags & aiProcess_CalcTangentSpace) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently, on several threads if configured
+bool CalcTangentsProcess::IsParallelSafe() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool CalcTangentsProcess::SupportsMeshPass() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void CalcTangentsProcess::SetupProperties(const Importer *pImp) {
@@ -84,12 +95,23 @@ void CalcTangentsProcess::SetupProperties(const Importer *pImp) {
 void CalcTangentsProcess::Execute(aiScene *pScene) {
     ai_assert(nullptr != pScene);
 
+    ExecuteMeshPass(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+void CalcTangentsProcess::BeginMeshPass(aiScene *pScene) {
     ASSIMP_LOG_DEBUG("CalcTangentsProcess begin");
+    mProcessed.assign(pScene->mNumMeshes, false);
+}
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; a++) {
-        if (ProcessMesh(pScene->mMeshes[a], a)) bHas = true;
-    }
+// ------------------------------------------------------------------------------------------------
+void CalcTangentsProcess::ProcessMeshInPass(aiScene *pScene, unsigned int meshIndex) {
+    mProcessed[meshIndex] = ProcessMesh(pScene->mMeshes[meshIndex], meshIndex);
+}
+
+// ------------------------------------------------------------------------------------------------
+void CalcTangentsProcess::EndMeshPass(aiScene * /*pScene*/) {
+    const bool bHas = std::find(mProcessed.begin(), mProcessed.end(), true) != mProcessed.end();
 
     if (bHas) {
         ASSIMP_LOG_INFO("CalcTangentsProcess finished. Tangents have been calculated");
@@ -73,6 +73,16 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** Meshes are processed independently, see BaseProcess::IsParallelSafe()
+    */
+    bool IsParallelSafe() const override;
+
+    // -------------------------------------------------------------------
+    /** Runs in mesh passes, see BaseProcess::SupportsMeshPass()
+    */
+    bool SupportsMeshPass() const override;
+
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
     * The function is a request to the process to update its configuration
@@ -99,7 +109,17 @@ protected:
     */
     void Execute( aiScene* pScene) override;
 
+    // -------------------------------------------------------------------
+    /** Computes the tangents mesh by mesh, Execute() runs a pass of its own.
+    */
+    void BeginMeshPass(aiScene* pScene) override;
+    void ProcessMeshInPass(aiScene* pScene, unsigned int meshIndex) override;
+    void EndMeshPass(aiScene* pScene) override;
+
 private:
+    /** Whether tangents have been computed for each mesh of the pass */
+    std::vector<char> mProcessed;
+
     /** Configuration option: maximum smoothing angle, in radians*/
     float configMaxAngle;
     unsigned int configSourceUV;
@@ -67,6 +67,17 @@ bool GenVertexNormalsProcess::IsActive(unsigned int pFlags) const {
     return (pFlags & aiProcess_GenSmoothNormals) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently, on several threads if configured
+bool GenVertexNormalsProcess::IsParallelSafe() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenVertexNormalsProcess::SupportsMeshPass() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void GenVertexNormalsProcess::SetupProperties(const Importer *pImp) {
@@ -78,17 +89,27 @@ void GenVertexNormalsProcess::SetupProperties(const Importer *pImp) {
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void GenVertexNormalsProcess::Execute(aiScene *pScene) {
+    ExecuteMeshPass(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenVertexNormalsProcess::BeginMeshPass(aiScene *pScene) {
     ASSIMP_LOG_DEBUG("GenVertexNormalsProcess begin");
 
     if (pScene->mFlags & AI_SCENE_FLAGS_NON_VERBOSE_FORMAT) {
         throw DeadlyImportError("Post-processing order mismatch: expecting pseudo-indexed (\"verbose\") vertices here");
     }
+    mProcessed.assign(pScene->mNumMeshes, false);
+}
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        if (GenMeshVertexNormals(pScene->mMeshes[a], a))
-            bHas = true;
-    }
+// ------------------------------------------------------------------------------------------------
+void GenVertexNormalsProcess::ProcessMeshInPass(aiScene *pScene, unsigned int meshIndex) {
+    mProcessed[meshIndex] = GenMeshVertexNormals(pScene->mMeshes[meshIndex], meshIndex);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenVertexNormalsProcess::EndMeshPass(aiScene * /*pScene*/) {
+    const bool bHas = std::find(mProcessed.begin(), mProcessed.end(), true) != mProcessed.end();
 
     if (bHas) {
         ASSIMP_LOG_INFO("GenVertexNormalsProcess finished. "
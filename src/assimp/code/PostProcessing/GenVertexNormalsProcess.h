@@ -74,6 +74,16 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** Meshes are processed independently, see BaseProcess::IsParallelSafe()
+    */
+    bool IsParallelSafe() const override;
+
+    // -------------------------------------------------------------------
+    /** Runs in mesh passes, see BaseProcess::SupportsMeshPass()
+    */
+    bool SupportsMeshPass() const override;
+
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
     * The function is a request to the process to update its configuration
@@ -101,7 +111,18 @@ public:
     */
     bool GenMeshVertexNormals (aiMesh* pcMesh, unsigned int meshIndex);
 
+protected:
+    // -------------------------------------------------------------------
+    /** Computes the normals mesh by mesh, Execute() runs a pass of its own.
+    */
+    void BeginMeshPass(aiScene* pScene) override;
+    void ProcessMeshInPass(aiScene* pScene, unsigned int meshIndex) override;
+    void EndMeshPass(aiScene* pScene) override;
+
 private:
+    /** Whether normals have been computed for each mesh of the pass */
+    std::vector<char> mProcessed;
+
     /** Configuration option: maximum smoothing angle, in radians*/
     ai_real configMaxAngle;
     mutable bool force_ = false;
@@ -72,6 +72,17 @@ bool ImproveCacheLocalityProcess::IsActive(unsigned int pFlags) const {
     return (pFlags & aiProcess_ImproveCacheLocality) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently, on several threads if configured
+bool ImproveCacheLocalityProcess::IsParallelSafe() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ImproveCacheLocalityProcess::SupportsMeshPass() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Setup configuration
 void ImproveCacheLocalityProcess::SetupProperties(const Importer *pImp) {
@@ -82,17 +93,31 @@ void ImproveCacheLocalityProcess::SetupProperties(const Importer *pImp) {
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
+    ExecuteMeshPass(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityProcess::BeginMeshPass(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
+    mResults.assign(pScene->mNumMeshes, 0.f);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityProcess::ProcessMeshInPass(aiScene *pScene, unsigned int meshIndex) {
+    mResults[meshIndex] = ProcessMesh(pScene->mMeshes[meshIndex], meshIndex);
+}
+
+// ------------------------------------------------------------------------------------------------
+void ImproveCacheLocalityProcess::EndMeshPass(aiScene *pScene) {
     if (!pScene->mNumMeshes) {
         ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess skipped; there are no meshes");
         return;
     }
 
-    ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
-
     float out = 0.f;
     unsigned int numf = 0, numm = 0;
     for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        const float res = ProcessMesh(pScene->mMeshes[a], a);
+        const float res = mResults[a];
         if (res) {
             numf += pScene->mMeshes[a]->mNumFaces;
             out += res;
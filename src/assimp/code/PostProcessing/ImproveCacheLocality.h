@@ -71,6 +71,14 @@ public:
     // Check whether the pp step is active
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    // Meshes are processed independently
+    bool IsParallelSafe() const override;
+
+    // -------------------------------------------------------------------
+    // Runs in mesh passes
+    bool SupportsMeshPass() const override;
+
     // -------------------------------------------------------------------
     // Executes the pp step on a given scene
     void Execute( aiScene* pScene) override;
@@ -87,7 +95,16 @@ protected:
      */
     ai_real ProcessMesh( aiMesh* pMesh, unsigned int meshNum);
 
+    // -------------------------------------------------------------------
+    // Optimizes the meshes one by one, Execute() runs a pass of its own
+    void BeginMeshPass(aiScene* pScene) override;
+    void ProcessMeshInPass(aiScene* pScene, unsigned int meshIndex) override;
+    void EndMeshPass(aiScene* pScene) override;
+
 private:
+    //! Output ACMR of each mesh of the pass, 0 if it was skipped
+    std::vector<ai_real> mResults;
+
     //! Configuration parameter: specifies the size of the cache to
     //! optimize the vertex data for.
     unsigned int mConfigCacheDepth;
@@ -63,22 +63,41 @@ bool JoinVerticesProcess::IsActive( unsigned int pFlags) const {
     return (pFlags & aiProcess_JoinIdenticalVertices) != 0;
 }
 // ------------------------------------------------------------------------------------------------
+// Meshes are processed independently, on several threads if configured
+bool JoinVerticesProcess::IsParallelSafe() const {
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool JoinVerticesProcess::SupportsMeshPass() const {
+    return true;
+}
+// ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void JoinVerticesProcess::Execute( aiScene* pScene) {
+    ExecuteMeshPass(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesProcess::BeginMeshPass( aiScene* pScene) {
     ASSIMP_LOG_DEBUG("JoinVerticesProcess begin");
+    mNumOldVertices.assign(pScene->mNumMeshes, 0);
+    mNumVertices.assign(pScene->mNumMeshes, 0);
+}
 
-    // get the total number of vertices BEFORE the step is executed
-    int iNumOldVertices = 0;
-    if (!DefaultLogger::isNullLogger()) {
-        for( unsigned int a = 0; a < pScene->mNumMeshes; a++)   {
-            iNumOldVertices +=  pScene->mMeshes[a]->mNumVertices;
-        }
-    }
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesProcess::ProcessMeshInPass( aiScene* pScene, unsigned int meshIndex) {
+    // get the number of vertices BEFORE the step is executed
+    mNumOldVertices[meshIndex] = pScene->mMeshes[meshIndex]->mNumVertices;
+    mNumVertices[meshIndex] = ProcessMesh(pScene->mMeshes[meshIndex], meshIndex);
+}
 
-    // execute the step
-    int iNumVertices = 0;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++) {
-        iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
+// ------------------------------------------------------------------------------------------------
+void JoinVerticesProcess::EndMeshPass( aiScene* pScene) {
+    int iNumOldVertices = 0, iNumVertices = 0;
+    for( unsigned int a = 0; a < pScene->mNumMeshes; a++)   {
+        iNumOldVertices += mNumOldVertices[a];
+        iNumVertices += mNumVertices[a];
     }
 
     pScene->mFlags |= AI_SCENE_FLAGS_NON_VERBOSE_FORMAT;
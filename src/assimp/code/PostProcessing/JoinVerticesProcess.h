@@ -76,6 +76,16 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** Meshes are processed independently, see BaseProcess::IsParallelSafe()
+    */
+    bool IsParallelSafe() const override;
+
+    // -------------------------------------------------------------------
+    /** Runs in mesh passes, see BaseProcess::SupportsMeshPass()
+    */
+    bool SupportsMeshPass() const override;
+
     // -------------------------------------------------------------------
     /** Executes the post processing step on the given imported data.
     * At the moment a process is not supposed to fail.
@@ -89,6 +99,19 @@ public:
      * @param meshIndex Index of the mesh to process
      */
     int ProcessMesh( aiMesh* pMesh, unsigned int meshIndex);
+
+protected:
+    // -------------------------------------------------------------------
+    /** Joins the vertices mesh by mesh, Execute() runs a pass of its own.
+    */
+    void BeginMeshPass(aiScene* pScene) override;
+    void ProcessMeshInPass(aiScene* pScene, unsigned int meshIndex) override;
+    void EndMeshPass(aiScene* pScene) override;
+
+private:
+    /** Number of vertices of each mesh of the pass, before and after */
+    std::vector<int> mNumOldVertices;
+    std::vector<int> mNumVertices;
 };
 
 } // end of namespace Assimp
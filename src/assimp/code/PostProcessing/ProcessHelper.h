@@ -340,22 +340,38 @@ class ComputeSpatialSortProcess : public BaseProcess {
                                                            aiProcess_GenNormals | aiProcess_JoinIdenticalVertices));
     }
 
+    bool IsParallelSafe() const {
+        return true;
+    }
+
+    // In a mesh pass each mesh is sorted right before the steps using it
+    bool SupportsMeshPass() const {
+        return true;
+    }
+
     void Execute(aiScene *pScene) {
-        typedef std::pair<SpatialSort, ai_real> _Type;
-        ASSIMP_LOG_DEBUG("Generate spatially-sorted vertex cache");
+        ExecuteMeshPass(pScene);
+    }
 
-        std::vector<_Type> *p = new std::vector<_Type>(pScene->mNumMeshes);
-        std::vector<_Type>::iterator it = p->begin();
+protected:
+    typedef std::pair<SpatialSort, ai_real> _Type;
 
-        for (unsigned int i = 0; i < pScene->mNumMeshes; ++i, ++it) {
-            aiMesh *mesh = pScene->mMeshes[i];
-            _Type &blubb = *it;
-            blubb.first.Fill(mesh->mVertices, mesh->mNumVertices, sizeof(aiVector3D));
-            blubb.second = ComputePositionEpsilon(mesh);
-        }
+    void BeginMeshPass(aiScene *pScene) {
+        ASSIMP_LOG_DEBUG("Generate spatially-sorted vertex cache");
 
-        shared->AddProperty(AI_SPP_SPATIAL_SORT, p);
+        mSorts = new std::vector<_Type>(pScene->mNumMeshes);
+        shared->AddProperty(AI_SPP_SPATIAL_SORT, mSorts);
     }
+
+    void ProcessMeshInPass(aiScene *pScene, unsigned int meshIndex) {
+        aiMesh *mesh = pScene->mMeshes[meshIndex];
+        _Type &blubb = (*mSorts)[meshIndex];
+        blubb.first.Fill(mesh->mVertices, mesh->mNumVertices, sizeof(aiVector3D));
+        blubb.second = ComputePositionEpsilon(mesh);
+    }
+
+private:
+    std::vector<_Type> *mSorts = nullptr; // owned by shared
 };
 
 // -------------------------------------------------------------------------------
@@ -366,7 +382,29 @@ class DestroySpatialSortProcess : public BaseProcess {
                                                         aiProcess_GenNormals | aiProcess_JoinIdenticalVertices));
     }
 
-    void Execute(aiScene * /*pScene*/) {
+    bool IsParallelSafe() const {
+        return true;
+    }
+
+    // In a mesh pass each mesh's sort is freed as soon as the steps are done with it
+    bool SupportsMeshPass() const {
+        return true;
+    }
+
+    void Execute(aiScene *pScene) {
+        ExecuteMeshPass(pScene);
+    }
+
+protected:
+    void ProcessMeshInPass(aiScene * /*pScene*/, unsigned int meshIndex) {
+        std::vector<std::pair<SpatialSort, ai_real>> *avf = nullptr;
+        shared->GetProperty(AI_SPP_SPATIAL_SORT, avf);
+        if (avf) {
+            (*avf)[meshIndex].first = SpatialSort();
+        }
+    }
+
+    void EndMeshPass(aiScene * /*pScene*/) {
         shared->RemoveProperty(AI_SPP_SPATIAL_SORT);
     }
 };
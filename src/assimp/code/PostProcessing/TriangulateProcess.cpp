@@ -162,20 +162,43 @@ bool TriangulateProcess::IsActive( unsigned int pFlags) const {
     return (pFlags & aiProcess_Triangulate) != 0;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Meshes are processed independently, on several threads if configured
+bool TriangulateProcess::IsParallelSafe() const {
+#ifdef AI_BUILD_TRIANGULATE_DEBUG_POLYS
+    return false; // All meshes write to the same debug file
+#else
+    return true;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------
+bool TriangulateProcess::SupportsMeshPass() const {
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Executes the post processing step on the given imported data.
 void TriangulateProcess::Execute( aiScene* pScene) {
+    ExecuteMeshPass(pScene);
+}
+
+// ------------------------------------------------------------------------------------------------
+void TriangulateProcess::BeginMeshPass( aiScene* pScene) {
     ASSIMP_LOG_DEBUG("TriangulateProcess begin");
+    mProcessed.assign(pScene->mNumMeshes, false);
+}
 
-    bool bHas = false;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-    {
-        if (pScene->mMeshes[ a ]) {
-            if ( TriangulateMesh( pScene->mMeshes[ a ] ) ) {
-                bHas = true;
-            }
-        }
+// ------------------------------------------------------------------------------------------------
+void TriangulateProcess::ProcessMeshInPass( aiScene* pScene, unsigned int meshIndex) {
+    if (pScene->mMeshes[ meshIndex ]) {
+        mProcessed[meshIndex] = TriangulateMesh( pScene->mMeshes[ meshIndex ] );
     }
+}
+
+// ------------------------------------------------------------------------------------------------
+void TriangulateProcess::EndMeshPass( aiScene* /*pScene*/) {
+    const bool bHas = std::find(mProcessed.begin(), mProcessed.end(), true) != mProcessed.end();
     if ( bHas ) {
         ASSIMP_LOG_INFO( "TriangulateProcess finished. All polygons have been triangulated." );
     } else {
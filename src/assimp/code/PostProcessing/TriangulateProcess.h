@@ -74,6 +74,16 @@ public:
     */
     bool IsActive( unsigned int pFlags) const override;
 
+    // -------------------------------------------------------------------
+    /** Meshes are processed independently, see BaseProcess::IsParallelSafe()
+    */
+    bool IsParallelSafe() const override;
+
+    // -------------------------------------------------------------------
+    /** Runs in mesh passes, see BaseProcess::SupportsMeshPass()
+    */
+    bool SupportsMeshPass() const override;
+
     // -------------------------------------------------------------------
     /** Executes the post processing step on the given imported data.
     * At the moment a process is not supposed to fail.
@@ -86,6 +96,18 @@ public:
      * @param pMesh The mesh to triangulate.
      */
     bool TriangulateMesh( aiMesh* pMesh);
+
+protected:
+    // -------------------------------------------------------------------
+    /** Triangulates the meshes one by one, Execute() runs a pass of its own.
+    */
+    void BeginMeshPass(aiScene* pScene) override;
+    void ProcessMeshInPass(aiScene* pScene, unsigned int meshIndex) override;
+    void EndMeshPass(aiScene* pScene) override;
+
+private:
+    /** Whether each mesh of the pass has been triangulated */
+    std::vector<char> mProcessed;
 };
 
 } // end of namespace Assimp
@@ -124,6 +124,20 @@ public:
      *  See fflush() for more details.
      */
     virtual void Flush() = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns a pointer to the whole contents of the file, if the
+     *  stream holds them in memory.
+     *
+     *  Streams over memory-mapped files or memory buffers return a pointer
+     *  to FileSize() bytes, valid until the stream is closed, so that
+     *  readers can parse the file in place instead of reading it into a
+     *  copy. The pointer does not depend on the read cursor. The default
+     *  implementation returns nullptr: use Read().
+     */
+    virtual const uint8_t *GetDirectPointer() const {
+        return nullptr;
+    }
 }; //! class IOStream
 
 } //!namespace Assimp
@@ -0,0 +1,87 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2024, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/**
+ *  @file Implementation of IOSystem reading files through memory mappings
+ */
+#pragma once
+#ifndef AI_MMAPIOSYSTEM_H_INC
+#define AI_MMAPIOSYSTEM_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/DefaultIOSystem.h>
+
+namespace Assimp    {
+
+// ---------------------------------------------------------------------------
+/** IOSystem mapping the files it opens for reading into memory.
+ *
+ *  Streams of mapped files implement IOStream::GetDirectPointer(), so the
+ *  importers supporting it parse the mapping in place instead of copying the
+ *  file into a buffer of their own, and pages are read from disk on first
+ *  access. Files opened for writing, empty files and files which cannot be
+ *  mapped are opened by DefaultIOSystem, and so are all files when mapping
+ *  is turned off.
+ *
+ *  The mapping is private and copy-on-write: writes through the pointer
+ *  never reach the file. Truncating a file while it is mapped makes reads of
+ *  the lost pages fail with a bus error, as with any memory-mapped file. */
+class ASSIMP_API MMapIOSystem : public DefaultIOSystem {
+public:
+    // -------------------------------------------------------------------
+    /** Constructor. `map` false opens every file like DefaultIOSystem. */
+    explicit MMapIOSystem(bool map = true) : mMap(map) {}
+
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path, mapping it into memory when
+     *  `pMode` only reads it. */
+    IOStream* Open( const char* pFile, const char* pMode = "rb") override;
+
+private:
+    bool mMap;
+};
+
+} //!ns Assimp
+
+#endif //AI_MMAPIOSYSTEM_H_INC
@@ -111,7 +111,9 @@ public:
 
     // ---------------------------------------------------------------------
     ~StreamReader() {
-        delete[] mBuffer;
+        if (mOwnsBuffer) {
+            delete[] mBuffer;
+        }
     }
 
     // deprecated, use overloaded operator>> instead
@@ -309,6 +311,15 @@ private:
             throw DeadlyImportError("StreamReader: File is empty or EOF is already reached");
         }
 
+        // Read in place from streams holding the file in memory. The
+        // pointer is only used for reading.
+        if (const uint8_t *data = mStream->GetDirectPointer()) {
+            mCurrent = mBuffer = const_cast<int8_t *>(reinterpret_cast<const int8_t *>(data + mStream->Tell()));
+            mEnd = mLimit = mBuffer + filesize;
+            return;
+        }
+
+        mOwnsBuffer = true;
         mCurrent = mBuffer = new int8_t[filesize];
         const size_t read = mStream->Read(mCurrent, 1, filesize);
         // (read < s) can only happen if the stream was opened in text mode, in which case FileSize() is not reliable
@@ -323,6 +334,7 @@ private:
     int8_t *mEnd;
     int8_t *mLimit;
     bool mLe;
+    bool mOwnsBuffer = false; // Else mBuffer points into the stream
 };
 
 // --------------------------------------------------------------------------------------------
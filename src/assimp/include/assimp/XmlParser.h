@@ -304,14 +304,19 @@ bool TXmlParser<TNodeType>::parse(IOStream *stream) {
     }
 
     const size_t len = stream->FileSize();
-    mData.resize(len + 1);
-    memset(&mData[0], '\0', len + 1);
-    stream->Read(&mData[0], 1, len);
-
     mDoc = new pugi::xml_document();
-    // load_string assumes native encoding (aka always utf-8 per build options)
-    //pugi::xml_parse_result parse_result = mDoc->load_string(&mData[0], pugi::parse_full);
-     pugi::xml_parse_result parse_result = mDoc->load_buffer(&mData[0], mData.size(), pugi::parse_full);
+    pugi::xml_parse_result parse_result;
+    const uint8_t *data = stream->GetDirectPointer();
+    if (nullptr != data && 0 == stream->Tell()) {
+        // pugixml parses destructively, into its own copy of the file
+        parse_result = mDoc->load_buffer(data, len, pugi::parse_full);
+    } else {
+        // Parse the copy in place, it lives as long as the document
+        mData.resize(len + 1);
+        memset(&mData[0], '\0', len + 1);
+        stream->Read(&mData[0], 1, len);
+        parse_result = mDoc->load_buffer_inplace(&mData[0], mData.size(), pugi::parse_full);
+    }
     if (parse_result.status == pugi::status_ok) {
         return true;
     }
@@ -0,0 +1,111 @@
+#include "anim_convert.h"
+
+#include <math.h>
+#include <string.h>
+
+int unpack_vector_keys(const struct aiVectorKey *keys, unsigned int num_keys, double *times, float *values) {
+    for (unsigned int k = 0; k < num_keys; ++k, values += 3) {
+        times[k] = keys[k].mTime;
+        values[0] = keys[k].mValue.x;
+        values[1] = keys[k].mValue.y;
+        values[2] = keys[k].mValue.z;
+    }
+    return num_keys && keys[0].mInterpolation == aiAnimInterpolation_Step;
+}
+
+int unpack_quat_keys(const struct aiQuatKey *keys, unsigned int num_keys, double *times, float *values) {
+    for (unsigned int k = 0; k < num_keys; ++k, values += 4) {
+        times[k] = keys[k].mTime;
+        values[0] = keys[k].mValue.w;
+        values[1] = keys[k].mValue.x;
+        values[2] = keys[k].mValue.y;
+        values[3] = keys[k].mValue.z;
+    }
+    return num_keys && keys[0].mInterpolation == aiAnimInterpolation_Step;
+}
+
+unsigned int max_morph_targets(const struct aiMeshMorphKey *keys, unsigned int num_keys) {
+    unsigned int width = 0;
+    for (unsigned int k = 0; k < num_keys; ++k) {
+        if (keys[k].mNumValuesAndWeights > width) width = keys[k].mNumValuesAndWeights;
+    }
+    return width;
+}
+
+void unpack_morph_keys(const struct aiMeshMorphKey *keys, unsigned int num_keys, unsigned int width,
+                       double *times, uint32_t *targets, float *weights) {
+    memset(targets, 0, (size_t)num_keys * width * sizeof(uint32_t));
+    memset(weights, 0, (size_t)num_keys * width * sizeof(float));
+    for (unsigned int k = 0; k < num_keys; ++k, targets += width, weights += width) {
+        times[k] = keys[k].mTime;
+        for (unsigned int i = 0; i < keys[k].mNumValuesAndWeights; ++i) {
+            targets[i] = keys[k].mValues[i];
+            weights[i] = (float)keys[k].mWeights[i];
+        }
+    }
+}
+
+// Same as aiQuaternion::Interpolate: shortest path, linear when nearly equal
+static void slerp(const float *a, const float *b, float t, float *out) {
+    float cosom = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    float sign = 1.0f;
+    if (cosom < 0.0f) {
+        cosom = -cosom;
+        sign = -1.0f;
+    }
+    float sa = 1.0f - t, sb = t;
+    if (1.0f - cosom > 0.0001f) {
+        float omega = acosf(cosom);
+        float sinom = sinf(omega);
+        sa = sinf((1.0f - t) * omega) / sinom;
+        sb = sinf(t * omega) / sinom;
+    }
+    sb *= sign;
+    for (int c = 0; c < 4; ++c) out[c] = sa * a[c] + sb * b[c];
+}
+
+// Samples one key component into every frame of `out` (rows `out_stride`
+// floats apart). Frame times only grow, so the key cursor only moves forward
+// and each key is visited once.
+static void sample_keys(const AnimKeys *keys, unsigned int ncomp, const float *identity, size_t num_frames,
+                        double ticks_per_frame, float *out, size_t out_stride) {
+    if (!keys || keys->count == 0) {
+        for (size_t f = 0; f < num_frames; ++f, out += out_stride) memcpy(out, identity, ncomp * sizeof(float));
+        return;
+    }
+
+    unsigned int k = 0; // Last key at or before the sample time, if any
+    for (size_t f = 0; f < num_frames; ++f, out += out_stride) {
+        double t = (double)f * ticks_per_frame;
+        while (k + 1 < keys->count && keys->times[k + 1] <= t) ++k;
+        const float *a = keys->values + (size_t)k * ncomp;
+        if (t <= keys->times[0] || k + 1 == keys->count || keys->step) {
+            memcpy(out, a, ncomp * sizeof(float));
+            continue;
+        }
+        const float *b = a + ncomp;
+        double span = keys->times[k + 1] - keys->times[k];
+        float alpha = span > 0.0 ? (float)((t - keys->times[k]) / span) : 0.0f;
+        if (ncomp == 4) {
+            slerp(a, b, alpha, out);
+        } else {
+            for (unsigned int c = 0; c < ncomp; ++c) out[c] = a[c] + (b[c] - a[c]) * alpha;
+        }
+    }
+}
+
+void resample_tracks(const AnimTrack *const *tracks, size_t num_tracks, size_t num_frames, double ticks_per_frame,
+                     float *out) {
+    static const float zero[3] = {0.0f, 0.0f, 0.0f};
+    static const float one[3] = {1.0f, 1.0f, 1.0f};
+    static const float identity_rotation[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+    size_t stride = num_tracks * ANIM_FRAME_COMPONENTS;
+
+    for (size_t n = 0; n < num_tracks; ++n) {
+        const AnimTrack *track = tracks[n];
+        float *row = out + n * ANIM_FRAME_COMPONENTS;
+        sample_keys(track ? &track->position : NULL, 3, zero, num_frames, ticks_per_frame, row, stride);
+        sample_keys(track ? &track->rotation : NULL, 4, identity_rotation, num_frames, ticks_per_frame, row + 3, stride);
+        sample_keys(track ? &track->scaling : NULL, 3, one, num_frames, ticks_per_frame, row + 7, stride);
+    }
+}
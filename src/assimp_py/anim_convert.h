@@ -0,0 +1,61 @@
+#ifndef ASSIMP_PY_ANIM_CONVERT_H
+#define ASSIMP_PY_ANIM_CONVERT_H
+
+// Conversion kernels for animation keys: unpacking the aiNodeAnim and
+// aiMeshMorphAnim key structs into contiguous time and value arrays, and
+// resampling node channels to a fixed frame rate. None of these functions
+// touch Python, call them with the GIL released.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assimp/anim.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Keys of one component (position, rotation or scaling) of a node channel
+typedef struct {
+    const double *times;    // Ascending key times, in ticks
+    const float *values;    // `count` rows of 3 floats, or 4 (w, x, y, z) for rotations
+    unsigned int count;
+    int step;               // Hold each key until the next one instead of interpolating
+} AnimKeys;
+
+typedef struct {
+    AnimKeys position, rotation, scaling;
+} AnimTrack;
+
+// Values per node and frame in resample_tracks output
+#define ANIM_FRAME_COMPONENTS 10
+
+// Copies `num_keys` vector keys into `times` and `values` (num_keys x 3).
+// Returns whether the keys use step interpolation.
+int unpack_vector_keys(const struct aiVectorKey *keys, unsigned int num_keys, double *times, float *values);
+
+// Copies `num_keys` rotation keys into `times` and `values` (num_keys x 4,
+// w x y z). Returns whether the keys use step interpolation.
+int unpack_quat_keys(const struct aiQuatKey *keys, unsigned int num_keys, double *times, float *values);
+
+// Largest number of targets weighted by any key of a morph channel
+unsigned int max_morph_targets(const struct aiMeshMorphKey *keys, unsigned int num_keys);
+
+// Copies morph keys into `times` and the (num_keys, width) `targets` and
+// `weights` arrays. Unused slots get target 0 and weight 0.
+void unpack_morph_keys(const struct aiMeshMorphKey *keys, unsigned int num_keys, unsigned int width,
+                       double *times, uint32_t *targets, float *weights);
+
+// Samples `num_tracks` tracks at `num_frames` times `ticks_per_frame` apart,
+// starting at 0, into `out` (num_frames, num_tracks, ANIM_FRAME_COMPONENTS):
+// position xyz, rotation wxyz and scaling xyz per track. Positions and
+// scalings are interpolated linearly and rotations spherically, times
+// outside the keys hold the first or last key. NULL tracks, and components
+// without keys, get the identity transform.
+void resample_tracks(const AnimTrack *const *tracks, size_t num_tracks, size_t num_frames, double ticks_per_frame,
+                     float *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSIMP_PY_ANIM_CONVERT_H
@@ -4,16 +4,159 @@
 #include <stdio.h>        // For FILE, fopen, etc. (though only used for existence check)
 #include <string.h>       // For strcmp, memcpy
 #include <stdlib.h>       // For malloc, free
+#include <math.h>         // For NAN, isnan
+#include <errno.h>        // For load_snapshot errors
 
+#include <assimp/cexport.h>
 #include <assimp/cimport.h>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 #include <assimp/material.h>
 
+#include "import_cache.h"
+#include "import_pool.h"
+#include "import_progress.h"
+#include "memory_import.h"
+#include "mesh_convert.h"
+#include "embedded_textures.h"
+#include "anim_convert.h"
+#include "node_table.h"
+#include "scene_export.h"
+#include "snapshot.h"
+
+#if PY_VERSION_HEX < 0x030A0000
+// Py_NewRef is new in Python 3.10
+static inline PyObject *Py_NewRef(PyObject *obj) {
+    Py_INCREF(obj);
+    return obj;
+}
+#endif
+
 // Forward declarations for type objects
 static PyTypeObject MeshType;
 static PyTypeObject SceneType;
 static PyTypeObject NodeType;
+static PyTypeObject BufferType;
+static PyTypeObject ImportIteratorType;
+static PyTypeObject LazySequenceType;
+static PyTypeObject MaterialType;
+static PyTypeObject TextureSlotType;
+static PyTypeObject TextureType;
+static PyTypeObject AnimationType;
+static PyTypeObject AnimationChannelType;
+static PyTypeObject MorphChannelType;
+static PyTypeObject CancelTokenType;
+static PyTypeObject ImportCacheType;
+
+static PyObject *ImportCancelledError;
+
+static PyObject* buffer_memoryview(void *data, int ndim, const Py_ssize_t *shape, const Py_ssize_t *strides,
+                                   const char *format, Py_ssize_t itemsize, PyObject *owner);
+static PyObject* create_memoryview(void* data, Py_ssize_t num_items, Py_ssize_t ncomp, Py_ssize_t row_stride,
+                                   const char* format, Py_ssize_t itemsize, PyObject *owner);
+
+// --- Buffer Type Definition ---
+// Read-only exporter for a block of mesh data. Mesh attributes are memoryviews
+// created from a Buffer, so the memory stays alive for as long as any view of
+// it exists. The data is either owned (malloc'd, freed with the Buffer) or
+// borrowed from an aiScene kept alive through the `owner` capsule.
+// Buffers are 1-D (indices), 2-D (num_vertices, components) or 3-D (bone
+// matrices). Borrowed 2-D buffers may have a row stride larger than their
+// row, e.g. 2 component texcoords living in aiVector3D arrays.
+#define BUFFER_MAX_NDIM 3
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *owner;        // Object keeping `data` alive, or NULL if `data` is owned
+    void *data;
+    Py_ssize_t len;         // Total length in bytes of the items (product(shape) * itemsize)
+    Py_ssize_t itemsize;
+    const char *format;     // Static struct format string ("f", "I", ...)
+    int ndim;               // 1 to BUFFER_MAX_NDIM
+    Py_ssize_t shape[BUFFER_MAX_NDIM];
+    Py_ssize_t strides[BUFFER_MAX_NDIM];
+} Buffer;
+
+// Whether the buffer items are laid out back to back in C order
+static int Buffer_is_contiguous(Buffer *self) {
+    Py_ssize_t expected = self->itemsize;
+    for (int d = self->ndim - 1; d >= 0; --d) {
+        if (self->strides[d] != expected) return 0;
+        expected *= self->shape[d];
+    }
+    return 1;
+}
+
+static void Buffer_dealloc(Buffer *self) {
+    if (self->owner) {
+        Py_CLEAR(self->owner);
+    } else {
+        free(self->data);
+    }
+    self->data = NULL;
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int Buffer_getbuffer(Buffer *self, Py_buffer *view, int flags) {
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "assimp_py buffers are read-only");
+        view->obj = NULL;
+        return -1;
+    }
+    int contiguous = Buffer_is_contiguous(self);
+    int wants_contiguous = (flags & (PyBUF_C_CONTIGUOUS | PyBUF_F_CONTIGUOUS | PyBUF_ANY_CONTIGUOUS) & ~PyBUF_STRIDES) != 0;
+    if (!contiguous && ((flags & PyBUF_STRIDES) != PyBUF_STRIDES || wants_contiguous)) {
+        PyErr_SetString(PyExc_BufferError, "buffer is strided, it must be requested with strides");
+        view->obj = NULL;
+        return -1;
+    }
+    int num_extended = 0; // Dimensions longer than 1, C and Fortran order only agree if there is one
+    for (int d = 0; d < self->ndim; ++d) {
+        num_extended += self->shape[d] > 1;
+    }
+    if ((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS && num_extended > 1) {
+        PyErr_SetString(PyExc_BufferError, "buffer is not Fortran contiguous");
+        view->obj = NULL;
+        return -1;
+    }
+
+    view->obj = (PyObject *)self;
+    Py_INCREF(self);
+    view->buf = self->data;
+    view->len = self->len;
+    view->readonly = 1;
+    view->itemsize = self->itemsize;
+    view->format = (flags & PyBUF_FORMAT) ? (char *)self->format : NULL;
+    if ((flags & PyBUF_ND) == PyBUF_ND) {
+        view->ndim = self->ndim;
+        view->shape = self->shape;
+    } else {
+        // Simple request: a flat run of bytes, only possible when contiguous
+        view->ndim = 1;
+        view->shape = NULL;
+    }
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+static PyBufferProcs Buffer_as_buffer = {
+    .bf_getbuffer = (getbufferproc)Buffer_getbuffer,
+    .bf_releasebuffer = NULL,
+};
+
+static PyTypeObject BufferType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "assimp_py.Buffer",
+    .tp_doc = "Read-only buffer backing mesh data memoryviews",
+    .tp_basicsize = sizeof(Buffer),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)Buffer_dealloc,
+    .tp_as_buffer = &Buffer_as_buffer,
+};
+
 
 // --- Node Type Definition ---
 typedef struct Node {
@@ -81,22 +224,22 @@ typedef struct {
     PyObject *name;             // PyUnicodeObject
     PyObject *num_uv_components;// List of ints (or maybe just one int if needed?)
     PyObject *indices;          // PyMemoryView (uint32)
+    PyObject *face_offsets;     // PyMemoryView (uint32, num_faces + 1) with polygons=True, else None
     PyObject *vertices;         // PyMemoryView (float32 x 3)
     PyObject *normals;          // PyMemoryView (float32 x 3) or None
     PyObject *tangents;         // PyMemoryView (float32 x 3) or None
     PyObject *bitangents;       // PyMemoryView (float32 x 3) or None
     PyObject *colors;           // List of PyMemoryView (float32 x 4) or None
     PyObject *texcoords;        // List of PyMemoryView (float32 x N) or None
+    PyObject *position_scale;   // Tuple of 3 floats dequantizing `vertices`, or None
+    PyObject *position_offset;  // Tuple of 3 floats dequantizing `vertices`, or None
+    PyObject *bone_names;       // List of str
+    PyObject *bone_offset_matrices; // PyMemoryView (float32 x num_bones x 4 x 4) or None
+    PyObject *joint_indices;    // PyMemoryView (uint16, uint32 past 65536 bones, x num_vertices x K) or None
+    PyObject *joint_weights;    // PyMemoryView (float32 x num_vertices x K) or None
 
-    // --- C Data Pointers (managed internally) ---
-    // We store these to manage the lifetime of the memory backing the memoryviews
-    unsigned int *c_indices;
-    float *c_vertices;
-    float *c_normals;
-    float *c_tangents;
-    float *c_bitangents;
-    float **c_colors;           // Array of pointers to color sets
-    float **c_texcoords;        // Array of pointers to texcoord sets
+    // The memory behind the memoryviews is owned by the Buffer objects they
+    // were created from, so the Mesh itself holds no C arrays.
 
     // --- Other Attributes ---
     unsigned int num_vertices;
@@ -105,7 +248,7 @@ typedef struct {
     unsigned int material_index;
     unsigned int num_color_sets;
     unsigned int num_texcoord_sets;
-    unsigned int *c_num_uv_components; // Array for UV component counts
+    unsigned int num_bones;
 
 } Mesh;
 
@@ -114,29 +257,28 @@ static int Mesh_init(Mesh *self, PyObject *args, PyObject *kwds) {
     self->name = NULL;
     self->num_uv_components = NULL;
     self->indices = NULL;
+    self->face_offsets = NULL;
     self->vertices = NULL;
     self->normals = NULL;
     self->tangents = NULL;
     self->bitangents = NULL;
     self->colors = NULL;
     self->texcoords = NULL;
-
-    // Initialize C pointers to NULL and counts to 0
-    self->c_indices = NULL;
-    self->c_vertices = NULL;
-    self->c_normals = NULL;
-    self->c_tangents = NULL;
-    self->c_bitangents = NULL;
-    self->c_colors = NULL;
-    self->c_texcoords = NULL;
-    self->c_num_uv_components = NULL;
-
+    self->position_scale = NULL;
+    self->position_offset = NULL;
+    self->bone_names = NULL;
+    self->bone_offset_matrices = NULL;
+    self->joint_indices = NULL;
+    self->joint_weights = NULL;
+
+    // Initialize counts to 0
     self->num_vertices = 0;
     self->num_indices = 0;
     self->num_faces = 0;
     self->material_index = 0;
     self->num_color_sets = 0;
     self->num_texcoord_sets = 0;
+    self->num_bones = 0;
     return 0;
 }
 
@@ -145,33 +287,19 @@ static void Mesh_dealloc(Mesh *self) {
     Py_CLEAR(self->name);
     Py_CLEAR(self->num_uv_components);
     Py_CLEAR(self->indices);
+    Py_CLEAR(self->face_offsets);
     Py_CLEAR(self->vertices);
     Py_CLEAR(self->normals);
     Py_CLEAR(self->tangents);
     Py_CLEAR(self->bitangents);
     Py_CLEAR(self->colors);
     Py_CLEAR(self->texcoords);
-
-    // Free C arrays
-    free(self->c_indices);
-    free(self->c_vertices);
-    free(self->c_normals);
-    free(self->c_tangents);
-    free(self->c_bitangents);
-    if (self->c_colors) {
-        for (unsigned int i = 0; i < self->num_color_sets; ++i) {
-            free(self->c_colors[i]);
-        }
-        free(self->c_colors);
-    }
-    if (self->c_texcoords) {
-        for (unsigned int i = 0; i < self->num_texcoord_sets; ++i) {
-            free(self->c_texcoords[i]);
-        }
-        free(self->c_texcoords);
-    }
-    free(self->c_num_uv_components);
-
+    Py_CLEAR(self->position_scale);
+    Py_CLEAR(self->position_offset);
+    Py_CLEAR(self->bone_names);
+    Py_CLEAR(self->bone_offset_matrices);
+    Py_CLEAR(self->joint_indices);
+    Py_CLEAR(self->joint_weights);
 
     // Free the object itself
     Py_TYPE(self)->tp_free((PyObject *)self);
@@ -185,14 +313,176 @@ static PyMemberDef Mesh_members[] = {
     {"num_indices", T_UINT, offsetof(Mesh, num_indices), READONLY, "Total number of indices"},
 
     // Data attributes (MemoryViews or None)
-    {"indices", T_OBJECT_EX, offsetof(Mesh, indices), READONLY, "Vertex indices (memoryview, uint32)"},
-    {"vertices", T_OBJECT_EX, offsetof(Mesh, vertices), READONLY, "Vertex positions (memoryview, float32, Nx3)"},
-    {"normals", T_OBJECT_EX, offsetof(Mesh, normals), READONLY, "Vertex normals (memoryview, float32, Nx3 or None)"},
-    {"tangents", T_OBJECT_EX, offsetof(Mesh, tangents), READONLY, "Vertex tangents (memoryview, float32, Nx3 or None)"},
-    {"bitangents", T_OBJECT_EX, offsetof(Mesh, bitangents), READONLY, "Vertex bitangents (memoryview, float32, Nx3 or None)"},
+    {"indices", T_OBJECT_EX, offsetof(Mesh, indices), READONLY, "Vertex indices (memoryview, uint32, or uint16 with compact_indices)"},
+    {"face_offsets", T_OBJECT_EX, offsetof(Mesh, face_offsets), READONLY, "Start of each face in indices, plus the total (memoryview, uint32, num_faces + 1), or None without polygons=True"},
+    {"vertices", T_OBJECT_EX, offsetof(Mesh, vertices), READONLY, "Vertex positions (memoryview, float32, Nx3, or uint16 with quantize_positions)"},
+    {"normals", T_OBJECT_EX, offsetof(Mesh, normals), READONLY, "Vertex normals (memoryview, float32/float16/snorm16, Nx3 or None)"},
+    {"tangents", T_OBJECT_EX, offsetof(Mesh, tangents), READONLY, "Vertex tangents (memoryview, float32/float16/snorm16, Nx3 or None)"},
+    {"bitangents", T_OBJECT_EX, offsetof(Mesh, bitangents), READONLY, "Vertex bitangents (memoryview, float32/float16/snorm16, Nx3 or None)"},
     {"colors", T_OBJECT_EX, offsetof(Mesh, colors), READONLY, "List of vertex color sets (list of memoryview, float32, Nx4 or None)"},
-    {"texcoords", T_OBJECT_EX, offsetof(Mesh, texcoords), READONLY, "List of vertex texture coordinate sets (list of memoryview, float32, NxNcomp or None)"},
+    {"texcoords", T_OBJECT_EX, offsetof(Mesh, texcoords), READONLY, "List of vertex texture coordinate sets (list of memoryview, float32/float16, NxNcomp or None)"},
+    {"position_scale", T_OBJECT_EX, offsetof(Mesh, position_scale), READONLY, "Per-axis scale of quantized positions (vertices * scale + offset), or None"},
+    {"position_offset", T_OBJECT_EX, offsetof(Mesh, position_offset), READONLY, "Per-axis offset of quantized positions, or None"},
     {"num_uv_components", T_OBJECT_EX, offsetof(Mesh, num_uv_components), READONLY, "List of component counts for each texcoord set"},
+    {"num_bones", T_UINT, offsetof(Mesh, num_bones), READONLY, "Number of bones"},
+    {"bone_names", T_OBJECT_EX, offsetof(Mesh, bone_names), READONLY, "List of bone names"},
+    {"bone_offset_matrices", T_OBJECT_EX, offsetof(Mesh, bone_offset_matrices), READONLY, "Mesh to bone space matrices (memoryview, float32, num_bones x 4 x 4, row-major, or None)"},
+    {"joint_indices", T_OBJECT_EX, offsetof(Mesh, joint_indices), READONLY, "Bone index of each vertex weight (memoryview, uint16, or uint32 for meshes of more than 65536 bones, num_vertices x K, or None)"},
+    {"joint_weights", T_OBJECT_EX, offsetof(Mesh, joint_weights), READONLY, "Vertex bone weights, 0 for unused slots (memoryview, float32, num_vertices x K, or None)"},
+    {NULL} /* Sentinel */
+};
+
+// Maximum number of attributes in an interleaved layout (P, N, T, X, B, C)
+#define MAX_INTERLEAVED_ATTRIBUTES 6
+
+// Returns the (borrowed) memoryview for an interleaved layout code, or NULL if the mesh has none
+static PyObject* Mesh_attribute_for_code(Mesh *self, char code) {
+    PyObject *attr = NULL;
+    switch (code) {
+        case 'P': attr = self->vertices; break;
+        case 'N': attr = self->normals; break;
+        case 'X': attr = self->tangents; break;
+        case 'B': attr = self->bitangents; break;
+        case 'T': attr = self->texcoords && PyList_Check(self->texcoords) && PyList_GET_SIZE(self->texcoords) ? PyList_GET_ITEM(self->texcoords, 0) : NULL; break;
+        case 'C': attr = self->colors && PyList_Check(self->colors) && PyList_GET_SIZE(self->colors) ? PyList_GET_ITEM(self->colors, 0) : NULL; break;
+    }
+    return attr == Py_None ? NULL : attr;
+}
+
+PyDoc_STRVAR(Mesh_interleaved_doc,
+"interleaved(layout: str = 'P3N3T2', dtype: str = 'f32') -> tuple[memoryview, int, dict[str, int]]\n"
+"--\n\n"
+"Packs vertex attributes into one interleaved buffer, ready for GPU upload.\n\n"
+"Args:\n"
+"    layout: Attribute codes, each followed by its component count (1-4):\n"
+"            P position, N normal, T texcoords (set 0), X tangent,\n"
+"            B bitangent, C color (set 0). Components past the count are\n"
+"            dropped, e.g. 'T2' takes u, v of 3 component texcoords.\n"
+"    dtype: Component type of the output, 'f32' or 'f16'.\n\n"
+"Returns:\n"
+"    (buffer, stride, offsets): a (num_vertices, components per vertex)\n"
+"    memoryview, the vertex stride in bytes and the byte offset of each\n"
+"    attribute code within a vertex.\n\n"
+"Raises:\n"
+"    ValueError: If the layout is malformed, names a missing attribute or an\n"
+"                attribute that was not imported as float32.");
+
+static PyObject* Mesh_interleaved(Mesh *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"layout", "dtype", NULL};
+    const char *layout = "P3N3T2";
+    const char *dtype = "f32";
+    char codes[MAX_INTERLEAVED_ATTRIBUTES];
+    Py_ssize_t counts[MAX_INTERLEAVED_ATTRIBUTES];
+    Py_ssize_t offsets[MAX_INTERLEAVED_ATTRIBUTES];
+    Py_buffer views[MAX_INTERLEAVED_ATTRIBUTES];
+    int num_attributes = 0, num_views = 0;
+    Py_ssize_t components = 0;
+    PyObject *result = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|ss:interleaved", kwlist, &layout, &dtype)) {
+        return NULL;
+    }
+    int half = strcmp(dtype, "f16") == 0;
+    if (!half && strcmp(dtype, "f32") != 0) {
+        PyErr_Format(PyExc_ValueError, "Unsupported dtype '%s'", dtype);
+        return NULL;
+    }
+    Py_ssize_t itemsize = half ? sizeof(uint16_t) : sizeof(float);
+
+    // Parse the layout into (code, count) pairs
+    for (const char *c = layout; *c; c += 2) {
+        if (!strchr("PNXBTC", c[0]) || c[1] < '1' || c[1] > '4' || memchr(codes, c[0], num_attributes)) {
+            PyErr_Format(PyExc_ValueError, "Invalid layout '%s'", layout);
+            return NULL;
+        }
+        codes[num_attributes] = c[0];
+        counts[num_attributes] = c[1] - '0';
+        offsets[num_attributes] = components * itemsize;
+        components += counts[num_attributes];
+        num_attributes++;
+    }
+    if (num_attributes == 0) {
+        PyErr_SetString(PyExc_ValueError, "layout is empty");
+        return NULL;
+    }
+
+    // Get the source attributes, strided views are fine
+    for (int a = 0; a < num_attributes; ++a) {
+        PyObject *attr = Mesh_attribute_for_code(self, codes[a]);
+        if (!attr) {
+            PyErr_Format(PyExc_ValueError, "Mesh has no data for layout code '%c'", codes[a]);
+            goto done;
+        }
+        if (PyObject_GetBuffer(attr, &views[a], PyBUF_RECORDS_RO) < 0) goto done;
+        num_views++;
+        if (strcmp(views[a].format, "f") != 0) {
+            PyErr_Format(PyExc_ValueError, "Layout code '%c' needs float32 data, mesh has format '%s'",
+                         codes[a], views[a].format);
+            goto done;
+        }
+        if (views[a].ndim != 2 || views[a].shape[0] != self->num_vertices || views[a].shape[1] < counts[a]) {
+            PyErr_Format(PyExc_ValueError, "Layout code '%c' asks for %zd components, mesh has %zd",
+                         codes[a], counts[a], views[a].ndim == 2 ? views[a].shape[1] : 0);
+            goto done;
+        }
+    }
+
+    size_t num_vertices = self->num_vertices;
+    void *packed = malloc(num_vertices * components * itemsize + 1);
+    if (!packed) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    // Single pass over the vertices, writing each output row once
+    Py_BEGIN_ALLOW_THREADS
+    for (size_t v = 0; v < num_vertices; ++v) {
+        float *dst = (float *)packed + v * components;
+        uint16_t *dst_half = (uint16_t *)packed + v * components;
+        for (int a = 0; a < num_attributes; ++a) {
+            const float *src = (const float *)((const char *)views[a].buf + v * views[a].strides[0]);
+            if (half) {
+                for (Py_ssize_t k = 0; k < counts[a]; ++k) {
+                    *dst_half++ = float_to_half(src[k]);
+                }
+            } else {
+                for (Py_ssize_t k = 0; k < counts[a]; ++k) {
+                    *dst++ = src[k];
+                }
+            }
+        }
+    }
+    Py_END_ALLOW_THREADS
+
+    PyObject *buffer = create_memoryview(packed, num_vertices, components, 0, half ? "e" : "f", itemsize, NULL);
+    PyObject *py_offsets = PyDict_New();
+    if (!buffer || !py_offsets) {
+        Py_XDECREF(buffer);
+        Py_XDECREF(py_offsets);
+        goto done;
+    }
+    for (int a = 0; a < num_attributes; ++a) {
+        char key[2] = {codes[a], '\0'};
+        PyObject *offset = PyLong_FromSsize_t(offsets[a]);
+        if (!offset || PyDict_SetItemString(py_offsets, key, offset) < 0) {
+            Py_XDECREF(offset);
+            Py_DECREF(buffer);
+            Py_DECREF(py_offsets);
+            goto done;
+        }
+        Py_DECREF(offset);
+    }
+    result = Py_BuildValue("(NnN)", buffer, components * itemsize, py_offsets);
+
+done:
+    for (int a = 0; a < num_views; ++a) {
+        PyBuffer_Release(&views[a]);
+    }
+    return result;
+}
+
+static PyMethodDef Mesh_methods[] = {
+    {"interleaved", (PyCFunction)(void(*)(void))Mesh_interleaved, METH_VARARGS | METH_KEYWORDS, Mesh_interleaved_doc},
     {NULL} /* Sentinel */
 };
 
@@ -207,6 +497,354 @@ static PyTypeObject MeshType = {
     .tp_init = (initproc)Mesh_init,
     .tp_dealloc = (destructor)Mesh_dealloc,
     .tp_members = Mesh_members,
+    .tp_methods = Mesh_methods,
+};
+
+
+// --- Material Type Definition ---
+// Typed view of an aiMaterial, used instead of a property dictionary when
+// importing with typed_materials=True. The common PBR and Phong parameters
+// are decoded into fixed slots when the Material is created. The full
+// property dictionary and the texture slots are only built on first access,
+// from the aiMaterial of the retained scene.
+enum { MC_BASE_COLOR, MC_DIFFUSE, MC_SPECULAR, MC_EMISSIVE, NUM_MATERIAL_COLORS };
+enum { MS_METALLIC, MS_ROUGHNESS, MS_OPACITY, MS_SHININESS, NUM_MATERIAL_SCALARS };
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *owner;                        // Capsule retaining the aiScene of c_material
+    struct aiMaterial *c_material;
+    PyObject *name;                         // str, or None if the material has no name
+    PyObject *properties;                   // Property dictionary, NULL until accessed
+    PyObject *textures;                     // Tuple of TextureSlot, NULL until accessed
+    float colors[NUM_MATERIAL_COLORS][4];   // RGBA, NaN if missing
+    float scalars[NUM_MATERIAL_SCALARS];    // NaN if missing
+    int two_sided;                          // 0 or 1, -1 if missing
+    int shading_model;                      // aiShadingMode, -1 if missing
+} Material;
+
+// Defined with the scene processing logic
+static PyObject* process_material(struct aiMaterial *mat);
+static PyObject* process_texture_slots(const struct aiMaterial *mat);
+
+static void Material_dealloc(Material *self) {
+    Py_CLEAR(self->owner);
+    Py_CLEAR(self->name);
+    Py_CLEAR(self->properties);
+    Py_CLEAR(self->textures);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject* Material_get_color(Material *self, void *closure) {
+    const float *rgba = self->colors[(intptr_t)closure];
+    if (isnan(rgba[0])) Py_RETURN_NONE;
+    return Py_BuildValue("(ffff)", rgba[0], rgba[1], rgba[2], rgba[3]);
+}
+
+static PyObject* Material_get_scalar(Material *self, void *closure) {
+    float value = self->scalars[(intptr_t)closure];
+    if (isnan(value)) Py_RETURN_NONE;
+    return PyFloat_FromDouble(value);
+}
+
+static PyObject* Material_get_two_sided(Material *self, void *closure) {
+    if (self->two_sided < 0) Py_RETURN_NONE;
+    return PyBool_FromLong(self->two_sided);
+}
+
+static PyObject* Material_get_shading_model(Material *self, void *closure) {
+    if (self->shading_model < 0) Py_RETURN_NONE;
+    return PyLong_FromLong(self->shading_model);
+}
+
+static PyObject* Material_get_properties(Material *self, void *closure) {
+    if (!self->properties) {
+        self->properties = process_material(self->c_material);
+        if (!self->properties) return NULL;
+    }
+    Py_INCREF(self->properties);
+    return self->properties;
+}
+
+static PyObject* Material_get_textures(Material *self, void *closure) {
+    if (!self->textures) {
+        self->textures = process_texture_slots(self->c_material);
+        if (!self->textures) return NULL;
+    }
+    Py_INCREF(self->textures);
+    return self->textures;
+}
+
+static PyObject* Material_repr(Material *self) {
+    return PyUnicode_FromFormat("<Material %R>", self->name);
+}
+
+static PyMemberDef Material_members[] = {
+    {"name", T_OBJECT_EX, offsetof(Material, name), READONLY, "Material name, or None"},
+    {NULL} /* Sentinel */
+};
+
+static PyGetSetDef Material_getset[] = {
+    {"base_color", (getter)Material_get_color, NULL, "PBR base color (r, g, b, a), or None", (void *)MC_BASE_COLOR},
+    {"diffuse", (getter)Material_get_color, NULL, "Diffuse color (r, g, b, a), or None", (void *)MC_DIFFUSE},
+    {"specular", (getter)Material_get_color, NULL, "Specular color (r, g, b, a), or None", (void *)MC_SPECULAR},
+    {"emissive", (getter)Material_get_color, NULL, "Emissive color (r, g, b, a), or None", (void *)MC_EMISSIVE},
+    {"metallic", (getter)Material_get_scalar, NULL, "PBR metallic factor, or None", (void *)MS_METALLIC},
+    {"roughness", (getter)Material_get_scalar, NULL, "PBR roughness factor, or None", (void *)MS_ROUGHNESS},
+    {"opacity", (getter)Material_get_scalar, NULL, "Opacity, or None", (void *)MS_OPACITY},
+    {"shininess", (getter)Material_get_scalar, NULL, "Phong shininess exponent, or None", (void *)MS_SHININESS},
+    {"two_sided", (getter)Material_get_two_sided, NULL, "Whether back faces are rendered, or None", NULL},
+    {"shading_model", (getter)Material_get_shading_model, NULL, "aiShadingMode value, or None", NULL},
+    {"properties", (getter)Material_get_properties, NULL, "All properties, as the dictionary of untyped imports (built on first access)", NULL},
+    {"textures", (getter)Material_get_textures, NULL, "Tuple of TextureSlot ordered by type and index (built on first access)", NULL},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject MaterialType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "assimp_py.Material",
+    .tp_doc = "Material with typed access to its common parameters and texture slots",
+    .tp_basicsize = sizeof(Material),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)Material_dealloc,
+    .tp_repr = (reprfunc)Material_repr,
+    .tp_members = Material_members,
+    .tp_getset = Material_getset,
+};
+
+static PyStructSequence_Field TextureSlot_fields[] = {
+    {"type", "aiTextureType of the texture"},
+    {"index", "Index of the texture among those of its type"},
+    {"path", "Texture path ('*N' for embedded textures), or None"},
+    {"uv_index", "Texture coordinate set the texture is mapped with"},
+    {"mapping", "aiTextureMapping generating the texture coordinates"},
+    {"blend", "Blend factor, or None"},
+    {"op", "aiTextureOp combining the texture with the previous one, or None"},
+    {"map_mode", "(u, v) aiTextureMapMode wrapping, or None"},
+    {NULL}
+};
+
+static PyStructSequence_Desc TextureSlot_desc = {
+    .name = "assimp_py.TextureSlot",
+    .doc = "Texture slot of a Material",
+    .fields = TextureSlot_fields,
+    .n_in_sequence = 8,
+};
+
+
+// --- Texture Type Definition ---
+// Image embedded in the model file (aiScene::mTextures), referenced from
+// materials as "*N". The data view points straight at the aiTexture pixels.
+typedef struct {
+    PyObject_HEAD
+    PyObject *data;         // PyMemoryView (uint8): compressed file bytes, or (height, width, 4) BGRA texels
+    PyObject *format_hint;  // str: file extension ("png", "jpg", ...) or texel layout ("rgba8888", ...)
+    PyObject *filename;     // str: original file name, or None
+    unsigned int width;     // Width in texels, or the size in bytes of compressed data
+    unsigned int height;    // Height in texels, 0 for compressed data
+} Texture;
+
+static void Texture_dealloc(Texture *self) {
+    Py_CLEAR(self->data);
+    Py_CLEAR(self->format_hint);
+    Py_CLEAR(self->filename);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyMemberDef Texture_members[] = {
+    {"data", T_OBJECT_EX, offsetof(Texture, data), READONLY, "Texture data (memoryview, uint8): the compressed file when height is 0, else (height, width, 4) BGRA8 texels"},
+    {"format_hint", T_OBJECT_EX, offsetof(Texture, format_hint), READONLY, "File extension of compressed data (e.g. 'png'), or texel layout (e.g. 'rgba8888')"},
+    {"filename", T_OBJECT_EX, offsetof(Texture, filename), READONLY, "Original file name of the texture, or None"},
+    {"width", T_UINT, offsetof(Texture, width), READONLY, "Width in texels, or size in bytes of compressed data"},
+    {"height", T_UINT, offsetof(Texture, height), READONLY, "Height in texels, 0 for compressed data"},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject TextureType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "assimp_py.Texture",
+    .tp_doc = "Texture embedded in the model file",
+    .tp_basicsize = sizeof(Texture),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)Texture_dealloc,
+    .tp_members = Texture_members,
+};
+
+
+// --- Animation Type Definition ---
+// Keyframe animation (aiAnimation). The keys of every channel are unpacked
+// into contiguous time (float64) and value (float32) arrays, all in one block
+// owned by the `keys` capsule that the channel memoryviews borrow from.
+typedef struct {
+    PyObject_HEAD
+    PyObject *name;             // PyUnicodeObject
+    PyObject *channels;         // Tuple of AnimationChannel, one per animated node
+    PyObject *morph_channels;   // Tuple of MorphChannel, one per morphed mesh
+    PyObject *keys;             // Capsule owning the key arrays
+    AnimTrack *tracks;          // Per channel, pointing into the key arrays
+    double duration;            // In ticks
+    double ticks_per_second;    // 0 if the file does not say
+} Animation;
+
+static void Animation_dealloc(Animation *self) {
+    Py_CLEAR(self->name);
+    Py_CLEAR(self->channels);
+    Py_CLEAR(self->morph_channels);
+    Py_CLEAR(self->keys);
+    PyMem_Free(self->tracks);
+    self->tracks = NULL;
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+PyDoc_STRVAR(Animation_resample_doc,
+"resample(fps: float, nodes: Sequence[str] | None = None) -> memoryview\n"
+"--\n\n"
+"Bakes the node channels at a fixed frame rate, from time 0 to the end of\n"
+"the animation, into one (frames, nodes, 10) float32 array holding the\n"
+"position (x, y, z), rotation (w, x, y, z) and scaling (x, y, z) of each\n"
+"node. Positions and scalings are interpolated linearly and rotations\n"
+"spherically, unless the keys use step interpolation. Times outside the\n"
+"keys hold the first or last key. Files without ticks_per_second are\n"
+"sampled at 25 ticks per second.\n\n"
+"Args:\n"
+"    fps: Frames per second.\n"
+"    nodes: Node names giving the order of the nodes axis. Defaults to the\n"
+"           nodes of the channels, in channel order. Nodes without a\n"
+"           channel get the identity transform.");
+
+static PyObject* Animation_resample(Animation *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"fps", "nodes", NULL};
+    double fps;
+    PyObject *nodes = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "d|O:resample", kwlist, &fps, &nodes)) {
+        return NULL;
+    }
+    if (!(fps > 0.0) || isinf(fps)) {
+        PyErr_SetString(PyExc_ValueError, "fps must be positive");
+        return NULL;
+    }
+
+    Py_ssize_t num_channels = PyTuple_GET_SIZE(self->channels);
+    PyObject *names = NULL;
+    Py_ssize_t num_nodes = num_channels;
+    if (nodes != Py_None) {
+        names = PySequence_Fast(nodes, "nodes must be a sequence of node names");
+        if (!names) return NULL;
+        num_nodes = PySequence_Fast_GET_SIZE(names);
+    }
+
+    double ticks_per_second = self->ticks_per_second > 0.0 ? self->ticks_per_second : 25.0;
+    double duration = self->duration > 0.0 ? self->duration : 0.0;
+    double frames = floor(duration / ticks_per_second * fps + 1e-9) + 1.0;
+    if (frames * (double)(num_nodes ? num_nodes : 1) * ANIM_FRAME_COMPONENTS * sizeof(float) > (double)PY_SSIZE_T_MAX) {
+        Py_XDECREF(names);
+        return PyErr_NoMemory();
+    }
+    size_t num_frames = (size_t)frames;
+
+    const AnimTrack **order = (const AnimTrack **)PyMem_Malloc((num_nodes ? num_nodes : 1) * sizeof(AnimTrack *));
+    if (!order) {
+        Py_XDECREF(names);
+        return PyErr_NoMemory();
+    }
+    for (Py_ssize_t n = 0; n < num_nodes; ++n) {
+        if (!names) {
+            order[n] = &self->tracks[n];
+            continue;
+        }
+        order[n] = NULL;
+        for (Py_ssize_t c = 0; c < num_channels; ++c) {
+            PyObject *channel_name = PyStructSequence_GET_ITEM(PyTuple_GET_ITEM(self->channels, c), 0);
+            int equal = PyObject_RichCompareBool(PySequence_Fast_GET_ITEM(names, n), channel_name, Py_EQ);
+            if (equal < 0) {
+                PyMem_Free(order);
+                Py_DECREF(names);
+                return NULL;
+            }
+            if (equal) {
+                order[n] = &self->tracks[c];
+                break;
+            }
+        }
+    }
+    Py_XDECREF(names);
+
+    size_t out_size = num_frames * num_nodes * ANIM_FRAME_COMPONENTS * sizeof(float);
+    float *out = (float *)malloc(out_size ? out_size : 1);
+    if (!out) {
+        PyMem_Free(order);
+        return PyErr_NoMemory();
+    }
+    Py_BEGIN_ALLOW_THREADS
+    resample_tracks(order, num_nodes, num_frames, ticks_per_second / fps, out);
+    Py_END_ALLOW_THREADS
+    PyMem_Free(order);
+
+    Py_ssize_t shape[3] = {(Py_ssize_t)num_frames, num_nodes, ANIM_FRAME_COMPONENTS};
+    return buffer_memoryview(out, 3, shape, NULL, "f", sizeof(float), NULL);
+}
+
+static PyMethodDef Animation_methods[] = {
+    {"resample", (PyCFunction)(void(*)(void))Animation_resample, METH_VARARGS | METH_KEYWORDS, Animation_resample_doc},
+    {NULL} /* Sentinel */
+};
+
+static PyMemberDef Animation_members[] = {
+    {"name", T_OBJECT_EX, offsetof(Animation, name), READONLY, "Animation name"},
+    {"channels", T_OBJECT_EX, offsetof(Animation, channels), READONLY, "Tuple of AnimationChannel, one per animated node"},
+    {"morph_channels", T_OBJECT_EX, offsetof(Animation, morph_channels), READONLY, "Tuple of MorphChannel, one per morphed mesh"},
+    {"duration", T_DOUBLE, offsetof(Animation, duration), READONLY, "Duration in ticks"},
+    {"ticks_per_second", T_DOUBLE, offsetof(Animation, ticks_per_second), READONLY, "Ticks per second, 0 if not specified in the file"},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject AnimationType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "assimp_py.Animation",
+    .tp_doc = "Keyframe animation of nodes and morph targets",
+    .tp_basicsize = sizeof(Animation),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)Animation_dealloc,
+    .tp_members = Animation_members,
+    .tp_methods = Animation_methods,
+};
+
+static PyStructSequence_Field AnimationChannel_fields[] = {
+    {"node_name", "Name of the animated node"},
+    {"position_times", "Position key times in ticks (memoryview, float64)"},
+    {"positions", "Position keys (memoryview, float32 x 3)"},
+    {"rotation_times", "Rotation key times in ticks (memoryview, float64)"},
+    {"rotations", "Rotation keys as w, x, y, z quaternions (memoryview, float32 x 4)"},
+    {"scaling_times", "Scaling key times in ticks (memoryview, float64)"},
+    {"scalings", "Scaling keys (memoryview, float32 x 3)"},
+    {"pre_state", "aiAnimBehaviour before the first key"},
+    {"post_state", "aiAnimBehaviour after the last key"},
+    {NULL}
+};
+
+static PyStructSequence_Desc AnimationChannel_desc = {
+    .name = "assimp_py.AnimationChannel",
+    .doc = "Keys of one animated node",
+    .fields = AnimationChannel_fields,
+    .n_in_sequence = 9,
+};
+
+static PyStructSequence_Field MorphChannel_fields[] = {
+    {"name", "Name of the morphed mesh"},
+    {"times", "Key times in ticks (memoryview, float64)"},
+    {"targets", "Morph target indices per key, 0 padded (memoryview, uint32, keys x max targets)"},
+    {"weights", "Morph target weights per key, 0 padded (memoryview, float32, keys x max targets)"},
+    {NULL}
+};
+
+static PyStructSequence_Desc MorphChannel_desc = {
+    .name = "assimp_py.MorphChannel",
+    .doc = "Morph target weight keys of one mesh",
+    .fields = MorphChannel_fields,
+    .n_in_sequence = 4,
 };
 
 
@@ -214,34 +852,213 @@ static PyTypeObject MeshType = {
 typedef struct {
     PyObject_HEAD
     PyObject *meshes;     // List of Mesh objects
-    PyObject *materials;  // List of Material dictionaries
-    PyObject *root_node;
+    PyObject *materials;  // List of material dictionaries, or of Material objects (typed_materials)
+    PyObject *textures;   // List of embedded Texture objects
+    PyObject *animations; // List (or lazy sequence) of Animation objects
+    PyObject *root_node;  // Node tree, None with node_table
+    PyObject *node_table; // Dictionary of flat node arrays with node_table, else None
+    PyObject *import_stats; // Dictionary of timings and memory with stats, else None
+    PyObject *c_scene;    // Capsule owning the aiScene when it is retained (zero_copy, lazy, typed_materials, retain_scene), else NULL
     unsigned int num_meshes;
     unsigned int num_materials;
+    unsigned int num_textures;
+    unsigned int num_animations;
 } Scene;
 
 static int Scene_init(Scene *self, PyObject *args, PyObject *kwds) {
     self->meshes = NULL;
     self->materials = NULL;
+    self->textures = NULL;
+    self->animations = NULL;
     self->root_node = NULL;
+    self->node_table = NULL;
+    self->c_scene = NULL;
     self->num_meshes = 0;
     self->num_materials = 0;
+    self->num_textures = 0;
+    self->num_animations = 0;
     return 0;
 }
 
 static void Scene_dealloc(Scene *self) {
     Py_CLEAR(self->meshes);
     Py_CLEAR(self->materials);
+    Py_CLEAR(self->textures);
+    Py_CLEAR(self->animations);
     Py_CLEAR(self->root_node);
+    Py_CLEAR(self->node_table);
+    Py_CLEAR(self->import_stats);
+    Py_CLEAR(self->c_scene);
     Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
+PyDoc_STRVAR(Scene_material_table_doc,
+"material_table() -> dict[str, list | memoryview]\n"
+"--\n\n"
+"Gathers the typed parameters of all materials into columns, one row per\n"
+"material, for bulk upload or numpy processing. Needs an import with\n"
+"typed_materials=True.\n\n"
+"Returns:\n"
+"    A dictionary with 'name' (list of str or None), 'base_color',\n"
+"    'diffuse', 'specular' and 'emissive' ((N, 4) float32, NaN rows where\n"
+"    missing), 'metallic', 'roughness', 'opacity' and 'shininess' ((N,)\n"
+"    float32, NaN where missing), 'two_sided' and 'shading_model' ((N,)\n"
+"    int32, -1 where missing).");
+
+static PyObject* Scene_material_table(Scene *self, PyObject *Py_UNUSED(ignored)) {
+    static const char *color_names[NUM_MATERIAL_COLORS] = {"base_color", "diffuse", "specular", "emissive"};
+    static const char *scalar_names[NUM_MATERIAL_SCALARS] = {"metallic", "roughness", "opacity", "shininess"};
+    float *colors[NUM_MATERIAL_COLORS] = {NULL};
+    float *scalars[NUM_MATERIAL_SCALARS] = {NULL};
+    int32_t *two_sided = NULL;
+    int32_t *shading_model = NULL;
+    PyObject *names = NULL;
+    PyObject *table = NULL;
+
+    if (!self->materials) {
+        PyErr_SetString(PyExc_TypeError, "material_table() needs an imported scene");
+        return NULL;
+    }
+    PyObject *materials = PySequence_Fast(self->materials, "Scene.materials is not a sequence");
+    if (!materials) return NULL;
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(materials);
+    for (Py_ssize_t i = 0; i < n; ++i) {
+        if (!PyObject_TypeCheck(PySequence_Fast_GET_ITEM(materials, i), &MaterialType)) {
+            PyErr_SetString(PyExc_TypeError, "material_table() needs Material objects, import with typed_materials=True");
+            goto fail;
+        }
+    }
+
+    size_t rows = n ? (size_t)n : 1;
+    int ok = 1;
+    for (int c = 0; c < NUM_MATERIAL_COLORS; ++c) ok &= (colors[c] = (float *)malloc(rows * 4 * sizeof(float))) != NULL;
+    for (int k = 0; k < NUM_MATERIAL_SCALARS; ++k) ok &= (scalars[k] = (float *)malloc(rows * sizeof(float))) != NULL;
+    ok &= (two_sided = (int32_t *)malloc(rows * sizeof(int32_t))) != NULL;
+    ok &= (shading_model = (int32_t *)malloc(rows * sizeof(int32_t))) != NULL;
+    if (!ok) {
+        PyErr_NoMemory();
+        goto fail;
+    }
+    names = PyList_New(n);
+    table = PyDict_New();
+    if (!names || !table) goto fail;
+
+    for (Py_ssize_t i = 0; i < n; ++i) {
+        Material *mat = (Material *)PySequence_Fast_GET_ITEM(materials, i);
+        Py_INCREF(mat->name);
+        PyList_SET_ITEM(names, i, mat->name);
+        for (int c = 0; c < NUM_MATERIAL_COLORS; ++c) memcpy(colors[c] + 4 * i, mat->colors[c], 4 * sizeof(float));
+        for (int k = 0; k < NUM_MATERIAL_SCALARS; ++k) scalars[k][i] = mat->scalars[k];
+        two_sided[i] = mat->two_sided;
+        shading_model[i] = mat->shading_model;
+    }
+
+    if (PyDict_SetItemString(table, "name", names) < 0) goto fail;
+    // Each array is handed to its memoryview (which frees it, also on error) before the next is
+    PyObject *column;
+    for (int c = 0; c < NUM_MATERIAL_COLORS; ++c) {
+        column = create_memoryview(colors[c], n, 4, 0, "f", sizeof(float), NULL);
+        colors[c] = NULL;
+        if (!column || PyDict_SetItemString(table, color_names[c], column) < 0) goto fail_column;
+        Py_DECREF(column);
+    }
+    for (int k = 0; k < NUM_MATERIAL_SCALARS; ++k) {
+        column = create_memoryview(scalars[k], n, 0, 0, "f", sizeof(float), NULL);
+        scalars[k] = NULL;
+        if (!column || PyDict_SetItemString(table, scalar_names[k], column) < 0) goto fail_column;
+        Py_DECREF(column);
+    }
+    column = create_memoryview(two_sided, n, 0, 0, "i", sizeof(int32_t), NULL);
+    two_sided = NULL;
+    if (!column || PyDict_SetItemString(table, "two_sided", column) < 0) goto fail_column;
+    Py_DECREF(column);
+    column = create_memoryview(shading_model, n, 0, 0, "i", sizeof(int32_t), NULL);
+    shading_model = NULL;
+    if (!column || PyDict_SetItemString(table, "shading_model", column) < 0) goto fail_column;
+    Py_DECREF(column);
+
+    Py_DECREF(names);
+    Py_DECREF(materials);
+    return table;
+
+fail_column:
+    Py_XDECREF(column);
+fail:
+    for (int c = 0; c < NUM_MATERIAL_COLORS; ++c) free(colors[c]);
+    for (int k = 0; k < NUM_MATERIAL_SCALARS; ++k) free(scalars[k]);
+    free(two_sided);
+    free(shading_model);
+    Py_XDECREF(names);
+    Py_XDECREF(table);
+    Py_DECREF(materials);
+    return NULL;
+}
+
+PyDoc_STRVAR(Scene_embedded_texture_doc,
+"embedded_texture(path: str) -> Texture | None\n"
+"--\n\n"
+"Resolves a material texture path to the embedded texture it refers to, as\n"
+"aiScene::GetEmbeddedTexture does: '*N' is textures[N], other paths match\n"
+"the file name of an embedded texture. Returns None for external files.");
+
+// File name part of a path
+static const char* short_filename(const char *path) {
+    const char *slash = strrchr(path, '/');
+    const char *backslash = strrchr(path, '\\');
+    if (backslash > slash) slash = backslash;
+    return slash ? slash + 1 : path;
+}
+
+static PyObject* Scene_embedded_texture(Scene *self, PyObject *arg) {
+    if (!PyUnicode_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "path must be a str");
+        return NULL;
+    }
+    const char *path = PyUnicode_AsUTF8(arg);
+    if (!path) return NULL;
+    if (!self->textures) Py_RETURN_NONE;
+
+    Py_ssize_t num_textures = PyList_GET_SIZE(self->textures);
+    if (path[0] == '*') {
+        long index = strtol(path + 1, NULL, 10);
+        if (index < 0 || index >= num_textures) Py_RETURN_NONE;
+        PyObject *texture = PyList_GET_ITEM(self->textures, index);
+        Py_INCREF(texture);
+        return texture;
+    }
+
+    const char *name = short_filename(path);
+    for (Py_ssize_t i = 0; i < num_textures; ++i) {
+        Texture *texture = (Texture *)PyList_GET_ITEM(self->textures, i);
+        if (texture->filename == Py_None) continue;
+        const char *texture_name = PyUnicode_AsUTF8(texture->filename);
+        if (!texture_name) return NULL;
+        if (strcmp(short_filename(texture_name), name) == 0) {
+            Py_INCREF(texture);
+            return (PyObject *)texture;
+        }
+    }
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef Scene_methods[] = {
+    {"embedded_texture", (PyCFunction)Scene_embedded_texture, METH_O, Scene_embedded_texture_doc},
+    {"material_table", (PyCFunction)Scene_material_table, METH_NOARGS, Scene_material_table_doc},
+    {NULL} /* Sentinel */
+};
+
 static PyMemberDef Scene_members[] = {
-    {"meshes", T_OBJECT_EX, offsetof(Scene, meshes), READONLY, "List of meshes in the scene"},
-    {"materials", T_OBJECT_EX, offsetof(Scene, materials), READONLY, "List of materials (dictionaries) in the scene"},
-    {"root_node", T_OBJECT_EX, offsetof(Scene, root_node), READONLY, "Root node of the scene hierarchy"},
+    {"meshes", T_OBJECT_EX, offsetof(Scene, meshes), READONLY, "List (or lazy sequence) of meshes in the scene"},
+    {"materials", T_OBJECT_EX, offsetof(Scene, materials), READONLY, "List (or lazy sequence) of materials (dictionaries, or Material objects with typed_materials) in the scene"},
+    {"textures", T_OBJECT_EX, offsetof(Scene, textures), READONLY, "List of textures embedded in the file, referenced from materials as '*N'"},
+    {"animations", T_OBJECT_EX, offsetof(Scene, animations), READONLY, "List (or lazy sequence) of animations in the scene"},
+    {"root_node", T_OBJECT_EX, offsetof(Scene, root_node), READONLY, "Root node of the scene hierarchy (None with node_table=True)"},
+    {"node_table", T_OBJECT_EX, offsetof(Scene, node_table), READONLY, "Flat node hierarchy arrays with node_table=True, else None"},
+    {"import_stats", T_OBJECT_EX, offsetof(Scene, import_stats), READONLY, "Import timings and memory with stats=True, else None"},
     {"num_meshes", T_UINT, offsetof(Scene, num_meshes), READONLY, "Number of meshes"},
     {"num_materials", T_UINT, offsetof(Scene, num_materials), READONLY, "Number of materials"},
+    {"num_textures", T_UINT, offsetof(Scene, num_textures), READONLY, "Number of embedded textures"},
+    {"num_animations", T_UINT, offsetof(Scene, num_animations), READONLY, "Number of animations"},
     {NULL} /* Sentinel */
 };
 
@@ -256,222 +1073,259 @@ static PyTypeObject SceneType = {
     .tp_init = (initproc)Scene_init,
     .tp_dealloc = (destructor)Scene_dealloc,
     .tp_members = Scene_members,
+    .tp_methods = Scene_methods,
 };
 
 
-// --- Helper Functions ---
+// --- Conversion Options ---
+// Keyword-only options shared by import_file, import_files and import_bytes
+// that control how an aiScene is converted into Python objects.
+typedef enum {
+    FORMAT_F32 = 0,
+    FORMAT_F16,
+    FORMAT_SNORM16,
+} AttributeFormat;
 
-// Safely create a memory view from a C array. Returns new reference or NULL on error.
-static PyObject* create_memoryview(void* data, Py_ssize_t len_bytes, const char* format, Py_ssize_t itemsize) {
-    if (!data) {
-        Py_RETURN_NONE; // Return None if the C data pointer is NULL
+typedef struct {
+    int zero_copy;              // Borrow float32 attributes from the retained aiScene
+    int compact_indices;        // uint16 indices when every index fits
+    AttributeFormat normals;    // Format of normals, tangents and bitangents
+    AttributeFormat texcoords;  // Format of texture coordinates (f32 or f16)
+    int quantize_positions;     // uint16 positions with a per-mesh scale/offset
+    int lazy;                   // Convert meshes and materials on first access
+    int polygons;               // Keep non-triangle faces, as CSR face_offsets + indices
+    int typed_materials;        // Material objects instead of property dictionaries
+    int node_table;             // Flat node arrays (Scene.node_table) instead of the Node tree
+    int stats;                  // Time the import stages into Scene.import_stats
+    int retain_scene;           // Keep the aiScene alive for export
+    Py_ssize_t *allocated;      // Adds up the bytes of the arrays converted meshes allocate, may be NULL
+} ConvertOptions;
+
+// Parses a format option value. Returns -1 with ValueError set if it is not
+// one of the first `num_allowed` formats.
+static int parse_attribute_format(PyObject *value, const char *option, int num_allowed, AttributeFormat *format) {
+    static const char *names[] = {"f32", "f16", "snorm16"};
+    const char *name = PyUnicode_Check(value) ? PyUnicode_AsUTF8(value) : NULL;
+    if (name) {
+        for (int i = 0; i < num_allowed; ++i) {
+            if (strcmp(name, names[i]) == 0) {
+                *format = (AttributeFormat)i;
+                return 0;
+            }
+        }
+    } else if (PyErr_Occurred()) {
+        return -1;
     }
-    if (itemsize <= 0) {
-         PyErr_SetString(PyExc_ValueError, "itemsize must be positive");
-         return NULL;
+    PyErr_Format(PyExc_ValueError, "Invalid %s format %R", option, value);
+    return -1;
+}
+
+// Removes the conversion options from `kwds` into `opts`. `*rest` receives a
+// NEW reference to the remaining keywords (or NULL if there were none), to be
+// parsed by the caller as usual. Returns -1 on error.
+static int parse_convert_options(PyObject *kwds, ConvertOptions *opts, PyObject **rest) {
+    memset(opts, 0, sizeof(*opts));
+    *rest = NULL;
+    if (!kwds) return 0;
+
+    PyObject *remaining = PyDict_Copy(kwds);
+    if (!remaining) return -1;
+
+    static const char *bool_names[] = {"zero_copy", "compact_indices", "quantize_positions", "lazy", "polygons", "typed_materials",
+                                       "node_table", "stats", "retain_scene"};
+    int *bool_values[] = {&opts->zero_copy, &opts->compact_indices, &opts->quantize_positions, &opts->lazy, &opts->polygons,
+                          &opts->typed_materials, &opts->node_table, &opts->stats, &opts->retain_scene};
+    for (int i = 0; i < (int)(sizeof(bool_names) / sizeof(bool_names[0])); ++i) {
+        PyObject *value = PyDict_GetItemString(remaining, bool_names[i]); // Borrowed
+        if (!value) continue;
+        *bool_values[i] = PyObject_IsTrue(value);
+        if (*bool_values[i] < 0 || PyDict_DelItemString(remaining, bool_names[i]) < 0) goto fail;
     }
-    if (len_bytes < 0) {
-        PyErr_SetString(PyExc_ValueError, "len_bytes cannot be negative");
-        return NULL;
+
+    PyObject *value = PyDict_GetItemString(remaining, "normals");
+    if (value) {
+        if (parse_attribute_format(value, "normals", 3, &opts->normals) < 0) goto fail;
+        if (PyDict_DelItemString(remaining, "normals") < 0) goto fail;
     }
-    // Check if len_bytes is divisible by itemsize
-    if (len_bytes % itemsize != 0) {
-        PyErr_Format(PyExc_ValueError, "Buffer length (%zd) is not a multiple of itemsize (%zd)", len_bytes, itemsize);
-        return NULL;
+    value = PyDict_GetItemString(remaining, "texcoords");
+    if (value) {
+        if (parse_attribute_format(value, "texcoords", 2, &opts->texcoords) < 0) goto fail;
+        if (PyDict_DelItemString(remaining, "texcoords") < 0) goto fail;
     }
 
-    Py_ssize_t num_elements = len_bytes / itemsize;
+    *rest = remaining;
+    return 0;
 
-    Py_buffer buf_info;
-    // Allocate shape and strides arrays (needed by PyMemoryView_FromBuffer)
-    // For 1D array, we only need arrays of size 1
-    Py_ssize_t shape[1] = { num_elements };
-    Py_ssize_t strides[1] = { itemsize }; // Simple stride for contiguous data
+fail:
+    Py_DECREF(remaining);
+    return -1;
+}
 
-    // Manually initialize the Py_buffer struct
-    // Start by zeroing it out
-    memset(&buf_info, 0, sizeof(Py_buffer));
 
-    buf_info.buf = data;              // Pointer to the data buffer
-    buf_info.obj = NULL;              // We own the memory (malloc'd), no base Python object
-    buf_info.len = len_bytes;         // Total length in bytes
-    buf_info.itemsize = itemsize;     // Size of one item
-    buf_info.readonly = 1;            // Make it read-only
-    buf_info.ndim = 1;                // Number of dimensions
-    buf_info.format = (char*)format;  // Format string (cast needed)
-    buf_info.shape = shape;           // Pointer to shape array {num_elements}
-    buf_info.strides = strides;       // Pointer to strides array {itemsize}
-    buf_info.suboffsets = NULL;       // Not needed for simple buffers
-    buf_info.internal = NULL;         // Reserved
+// --- Helper Functions ---
 
-    // Create the memoryview from the manually populated buffer structure
-    PyObject *memview = PyMemoryView_FromBuffer(&buf_info);
-    if (!memview) {
-        // Error should be set by PyMemoryView_FromBuffer
+// Create a memoryview of `ndim` dimensions over `data` with the given shape and
+// byte strides (NULL means packed, C order). Returns new reference or NULL on error.
+// The view is backed by a Buffer exporter: if `owner` is NULL the Buffer takes
+// ownership of the malloc'd `data` (also on error), otherwise it keeps a
+// reference to `owner`, which must keep `data` alive.
+static PyObject* buffer_memoryview(void *data, int ndim, const Py_ssize_t *shape, const Py_ssize_t *strides,
+                                   const char *format, Py_ssize_t itemsize, PyObject *owner) {
+    if (!data) {
+        Py_RETURN_NONE; // Return None if the C data pointer is NULL
+    }
+    int valid = itemsize > 0 && ndim >= 1 && ndim <= BUFFER_MAX_NDIM;
+    for (int d = 0; valid && d < ndim; ++d) {
+        valid = shape[d] >= 0 && (!strides || strides[d] >= 0);
+    }
+    if (!valid) {
+        PyErr_Format(PyExc_ValueError, "Invalid buffer: %d dimensions, itemsize %zd", ndim, itemsize);
+        if (!owner) free(data);
         return NULL;
     }
 
-    // Note: PyMemoryView_FromBuffer creates the memoryview object.
-    // The 'buf_info' struct itself is used during creation but doesn't
-    // need to persist after the memoryview object exists, as the relevant
-    // info is copied or managed internally by the memoryview object.
-    // The shape and strides arrays declared on the stack are sufficient here.
+    Buffer *buffer = (Buffer *)BufferType.tp_alloc(&BufferType, 0);
+    if (!buffer) {
+        if (!owner) free(data);
+        return NULL;
+    }
+    Py_XINCREF(owner);
+    buffer->owner = owner;
+    buffer->data = data;
+    buffer->itemsize = itemsize;
+    buffer->format = format;
+    buffer->ndim = ndim;
+    buffer->len = itemsize;
+    for (int d = ndim - 1; d >= 0; --d) {
+        buffer->shape[d] = shape[d];
+        buffer->strides[d] = strides ? strides[d] : buffer->len;
+        buffer->len *= shape[d];
+    }
 
+    // The memoryview holds a reference to the Buffer for as long as it lives
+    PyObject *memview = PyMemoryView_FromObject((PyObject *)buffer);
+    Py_DECREF(buffer);
     return memview; // Return new reference
 }
 
-// Helper to create a Python list of floats from a C array of aiColor4D
-// Returns a new reference or NULL on error.
-static PyObject* list_from_color4d_array(const struct aiColor4D* colors, unsigned int count) {
-    PyObject* list = PyList_New(count);
-    if (!list) return NULL;
+// Safely create a memory view from a C array. Returns new reference or NULL on error.
+// With `ncomp` == 0 the view is 1-D with `num_items` items, else it is 2-D with
+// shape (num_items, ncomp) and rows `row_stride` bytes apart (0 means packed).
+// Ownership of `data` is as for buffer_memoryview.
+static PyObject* create_memoryview(void* data, Py_ssize_t num_items, Py_ssize_t ncomp, Py_ssize_t row_stride,
+                                   const char* format, Py_ssize_t itemsize, PyObject *owner) {
+    Py_ssize_t shape[2] = {num_items, ncomp};
+    Py_ssize_t strides[2] = {row_stride ? row_stride : ncomp * itemsize, itemsize};
+    if (ncomp == 0) {
+        return buffer_memoryview(data, 1, shape, NULL, format, itemsize, owner);
+    }
+    return buffer_memoryview(data, 2, shape, strides, format, itemsize, owner);
+}
 
-    for (unsigned int i = 0; i < count; ++i) {
-        PyObject* tuple = Py_BuildValue("ffff", colors[i].r, colors[i].g, colors[i].b, colors[i].a);
-        if (!tuple) {
-            Py_DECREF(list);
-            return NULL;
-        }
-        // PyList_SetItem steals the reference to tuple, no DECREF needed on success
-        if (PyList_SetItem(list, i, tuple) < 0) {
-             Py_DECREF(tuple);
-             Py_DECREF(list);
-             return NULL;
+// Bytes of the data a memoryview made by buffer_memoryview allocated for
+// itself, 0 if it views memory of another owner (or is None or a list of
+// such views)
+static Py_ssize_t allocated_bytes(PyObject *obj) {
+    if (PyList_Check(obj)) {
+        Py_ssize_t total = 0;
+        for (Py_ssize_t i = 0; i < PyList_GET_SIZE(obj); ++i) {
+            total += allocated_bytes(PyList_GET_ITEM(obj, i));
         }
+        return total;
     }
-    return list;
+    if (!PyMemoryView_Check(obj)) return 0;
+    PyObject *base = PyMemoryView_GET_BASE(obj);
+    if (!base || !PyObject_TypeCheck(base, &BufferType) || ((Buffer *)base)->owner) return 0;
+    return ((Buffer *)base)->len;
 }
 
-// Helper to get a material property value by iterating properties and using generic getters.
+// Create a (num_rows, ncomp) float32 memoryview over rows `src_stride` bytes
+// apart at `src`. Borrows the data when `owner` (the retained scene) is given,
+// else copies it into a packed array.
 // Returns new reference or NULL on error.
-static PyObject* get_material_property(struct aiMaterial *mat, const char *key, unsigned int type, unsigned int index) {
-    aiReturn ret = aiReturn_FAILURE;
-    PyObject *py_value = NULL;
-    const struct aiMaterialProperty* prop = NULL;
-
-    // 1. Find the specific property in the material's list
-    for (unsigned int i = 0; i < mat->mNumProperties; ++i) {
-        // Use .data for aiString comparison
-        if (strcmp(mat->mProperties[i]->mKey.data, key) == 0 &&
-            mat->mProperties[i]->mSemantic == type &&
-            mat->mProperties[i]->mIndex == index)
-        {
-            prop = mat->mProperties[i];
-            break;
+static PyObject* float_memoryview(const void *src, size_t num_rows, unsigned int ncomp, size_t src_stride, PyObject *owner) {
+    if (owner) {
+        return create_memoryview((void *)src, num_rows, ncomp, src_stride, "f", sizeof(float), owner);
+    }
+    size_t row_size = ncomp * sizeof(float);
+    size_t buffer_size = num_rows * row_size;
+    float *copy = (float *)malloc(buffer_size ? buffer_size : 1);
+    if (!copy) return PyErr_NoMemory();
+    if (src_stride == row_size) {
+        memcpy(copy, src, buffer_size);
+    } else {
+        // Repack, taking only the first ncomp components of each row
+        const char *row = (const char *)src;
+        for (size_t v = 0; v < num_rows; ++v, row += src_stride) {
+            memcpy(copy + v * ncomp, row, row_size);
         }
     }
+    return create_memoryview(copy, num_rows, ncomp, 0, "f", sizeof(float), NULL);
+}
 
-    // If the property wasn't found in the list, return None.
-    if (!prop) {
-        // fprintf(stderr, "DEBUG get_material_property: Property not found for key='%s', type=%u, index=%u\n", key, type, index);
-        Py_RETURN_NONE;
+// Like float_memoryview, but converts the rows to `format` first. Converted
+// attributes are always copies, only float32 ones can borrow from `owner`.
+// Returns new reference or NULL on error.
+static PyObject* attribute_memoryview(const void *src, size_t num_rows, unsigned int ncomp, size_t src_stride,
+                                      AttributeFormat format, PyObject *owner) {
+    if (format == FORMAT_F32) {
+        return float_memoryview(src, num_rows, ncomp, src_stride, owner);
     }
+    size_t buffer_size = num_rows * ncomp * sizeof(uint16_t);
+    void *converted = malloc(buffer_size ? buffer_size : 1);
+    if (!converted) return PyErr_NoMemory();
 
-    // --- Use Fixed-Size Buffers for Array Getters ---
-    float fval[16];       // Fixed buffer for floats
-    int ival[16];         // Fixed buffer for ints
-    struct aiString sval; // For strings
-    unsigned int arr_size; // Input: buffer capacity, Output: elements written
-
-
-    // 2. Process based on the found property's type (prop->mType)
-    switch (prop->mType) {
-        case aiPTI_String:
-            // Use aiGetMaterialString (it directly uses the underlying prop->mData)
-            ret = aiGetMaterialString(mat, key, type, index, &sval);
-            if (ret == aiReturn_SUCCESS) {
-                py_value = PyUnicode_FromString(sval.data); // Use .data
-                if (!py_value) { ret = aiReturn_FAILURE; } // Check PyUnicode creation
-            }
-            break; // End String case
+    Py_BEGIN_ALLOW_THREADS
+    if (format == FORMAT_F16) {
+        convert_to_f16((uint16_t *)converted, (const float *)src, num_rows, ncomp, src_stride);
+    } else {
+        convert_to_snorm16((int16_t *)converted, (const float *)src, num_rows, ncomp, src_stride);
+    }
+    Py_END_ALLOW_THREADS
+    return create_memoryview(converted, num_rows, ncomp, 0, format == FORMAT_F16 ? "e" : "h", sizeof(uint16_t), NULL);
+}
 
-        case aiPTI_Float:
-        case aiPTI_Buffer: // Treat buffer as float
-        case aiPTI_Double: // aiGetMaterialFloatArray handles double conversion internally
-             arr_size = 16; // Input: Our buffer capacity
-             // Call the generic Float Array getter
-             ret = aiGetMaterialFloatArray(mat, key, type, index, fval, &arr_size);
-             // fprintf(stderr, "DEBUG get_material_property (Float Fixed): key='%s', ret=%d, arr_size_written=%u\n", key, ret, arr_size);
-
-             if (ret == aiReturn_SUCCESS && arr_size > 0) { // Check success AND elements retrieved
-                 if (arr_size == 1) {
-                     py_value = PyFloat_FromDouble((double)fval[0]);
-                 } else {
-                     py_value = PyList_New(arr_size);
-                     if (py_value) {
-                         for (unsigned int i = 0; i < arr_size; ++i) {
-                             PyObject* f = PyFloat_FromDouble((double)fval[i]);
-                             if (!f) { Py_DECREF(py_value); py_value = NULL; break; }
-                             PyList_SET_ITEM(py_value, i, f); // Steals reference
-                         }
-                         if (!py_value && !PyErr_Occurred()) {
-                             PyErr_SetString(PyExc_RuntimeError, "Failed to build float list items");
-                         }
-                     } // else PyList_New failed
-                 }
-                 // Check object creation success
-                 if (!py_value) { ret = aiReturn_FAILURE; }
-             } else if (ret == aiReturn_SUCCESS && arr_size == 0) {
-                 // Property type was float/double/buffer, but getter returned 0 elements.
-                 // This shouldn't typically happen if prop->mType matched, but handle it.
-                 ret = aiReturn_FAILURE; // Treat as failure to get a *value*
-             } // else ret != SUCCESS
-             break; // End Float/Buffer/Double case
+// Create a (num_rows, 3) uint16 memoryview of positions quantized over their
+// bounding box, and the (scale, offset) tuples to dequantize them.
+// Returns new reference or NULL on error.
+static PyObject* quantized_memoryview(const struct aiVector3D *src, size_t num_rows, PyObject **py_scale, PyObject **py_offset) {
+    float scale[3], offset[3];
+    uint16_t *quantized = (uint16_t *)malloc(num_rows ? num_rows * 3 * sizeof(uint16_t) : 1);
+    if (!quantized) return PyErr_NoMemory();
+
+    Py_BEGIN_ALLOW_THREADS
+    quantize_positions(quantized, (const float *)src, num_rows, sizeof(struct aiVector3D), scale, offset);
+    Py_END_ALLOW_THREADS
+
+    *py_scale = Py_BuildValue("(fff)", scale[0], scale[1], scale[2]);
+    *py_offset = Py_BuildValue("(fff)", offset[0], offset[1], offset[2]);
+    if (!*py_scale || !*py_offset) {
+        free(quantized);
+        return NULL;
+    }
+    return create_memoryview(quantized, num_rows, 3, 0, "H", sizeof(uint16_t), NULL);
+}
 
-        case aiPTI_Integer:
-             arr_size = 16; // Input: Our buffer capacity
-             // Call the generic Integer Array getter
-             ret = aiGetMaterialIntegerArray(mat, key, type, index, ival, &arr_size);
-             // fprintf(stderr, "DEBUG get_material_property (Int Fixed): key='%s', ret=%d, arr_size_written=%u\n", key, ret, arr_size);
-
-             if (ret == aiReturn_SUCCESS && arr_size > 0) { // Check success AND elements retrieved
-                 if (arr_size == 1) {
-                     // NOTE: No special handling for shininess here, return as Long
-                     // Conversion to float if needed should happen in Python layer
-                     py_value = PyLong_FromLong((long)ival[0]);
-                 } else { // List of integers
-                     py_value = PyList_New(arr_size);
-                     if (py_value) {
-                         for (unsigned int i = 0; i < arr_size; ++i) {
-                             PyObject* integer = PyLong_FromLong((long)ival[i]);
-                             if (!integer) { Py_DECREF(py_value); py_value = NULL; break; }
-                             PyList_SET_ITEM(py_value, i, integer); // Steals reference
-                         }
-                         if (!py_value && !PyErr_Occurred()) {
-                            PyErr_SetString(PyExc_RuntimeError, "Failed to build integer list items");
-                         }
-                     } // else PyList_New failed
-                 }
-                  // Check object creation success
-                 if (!py_value) { ret = aiReturn_FAILURE; }
-            } else if (ret == aiReturn_SUCCESS && arr_size == 0) {
-                 // Property type was int, but getter returned 0 elements.
-                 ret = aiReturn_FAILURE; // Treat as failure to get a *value*
-            } // else ret != SUCCESS
-            break; // End Integer case
+// Helper to create a Python list of floats from a C array of aiColor4D
+// Returns a new reference or NULL on error.
+static PyObject* list_from_color4d_array(const struct aiColor4D* colors, unsigned int count) {
+    PyObject* list = PyList_New(count);
+    if (!list) return NULL;
 
-        default:
-             // Unsupported property type found in the material's property list
-             // fprintf(stderr, "DEBUG get_material_property: Unsupported property type %d for key='%s'\n", prop->mType, key);
-             ret = aiReturn_FAILURE; // Mark as failure
-             break;
-    } // end switch
-
-    // --- Final Return Decision ---
-    if (ret == aiReturn_SUCCESS && py_value != NULL) {
-        // Data successfully retrieved and converted
-        return py_value;
-    } else {
-        // Something failed or no value was produced (e.g., ret!=SUCCESS, arr_size=0, Py object creation fail)
-        Py_XDECREF(py_value); // Ensure cleanup if partially created
-        if (!PyErr_Occurred()) {
-            // No specific Python error set - return None
-            Py_RETURN_NONE;
-        } else {
-            // Propagate existing Python error
+    for (unsigned int i = 0; i < count; ++i) {
+        PyObject* tuple = Py_BuildValue("ffff", colors[i].r, colors[i].g, colors[i].b, colors[i].a);
+        if (!tuple) {
+            Py_DECREF(list);
             return NULL;
         }
+        // PyList_SetItem steals the reference to tuple, no DECREF needed on success
+        if (PyList_SetItem(list, i, tuple) < 0) {
+             Py_DECREF(tuple);
+             Py_DECREF(list);
+             return NULL;
+        }
     }
+    return list;
 }
 
 // Helper to create a Python tuple of floats from a row of aiMatrix4x4
@@ -527,579 +1381,3238 @@ static PyObject* tuple_from_uint_array(const unsigned int* arr, unsigned int siz
     return tuple;
 }
 
-// Helper to convert ASSIMP property names to better format
-static char* nice_prop_name(char* prop) {
-    if (strcmp(prop, "?mat.name") == 0)
-        return "NAME";
-    else if (strcmp(prop, "$mat.twosided") == 0)
-        return "TWOSIDED";
-    else if (strcmp(prop, "$mat.shadingm") == 0)
-        return "SHADING_MODEL";
-    else if (strcmp(prop, "$mat.wireframe") == 0)
-        return "ENABLE_WIREFRAME";
-    else if (strcmp(prop, "$mat.blend") == 0)
-        return "BLEND_FUNC";
-    else if (strcmp(prop, "$mat.opacity") == 0)
-        return "OPACITY";
-    else if (strcmp(prop, "$mat.bumpscaling") == 0)
-        return "BUMPSCALING";
-    else if (strcmp(prop, "$mat.shininess") == 0)
-        return "SHININESS";
-    else if (strcmp(prop, "$mat.reflectivity") == 0)
-        return "REFLECTIVITY";
-    else if (strcmp(prop, "$mat.shinpercent") == 0)
-        return "SHININESS_STRENGTH";
-    else if (strcmp(prop, "$mat.refracti") == 0)
-        return "REFRACTI";
-    else if (strcmp(prop, "$clr.diffuse") == 0)
-        return "COLOR_DIFFUSE";
-    else if (strcmp(prop, "$clr.ambient") == 0)
-        return "COLOR_AMBIENT";
-    else if (strcmp(prop, "$clr.specular") == 0)
-        return "COLOR_SPECULAR";
-    else if (strcmp(prop, "$clr.emissive") == 0)
-        return "COLOR_EMISSIVE";
-    else if (strcmp(prop, "$clr.transparent") == 0)
-        return "COLOR_TRANSPARENT";
-    else if (strcmp(prop, "$clr.reflective") == 0)
-        return "COLOR_REFLECTIVE";
-    else if (strcmp(prop, "?bg.global") == 0)
-        return "GLOBAL_BACKGROUND_IMAGE";
-    else if (strcmp(prop, "$tex.file") == 0)
-        return "TEXTURE_BASE";
-    else if (strcmp(prop, "$tex.mapping") == 0)
-        return "MAPPING_BASE";
-    else if (strcmp(prop, "$tex.flags") == 0)
-        return "TEXFLAGS_BASE";
-    else if (strcmp(prop, "$tex.uvwsrc") == 0)
-        return "UVWSRC_BASE";
-    else if (strcmp(prop, "$tex.mapmodev") == 0)
-        return "MAPPINGMODE_V_BASE";
-    else if (strcmp(prop, "$tex.mapaxis") == 0)
-        return "TEXMAP_AXIS_BASE";
-    else if (strcmp(prop, "$tex.blend") == 0)
-        return "TEXBLEND_BASE";
-    else if (strcmp(prop, "$tex.uvtrafo") == 0)
-        return "UVTRANSFORM_BASE";
-    else if (strcmp(prop, "$tex.op") == 0)
-        return "TEXOP_BASE";
-    else if (strcmp(prop, "$tex.mapmodeu") == 0)
-        return "MAPPINGMODE_U_BASE";
-    else
-        return "NONE";
-}
-
+// --- Material Keys ---
+// Assimp material property keys and the names used for them in material
+// dictionaries. Keys not listed here, or listed without a name (only read
+// by typed Materials), map to "NONE".
+enum {
+    MK_NAME, MK_TWOSIDED, MK_SHADING_MODEL, MK_WIREFRAME, MK_BLEND_FUNC, MK_OPACITY,
+    MK_BUMPSCALING, MK_SHININESS, MK_REFLECTIVITY, MK_SHININESS_STRENGTH, MK_REFRACTI,
+    MK_COLOR_DIFFUSE, MK_COLOR_AMBIENT, MK_COLOR_SPECULAR, MK_COLOR_EMISSIVE,
+    MK_COLOR_TRANSPARENT, MK_COLOR_REFLECTIVE, MK_GLOBAL_BACKGROUND_IMAGE,
+    MK_TEXTURE_FILE, MK_TEXTURE_MAPPING, MK_TEXTURE_FLAGS, MK_TEXTURE_UVWSRC,
+    MK_TEXTURE_MAPMODE_V, MK_TEXTURE_MAPAXIS, MK_TEXTURE_BLEND, MK_TEXTURE_UVTRAFO,
+    MK_TEXTURE_OP, MK_TEXTURE_MAPMODE_U,
+    MK_BASE_COLOR, MK_METALLIC, MK_ROUGHNESS,
+    NUM_MATERIAL_KEYS
+};
 
-// --- Scene Processing Logic ---
+static const char *const material_keys[NUM_MATERIAL_KEYS][2] = {
+    [MK_NAME] = {"?mat.name", "NAME"},
+    [MK_TWOSIDED] = {"$mat.twosided", "TWOSIDED"},
+    [MK_SHADING_MODEL] = {"$mat.shadingm", "SHADING_MODEL"},
+    [MK_WIREFRAME] = {"$mat.wireframe", "ENABLE_WIREFRAME"},
+    [MK_BLEND_FUNC] = {"$mat.blend", "BLEND_FUNC"},
+    [MK_OPACITY] = {"$mat.opacity", "OPACITY"},
+    [MK_BUMPSCALING] = {"$mat.bumpscaling", "BUMPSCALING"},
+    [MK_SHININESS] = {"$mat.shininess", "SHININESS"},
+    [MK_REFLECTIVITY] = {"$mat.reflectivity", "REFLECTIVITY"},
+    [MK_SHININESS_STRENGTH] = {"$mat.shinpercent", "SHININESS_STRENGTH"},
+    [MK_REFRACTI] = {"$mat.refracti", "REFRACTI"},
+    [MK_COLOR_DIFFUSE] = {"$clr.diffuse", "COLOR_DIFFUSE"},
+    [MK_COLOR_AMBIENT] = {"$clr.ambient", "COLOR_AMBIENT"},
+    [MK_COLOR_SPECULAR] = {"$clr.specular", "COLOR_SPECULAR"},
+    [MK_COLOR_EMISSIVE] = {"$clr.emissive", "COLOR_EMISSIVE"},
+    [MK_COLOR_TRANSPARENT] = {"$clr.transparent", "COLOR_TRANSPARENT"},
+    [MK_COLOR_REFLECTIVE] = {"$clr.reflective", "COLOR_REFLECTIVE"},
+    [MK_GLOBAL_BACKGROUND_IMAGE] = {"?bg.global", "GLOBAL_BACKGROUND_IMAGE"},
+    [MK_TEXTURE_FILE] = {"$tex.file", "TEXTURE_BASE"},
+    [MK_TEXTURE_MAPPING] = {"$tex.mapping", "MAPPING_BASE"},
+    [MK_TEXTURE_FLAGS] = {"$tex.flags", "TEXFLAGS_BASE"},
+    [MK_TEXTURE_UVWSRC] = {"$tex.uvwsrc", "UVWSRC_BASE"},
+    [MK_TEXTURE_MAPMODE_V] = {"$tex.mapmodev", "MAPPINGMODE_V_BASE"},
+    [MK_TEXTURE_MAPAXIS] = {"$tex.mapaxis", "TEXMAP_AXIS_BASE"},
+    [MK_TEXTURE_BLEND] = {"$tex.blend", "TEXBLEND_BASE"},
+    [MK_TEXTURE_UVTRAFO] = {"$tex.uvtrafo", "UVTRANSFORM_BASE"},
+    [MK_TEXTURE_OP] = {"$tex.op", "TEXOP_BASE"},
+    [MK_TEXTURE_MAPMODE_U] = {"$tex.mapmodeu", "MAPPINGMODE_U_BASE"},
+    [MK_BASE_COLOR] = {"$clr.base", NULL},
+    [MK_METALLIC] = {"$mat.metallicFactor", NULL},
+    [MK_ROUGHNESS] = {"$mat.roughnessFactor", NULL},
+};
+#define MATERIAL_KEY_SLOTS 64           // Hash table size, a power of two > 2 * NUM_MATERIAL_KEYS
+
+// Created once by init_material_keys and kept for the life of the process
+static PyObject *material_key_names[NUM_MATERIAL_KEYS]; // Interned dictionary keys, "NONE" if unnamed
+static PyObject *material_key_none;                     // Interned "NONE"
+static PyObject *material_key_textures;                 // Interned "TEXTURES"
+static signed char material_key_slots[MATERIAL_KEY_SLOTS]; // Index into material_keys, -1 if empty
+
+// FNV-1a
+static unsigned int material_key_hash(const char *key) {
+    unsigned int hash = 2166136261u;
+    for (; *key; ++key) {
+        hash = (hash ^ (unsigned char)*key) * 16777619u;
+    }
+    return hash;
+}
 
-// --- Forward Declaration for Recursion ---
-static PyObject* process_node_recursive(struct aiNode* c_node);
+// Index of `key` in material_keys, or -1. Linear probing, the table is never full.
+static int material_key_index(const char *key) {
+    unsigned int slot = material_key_hash(key) & (MATERIAL_KEY_SLOTS - 1);
+    for (; material_key_slots[slot] >= 0; slot = (slot + 1) & (MATERIAL_KEY_SLOTS - 1)) {
+        int index = material_key_slots[slot];
+        if (strcmp(material_keys[index][0], key) == 0) return index;
+    }
+    return -1;
+}
 
+// Build the key hash table and intern the dictionary keys. Returns -1 on error.
+static int init_material_keys(void) {
+    memset(material_key_slots, -1, sizeof(material_key_slots));
+    material_key_none = PyUnicode_InternFromString("NONE");
+    material_key_textures = PyUnicode_InternFromString("TEXTURES");
+    if (!material_key_none || !material_key_textures) return -1;
+    for (int i = 0; i < NUM_MATERIAL_KEYS; ++i) {
+        material_key_names[i] = material_keys[i][1] ? PyUnicode_InternFromString(material_keys[i][1]) : material_key_none;
+        if (!material_key_names[i]) return -1;
+        unsigned int slot = material_key_hash(material_keys[i][0]) & (MATERIAL_KEY_SLOTS - 1);
+        while (material_key_slots[slot] >= 0) {
+            slot = (slot + 1) & (MATERIAL_KEY_SLOTS - 1);
+        }
+        material_key_slots[slot] = (signed char)i;
+    }
+    return 0;
+}
 
-// Process materials from aiScene into a Python list of dictionaries.
-// Returns a new reference to the list, or NULL on error.
-static PyObject* process_materials(const struct aiScene *c_scene) {
-    unsigned int num_materials = c_scene->mNumMaterials;
-    PyObject *py_materials_list = PyList_New(num_materials);
-    if (!py_materials_list) return NULL;
+// Decode the numeric data of a material property straight from its mData,
+// giving the values the aiGetMaterial* getters would return for its own
+// type: up to 16 floats for float, double and buffer data, up to 16 ints for
+// integers. Sets `*is_int` and returns the number of values, 0 for strings
+// and unsupported types.
+static unsigned int material_property_numbers(const struct aiMaterialProperty *prop, float fval[16], int ival[16], int *is_int) {
+    unsigned int count = 0;
+    *is_int = 0;
 
-    for (unsigned int i = 0; i < num_materials; ++i) {
-        struct aiMaterial *mat = c_scene->mMaterials[i];
-        PyObject *mat_dict = PyDict_New();
-        if (!mat_dict) goto fail_mat_list;
+    switch (prop->mType) {
+        case aiPTI_Float:
+        case aiPTI_Buffer: // Buffers are read as floats
+            count = prop->mDataLength / sizeof(float);
+            count = count < 16 ? count : 16;
+            memcpy(fval, prop->mData, count * sizeof(float));
+            break;
 
-        // Iterate through material properties
-        for (unsigned int p = 0; p < mat->mNumProperties; ++p) {
-            struct aiMaterialProperty *prop = mat->mProperties[p];
-            // Use the original key directly
-            PyObject *py_key = PyUnicode_FromString(nice_prop_name(prop->mKey.data));
-            if (!py_key) {
-                Py_DECREF(mat_dict);
-                goto fail_mat_list;
+        case aiPTI_Double:
+            count = prop->mDataLength / sizeof(double);
+            count = count < 16 ? count : 16;
+            for (unsigned int i = 0; i < count; ++i) {
+                double d;
+                memcpy(&d, prop->mData + i * sizeof(double), sizeof(double));
+                fval[i] = (float)d; // Same precision as the float getter
             }
+            break;
 
-            PyObject *py_value = get_material_property(mat, prop->mKey.data, prop->mSemantic, prop->mIndex);
-            if (!py_value) { // Error occurred in get_material_property
-                Py_DECREF(py_key);
-                Py_DECREF(mat_dict);
-                goto fail_mat_list;
+        case aiPTI_Integer:
+            *is_int = 1;
+            if (prop->mDataLength == 1) {
+                ival[0] = (int)*prop->mData; // Single byte booleans
+                count = 1;
+            } else {
+                count = prop->mDataLength / sizeof(int);
+                count = count < 1 ? 1 : (count < 16 ? count : 16);
+                memset(ival, 0, 16 * sizeof(int));
+                memcpy(ival, prop->mData, prop->mDataLength < count * sizeof(int) ? prop->mDataLength : count * sizeof(int));
             }
+            break;
 
-            // Only add if value is not None (unless None signifies absence vs error)
-            // Let's include None values for completeness.
-            if (PyDict_SetItem(mat_dict, py_key, py_value) < 0) {
-                Py_DECREF(py_key);
-                Py_DECREF(py_value);
-                Py_DECREF(mat_dict);
-                goto fail_mat_list;
-            }
-            Py_DECREF(py_key);   // Dereference temporary key
-            Py_DECREF(py_value); // Dereference value (SetItem increments)
-        }
-
-        // Add textures separately for clarity
-        PyObject *textures_dict = PyDict_New();
-        if (!textures_dict) {
-            Py_DECREF(mat_dict);
-            goto fail_mat_list;
-        }
-
-        for (int tt = aiTextureType_NONE; tt <= aiTextureType_UNKNOWN; ++tt) {
-             enum aiTextureType tex_type = (enum aiTextureType)tt;
-             unsigned int tex_count = aiGetMaterialTextureCount(mat, tex_type);
-             if (tex_count == 0) continue;
-
-             PyObject *texture_list = PyList_New(tex_count);
-             if (!texture_list) {
-                 Py_DECREF(textures_dict);
-                 Py_DECREF(mat_dict);
-                 goto fail_mat_list;
-             }
-
-             for(unsigned int tex_idx = 0; tex_idx < tex_count; ++tex_idx) {
-                 struct aiString path;
-                 // We only retrieve the path here. Other details could be added.
-                 aiReturn ret = aiGetMaterialTexture(mat, tex_type, tex_idx, &path,
-                                                     NULL, NULL, NULL, NULL, NULL, NULL);
-                 if (ret == aiReturn_SUCCESS) {
-                     PyObject *py_path = PyUnicode_FromString(path.data);
-                     if (!py_path) {
-                         Py_DECREF(texture_list);
-                         Py_DECREF(textures_dict);
-                         Py_DECREF(mat_dict);
-                         goto fail_mat_list;
-                     }
-                     PyList_SET_ITEM(texture_list, tex_idx, py_path); // Steals ref
-                 } else {
-                     // Handle error or insert None? Let's skip on error.
-                     PyErr_Format(PyExc_RuntimeError, "Failed to get texture path for type %d index %d", tt, tex_idx);
-                     Py_DECREF(texture_list);
-                     Py_DECREF(textures_dict);
-                     Py_DECREF(mat_dict);
-                     goto fail_mat_list;
-                 }
-             }
-             // Use the texture type enum value as the key
-             PyObject *py_tex_type_key = PyLong_FromLong(tex_type);
-             if (!py_tex_type_key) {
-                 Py_DECREF(texture_list); // List contains owned refs now
-                 Py_DECREF(textures_dict);
-                 Py_DECREF(mat_dict);
-                 goto fail_mat_list;
-             }
-             if (PyDict_SetItem(textures_dict, py_tex_type_key, texture_list) < 0) {
-                 Py_DECREF(py_tex_type_key);
-                 Py_DECREF(texture_list);
-                 Py_DECREF(textures_dict);
-                 Py_DECREF(mat_dict);
-                 goto fail_mat_list;
-             }
-             Py_DECREF(py_tex_type_key);
-             Py_DECREF(texture_list); // SetItem increments ref
-        }
-
-        // Add the textures dictionary to the main material dictionary
-        PyObject *textures_key = PyUnicode_FromString("TEXTURES");
-         if (!textures_key) {
-             Py_DECREF(textures_dict);
-             Py_DECREF(mat_dict);
-             goto fail_mat_list;
-         }
-        if (PyDict_SetItem(mat_dict, textures_key, textures_dict) < 0) {
-            Py_DECREF(textures_key);
-            Py_DECREF(textures_dict);
-            Py_DECREF(mat_dict);
-            goto fail_mat_list;
-        }
-        Py_DECREF(textures_key);
-        Py_DECREF(textures_dict); // SetItem increments ref
-
-        // PyList_SetItem steals the reference to mat_dict
-        if (PyList_SetItem(py_materials_list, i, mat_dict) < 0) {
-            Py_DECREF(mat_dict); // Decref if SetItem failed
-            goto fail_mat_list;
-        }
-    }
-
-    return py_materials_list; // Success
-
-fail_mat_list:
-    Py_DECREF(py_materials_list); // Decrement ref count on the main list
-    return NULL; // Error
-}
-
-
-// Process meshes from aiScene into a Python list of Mesh objects.
-// Returns a new reference to the list, or NULL on error.
-static PyObject* process_meshes(const struct aiScene *c_scene) {
-    unsigned int num_meshes = c_scene->mNumMeshes;
-    PyObject *py_meshes_list = PyList_New(num_meshes);
-    if (!py_meshes_list) return NULL;
+        default:
+            break; // Strings and unsupported property types
+    }
+    return count;
+}
 
-    for (unsigned int i = 0; i < num_meshes; ++i) {
-        struct aiMesh *c_mesh = c_scene->mMeshes[i];
-        Mesh *py_mesh = (Mesh *)MeshType.tp_alloc(&MeshType, 0); // Create new Mesh object
-        if (!py_mesh) goto fail_mesh_list;
-
-        // --- Basic Info ---
-        py_mesh->name = PyUnicode_FromString(c_mesh->mName.data);
-        if (!py_mesh->name) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-        py_mesh->num_vertices = c_mesh->mNumVertices;
-        py_mesh->num_faces = c_mesh->mNumFaces;
-        py_mesh->material_index = c_mesh->mMaterialIndex;
-
-        size_t buffer_size; // Used for calculating allocation sizes
-        Py_ssize_t itemsize; // For memoryview
-
-        // --- Indices ---
-        // Calculate total number of indices assuming triangulation (most common case)
-        // If aiProcess_Triangulate is not used, this needs adjustment or checking mNumIndices per face.
-        py_mesh->num_indices = 0;
-        for (unsigned int f = 0; f < c_mesh->mNumFaces; ++f) {
-            // Ensure faces are triangles if assuming flat index buffer
-             if (c_mesh->mFaces[f].mNumIndices != 3) {
-                 // Consider raising an error if triangulation wasn't enforced by flags
-                 PyErr_SetString(PyExc_ValueError, "Mesh processing assumes triangulated faces (use aiProcess_Triangulate flag).");
-                 Py_DECREF(py_mesh);
-                 goto fail_mesh_list;
-             }
-            py_mesh->num_indices += c_mesh->mFaces[f].mNumIndices;
-        }
-
-        if (py_mesh->num_indices > 0) {
-            buffer_size = py_mesh->num_indices * sizeof(unsigned int);
-            itemsize = sizeof(unsigned int);
-            py_mesh->c_indices = (unsigned int*)malloc(buffer_size);
-            if (!py_mesh->c_indices) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
-
-            unsigned int idx_count = 0;
-            for (unsigned int f = 0; f < c_mesh->mNumFaces; ++f) {
-                memcpy(py_mesh->c_indices + idx_count, c_mesh->mFaces[f].mIndices, c_mesh->mFaces[f].mNumIndices * sizeof(unsigned int));
-                idx_count += c_mesh->mFaces[f].mNumIndices;
-            }
-            // Format 'I' is standard unsigned int
-            py_mesh->indices = create_memoryview(py_mesh->c_indices, buffer_size, "I", itemsize);
-            if (!py_mesh->indices) { Py_DECREF(py_mesh); goto fail_mesh_list; }
+// First value of a material property read as an integer, the way
+// aiGetMaterialInteger reads it: buffers hold integers (a single byte being a
+// bool) and floats are truncated. Returns 0 if the property has no value.
+static int material_property_int(const struct aiMaterialProperty *prop, int *value) {
+    float fval[16];
+    int ival[16];
+    int is_int;
+
+    if (prop->mType == aiPTI_Buffer) {
+        if (prop->mDataLength == 1) {
+            *value = (int)*prop->mData;
+        } else if (prop->mDataLength >= sizeof(int32_t)) {
+            int32_t v;
+            memcpy(&v, prop->mData, sizeof(v));
+            *value = v;
         } else {
-            Py_INCREF(Py_None); py_mesh->indices = Py_None; // No indices
+            return 0;
         }
+        return 1;
+    }
+    if (material_property_numbers(prop, fval, ival, &is_int) == 0) return 0;
+    *value = is_int ? ival[0] : (int)fval[0];
+    return 1;
+}
 
+// Python value of a material property: a str for strings, else the values of
+// material_property_numbers. One value is returned as a scalar, several as a
+// list and none (or an unsupported type) as None.
+// Returns new reference or NULL on error.
+static PyObject* material_property_value(const struct aiMaterialProperty *prop) {
+    float fval[16];
+    int ival[16];
+    int is_int;
+
+    if (prop->mType == aiPTI_String) {
+        // 32 bit length prefix followed by the zero-terminated UTF-8 data
+        if (prop->mDataLength < 5) Py_RETURN_NONE;
+        return PyUnicode_FromString(prop->mData + 4);
+    }
 
-        // --- Vertices ---
-        if (c_mesh->mVertices) {
-            buffer_size = py_mesh->num_vertices * 3 * sizeof(float);
-            itemsize = sizeof(float);
-            py_mesh->c_vertices = (float*)malloc(buffer_size);
-            if (!py_mesh->c_vertices) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
-            memcpy(py_mesh->c_vertices, c_mesh->mVertices, buffer_size);
-            // Format 'f' is standard float
-            py_mesh->vertices = create_memoryview(py_mesh->c_vertices, buffer_size, "f", itemsize);
-             if (!py_mesh->vertices) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-        } else {
-             Py_INCREF(Py_None); py_mesh->vertices = Py_None; // Should not happen for valid mesh
-        }
-
-        // --- Normals ---
-        if (c_mesh->mNormals) {
-            buffer_size = py_mesh->num_vertices * 3 * sizeof(float);
-            itemsize = sizeof(float);
-            py_mesh->c_normals = (float*)malloc(buffer_size);
-            if (!py_mesh->c_normals) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
-            memcpy(py_mesh->c_normals, c_mesh->mNormals, buffer_size);
-            py_mesh->normals = create_memoryview(py_mesh->c_normals, buffer_size, "f", itemsize);
-             if (!py_mesh->normals) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-        } else {
-             Py_INCREF(Py_None); py_mesh->normals = Py_None;
-        }
-
-        // --- Tangents ---
-        if (c_mesh->mTangents) {
-            buffer_size = py_mesh->num_vertices * 3 * sizeof(float);
-            itemsize = sizeof(float);
-            py_mesh->c_tangents = (float*)malloc(buffer_size);
-            if (!py_mesh->c_tangents) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
-            memcpy(py_mesh->c_tangents, c_mesh->mTangents, buffer_size);
-            py_mesh->tangents = create_memoryview(py_mesh->c_tangents, buffer_size, "f", itemsize);
-             if (!py_mesh->tangents) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-        } else {
-             Py_INCREF(Py_None); py_mesh->tangents = Py_None;
-        }
-
-        // --- Bitangents ---
-        if (c_mesh->mBitangents) {
-            buffer_size = py_mesh->num_vertices * 3 * sizeof(float);
-            itemsize = sizeof(float);
-            py_mesh->c_bitangents = (float*)malloc(buffer_size);
-            if (!py_mesh->c_bitangents) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
-            memcpy(py_mesh->c_bitangents, c_mesh->mBitangents, buffer_size);
-            py_mesh->bitangents = create_memoryview(py_mesh->c_bitangents, buffer_size, "f", itemsize);
-             if (!py_mesh->bitangents) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-        } else {
-             Py_INCREF(Py_None); py_mesh->bitangents = Py_None;
-        }
-
-        // --- Colors ---
-        py_mesh->num_color_sets = 0;
-        for(unsigned int k=0; k < AI_MAX_NUMBER_OF_COLOR_SETS; ++k) {
-            if(c_mesh->mColors[k] != NULL) py_mesh->num_color_sets++; else break;
-        }
-
-        if (py_mesh->num_color_sets > 0) {
-            py_mesh->colors = PyList_New(py_mesh->num_color_sets);
-            if (!py_mesh->colors) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-            py_mesh->c_colors = (float**)calloc(py_mesh->num_color_sets, sizeof(float*)); // Use calloc for NULL init
-             if (!py_mesh->c_colors) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
-
-            for(unsigned int k=0; k < py_mesh->num_color_sets; ++k) {
-                 // Colors are aiColor4D (r,g,b,a) -> 4 floats
-                 buffer_size = py_mesh->num_vertices * 4 * sizeof(float);
-                 itemsize = sizeof(float);
-                 py_mesh->c_colors[k] = (float*)malloc(buffer_size);
-                 if (!py_mesh->c_colors[k]) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
-                 // Need to copy component-wise from aiColor4D
-                 for(unsigned int v=0; v < py_mesh->num_vertices; ++v) {
-                     py_mesh->c_colors[k][v*4 + 0] = c_mesh->mColors[k][v].r;
-                     py_mesh->c_colors[k][v*4 + 1] = c_mesh->mColors[k][v].g;
-                     py_mesh->c_colors[k][v*4 + 2] = c_mesh->mColors[k][v].b;
-                     py_mesh->c_colors[k][v*4 + 3] = c_mesh->mColors[k][v].a;
-                 }
-                 PyObject *memview = create_memoryview(py_mesh->c_colors[k], buffer_size, "f", itemsize);
-                 if (!memview) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-                 PyList_SET_ITEM(py_mesh->colors, k, memview); // Steals ref
-            }
-        } else {
-             Py_INCREF(Py_None); py_mesh->colors = Py_None;
-        }
-
-        // --- Texture Coordinates ---
-        py_mesh->num_texcoord_sets = 0;
-        for(unsigned int k=0; k < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++k) {
-            if(c_mesh->mTextureCoords[k] != NULL) py_mesh->num_texcoord_sets++; else break;
+    unsigned int count = material_property_numbers(prop, fval, ival, &is_int);
+    if (count == 0) {
+        Py_RETURN_NONE;
+    }
+    if (count == 1) {
+        return is_int ? PyLong_FromLong(ival[0]) : PyFloat_FromDouble(fval[0]);
+    }
+    PyObject *list = PyList_New(count);
+    if (!list) return NULL;
+    for (unsigned int i = 0; i < count; ++i) {
+        PyObject *item = is_int ? PyLong_FromLong(ival[i]) : PyFloat_FromDouble(fval[i]);
+        if (!item) {
+            Py_DECREF(list);
+            return NULL;
         }
+        PyList_SET_ITEM(list, i, item); // Steals reference
+    }
+    return list;
+}
 
-        if (py_mesh->num_texcoord_sets > 0) {
-            py_mesh->texcoords = PyList_New(py_mesh->num_texcoord_sets);
-             if (!py_mesh->texcoords) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-            py_mesh->num_uv_components = PyList_New(py_mesh->num_texcoord_sets);
-             if (!py_mesh->num_uv_components) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-
-            py_mesh->c_texcoords = (float**)calloc(py_mesh->num_texcoord_sets, sizeof(float*));
-             if (!py_mesh->c_texcoords) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
-            py_mesh->c_num_uv_components = (unsigned int*)malloc(py_mesh->num_texcoord_sets * sizeof(unsigned int));
-             if (!py_mesh->c_num_uv_components) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
 
+// --- Scene Processing Logic ---
 
-            for(unsigned int k=0; k < py_mesh->num_texcoord_sets; ++k) {
-                 unsigned int ncomp = c_mesh->mNumUVComponents[k]; // 1, 2 or 3
-                 py_mesh->c_num_uv_components[k] = ncomp;
-                 PyObject *comp_obj = PyLong_FromUnsignedLong(ncomp);
-                 if (!comp_obj) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-                 PyList_SET_ITEM(py_mesh->num_uv_components, k, comp_obj); // Steals ref
+// --- Forward Declaration for Recursion ---
+static PyObject* process_node_recursive(struct aiNode* c_node);
 
-                 buffer_size = py_mesh->num_vertices * ncomp * sizeof(float);
-                 itemsize = sizeof(float);
-                 py_mesh->c_texcoords[k] = (float*)malloc(buffer_size);
-                 if (!py_mesh->c_texcoords[k]) { PyErr_NoMemory(); Py_DECREF(py_mesh); goto fail_mesh_list; }
 
-                 // Copy from aiVector3D, taking only ncomp components
-                 for(unsigned int v=0; v < py_mesh->num_vertices; ++v) {
-                    memcpy(py_mesh->c_texcoords[k] + v * ncomp, &(c_mesh->mTextureCoords[k][v].x), ncomp * sizeof(float));
-                 }
+// Convert one aiMaterial into a Python dictionary of its properties, in a
+// single pass over them. Later properties mapping to the same key win.
+// TEXTURES maps each texture type to the list of its texture paths.
+// Returns a new reference to the dictionary, or NULL on error.
+static PyObject* process_material(struct aiMaterial *mat) {
+    unsigned int tex_counts[aiTextureType_UNKNOWN + 1] = {0}; // Texture paths per type
+    const struct aiMaterialProperty **tex_files = NULL;        // "$tex.file" properties
+    unsigned int num_tex_files = 0;
+    PyObject *textures_dict = NULL;
+    PyObject *mat_dict = PyDict_New();
+    if (!mat_dict) return NULL;
+
+    tex_files = (const struct aiMaterialProperty **)PyMem_Malloc((mat->mNumProperties + 1) * sizeof(*tex_files));
+    if (!tex_files) {
+        PyErr_NoMemory();
+        goto fail;
+    }
 
-                 PyObject *memview = create_memoryview(py_mesh->c_texcoords[k], buffer_size, "f", itemsize);
-                 if (!memview) { Py_DECREF(py_mesh); goto fail_mesh_list; }
-                 PyList_SET_ITEM(py_mesh->texcoords, k, memview); // Steals ref
+    for (unsigned int p = 0; p < mat->mNumProperties; ++p) {
+        const struct aiMaterialProperty *prop = mat->mProperties[p];
+        int key_index = material_key_index(prop->mKey.data);
+        PyObject *py_key = key_index >= 0 ? material_key_names[key_index] : material_key_none; // Borrowed
+
+        PyObject *py_value = material_property_value(prop);
+        if (!py_value) goto fail;
+        int err = PyDict_SetItem(mat_dict, py_key, py_value);
+        Py_DECREF(py_value);
+        if (err < 0) goto fail;
+
+        if (key_index == MK_TEXTURE_FILE && prop->mSemantic <= aiTextureType_UNKNOWN) {
+            tex_files[num_tex_files++] = prop;
+            if (prop->mIndex + 1 > tex_counts[prop->mSemantic]) {
+                tex_counts[prop->mSemantic] = prop->mIndex + 1;
             }
-        } else {
-             Py_INCREF(Py_None); py_mesh->texcoords = Py_None;
-             py_mesh->num_uv_components = PyList_New(0); // Empty list if no texcoords
-             if (!py_mesh->num_uv_components) { Py_DECREF(py_mesh); goto fail_mesh_list; }
         }
+    }
 
+    // Texture paths, keyed by the texture type enum value
+    textures_dict = PyDict_New();
+    if (!textures_dict) goto fail;
+
+    for (unsigned int tt = aiTextureType_NONE; tt <= aiTextureType_UNKNOWN; ++tt) {
+        if (tex_counts[tt] == 0) continue;
+
+        PyObject *texture_list = PyList_New(tex_counts[tt]);
+        if (!texture_list) goto fail;
+        for (unsigned int t = 0; t < num_tex_files; ++t) {
+            const struct aiMaterialProperty *prop = tex_files[t];
+            if (prop->mSemantic != tt || prop->mType != aiPTI_String || prop->mDataLength < 5 ||
+                PyList_GET_ITEM(texture_list, prop->mIndex)) continue;
+            PyObject *py_path = PyUnicode_FromString(prop->mData + 4);
+            if (!py_path) {
+                Py_DECREF(texture_list);
+                goto fail;
+            }
+            PyList_SET_ITEM(texture_list, prop->mIndex, py_path); // Steals ref
+        }
+        for (unsigned int tex_idx = 0; tex_idx < tex_counts[tt]; ++tex_idx) {
+            if (!PyList_GET_ITEM(texture_list, tex_idx)) {
+                PyErr_Format(PyExc_RuntimeError, "Failed to get texture path for type %d index %d", tt, tex_idx);
+                Py_DECREF(texture_list);
+                goto fail;
+            }
+        }
 
-        // --- Add Mesh to List ---
-        // PyList_SetItem steals the reference, no DECREF needed on success
-        if (PyList_SetItem(py_meshes_list, i, (PyObject*)py_mesh) < 0) {
-             Py_DECREF(py_mesh); // Decref if SetItem failed
-             goto fail_mesh_list;
+        PyObject *py_tex_type_key = PyLong_FromLong(tt);
+        if (!py_tex_type_key || PyDict_SetItem(textures_dict, py_tex_type_key, texture_list) < 0) {
+            Py_XDECREF(py_tex_type_key);
+            Py_DECREF(texture_list);
+            goto fail;
         }
+        Py_DECREF(py_tex_type_key);
+        Py_DECREF(texture_list); // SetItem increments ref
     }
 
-    return py_meshes_list; // Success
+    if (PyDict_SetItem(mat_dict, material_key_textures, textures_dict) < 0) goto fail;
+    Py_DECREF(textures_dict);
+    PyMem_Free(tex_files);
+    return mat_dict;
 
-fail_mesh_list:
-    Py_DECREF(py_meshes_list); // Clean up the main list on error
+fail:
+    Py_XDECREF(textures_dict);
+    Py_DECREF(mat_dict);
+    PyMem_Free(tex_files);
     return NULL;
 }
 
-
-// Recursively process Assimp nodes and build the Python Node hierarchy
-// Returns a NEW reference to the created Node or NULL on error
-static PyObject* process_node_recursive(struct aiNode* c_node) {
-    if (!c_node) { // Should not happen for root, but check anyway
-        PyErr_SetString(PyExc_ValueError, "Encountered NULL aiNode during processing");
-        return NULL;
+// Convert one aiMaterial into a typed Material, decoding its common
+// parameters. Like the aiGetMaterial* getters the first property with a key
+// wins. `owner` is the capsule retaining the aiScene.
+// Returns a new reference to the Material, or NULL on error.
+static PyObject* process_typed_material(struct aiMaterial *mat, PyObject *owner) {
+    Material *py_mat = (Material *)MaterialType.tp_alloc(&MaterialType, 0);
+    if (!py_mat) return NULL;
+    Py_INCREF(owner);
+    py_mat->owner = owner;
+    py_mat->c_material = mat;
+    for (int c = 0; c < NUM_MATERIAL_COLORS; ++c) {
+        for (int k = 0; k < 4; ++k) py_mat->colors[c][k] = NAN;
     }
+    for (int k = 0; k < NUM_MATERIAL_SCALARS; ++k) py_mat->scalars[k] = NAN;
+    py_mat->two_sided = -1;
+    py_mat->shading_model = -1;
+
+    uint64_t seen = 0; // Bit per material_keys index
+    for (unsigned int p = 0; p < mat->mNumProperties; ++p) {
+        const struct aiMaterialProperty *prop = mat->mProperties[p];
+        if (prop->mSemantic != aiTextureType_NONE || prop->mIndex != 0) continue; // Texture slot properties
+        int key_index = material_key_index(prop->mKey.data);
+        if (key_index < 0 || (seen & ((uint64_t)1 << key_index))) continue;
+        seen |= (uint64_t)1 << key_index;
+
+        if (key_index == MK_NAME) {
+            py_mat->name = material_property_value(prop);
+            if (!py_mat->name) {
+                Py_DECREF(py_mat);
+                return NULL;
+            }
+            continue;
+        }
 
-    // 1. Create Python Node object
-    Node* py_node = (Node*)NodeType.tp_alloc(&NodeType, 0);
-    if (!py_node) return NULL; // Allocation failed (MemoryError likely set)
+        int color = -1, scalar = -1, ival;
+        switch (key_index) {
+            case MK_BASE_COLOR: color = MC_BASE_COLOR; break;
+            case MK_COLOR_DIFFUSE: color = MC_DIFFUSE; break;
+            case MK_COLOR_SPECULAR: color = MC_SPECULAR; break;
+            case MK_COLOR_EMISSIVE: color = MC_EMISSIVE; break;
+            case MK_METALLIC: scalar = MS_METALLIC; break;
+            case MK_ROUGHNESS: scalar = MS_ROUGHNESS; break;
+            case MK_OPACITY: scalar = MS_OPACITY; break;
+            case MK_SHININESS: scalar = MS_SHININESS; break;
+            case MK_TWOSIDED: if (material_property_int(prop, &ival)) py_mat->two_sided = ival != 0; continue;
+            case MK_SHADING_MODEL: if (material_property_int(prop, &ival)) py_mat->shading_model = ival; continue;
+            default: continue;
+        }
 
-    // 2. Populate Simple Members
-    py_node->name = PyUnicode_FromString(c_node->mName.data);
-    if (!py_node->name) goto node_proc_error;
+        float fval[16];
+        int ivals[16];
+        int is_int;
+        unsigned int count = material_property_numbers(prop, fval, ivals, &is_int);
+        for (unsigned int i = 0; is_int && i < count; ++i) {
+            fval[i] = (float)ivals[i];
+        }
+        if (color >= 0 && count >= 3) {
+            // RGB colors get an opaque alpha, as from aiGetMaterialColor
+            memcpy(py_mat->colors[color], fval, 3 * sizeof(float));
+            py_mat->colors[color][3] = count >= 4 ? fval[3] : 1.0f;
+        } else if (scalar >= 0 && count >= 1) {
+            py_mat->scalars[scalar] = fval[0];
+        }
+    }
+    if (!py_mat->name) {
+        Py_INCREF(Py_None);
+        py_mat->name = Py_None;
+    }
+    return (PyObject *)py_mat;
+}
 
-    py_node->transformation = tuple_from_matrix4x4(&c_node->mTransformation);
-    if (!py_node->transformation) goto node_proc_error;
+typedef struct {
+    unsigned int type, index, prop; // Texture type and index, property of the "$tex.file"
+} TextureSlotKey;
+
+static int texture_slot_key_compare(const void *a, const void *b) {
+    const TextureSlotKey *x = (const TextureSlotKey *)a, *y = (const TextureSlotKey *)b;
+    if (x->type != y->type) return x->type < y->type ? -1 : 1;
+    if (x->index != y->index) return x->index < y->index ? -1 : 1;
+    return x->prop < y->prop ? -1 : (x->prop > y->prop);
+}
 
-    // Parent Name (or None for root)
-    if (c_node->mParent) {
-        py_node->parent_name = PyUnicode_FromString(c_node->mParent->mName.data);
-        if (!py_node->parent_name) goto node_proc_error;
-    } else {
-        Py_INCREF(Py_None);
-        py_node->parent_name = Py_None;
+// Build the TextureSlot tuple of an aiMaterial, one slot per texture type and
+// index with a "$tex.file" property, ordered by type then index. Settings
+// missing from the material get the defaults assimp applies: uv_index 0 and
+// aiTextureMapping_UV, or None where assimp has no default.
+// Returns a new reference to the tuple, or NULL on error.
+static PyObject* process_texture_slots(const struct aiMaterial *mat) {
+    TextureSlotKey *keys = (TextureSlotKey *)PyMem_Malloc((mat->mNumProperties + 1) * sizeof(TextureSlotKey));
+    if (!keys) return PyErr_NoMemory();
+    unsigned int num_keys = 0;
+    for (unsigned int p = 0; p < mat->mNumProperties; ++p) {
+        const struct aiMaterialProperty *prop = mat->mProperties[p];
+        if (material_key_index(prop->mKey.data) == MK_TEXTURE_FILE) {
+            keys[num_keys].type = prop->mSemantic;
+            keys[num_keys].index = prop->mIndex;
+            keys[num_keys].prop = p;
+            ++num_keys;
+        }
     }
+    qsort(keys, num_keys, sizeof(TextureSlotKey), texture_slot_key_compare);
 
-    // Mesh Indices
-    py_node->num_meshes = c_node->mNumMeshes;
-    py_node->mesh_indices = tuple_from_uint_array(c_node->mMeshes, c_node->mNumMeshes);
-    if (!py_node->mesh_indices) goto node_proc_error;
+    // Duplicate slots keep their first "$tex.file", as in the TEXTURES dictionary
+    unsigned int num_slots = 0;
+    for (unsigned int k = 0; k < num_keys; ++k) {
+        if (num_slots == 0 || keys[k].type != keys[num_slots - 1].type || keys[k].index != keys[num_slots - 1].index) {
+            keys[num_slots++] = keys[k];
+        }
+    }
 
-    // 3. Populate Children (Recursive Step)
-    py_node->num_children = c_node->mNumChildren;
-    py_node->children = PyList_New(py_node->num_children);
-    if (!py_node->children) goto node_proc_error;
+    PyObject *slots = PyTuple_New(num_slots);
+    if (!slots) goto fail;
+    for (unsigned int k = 0; k < num_slots; ++k) {
+        int uv_index = 0, mapping = aiTextureMapping_UV, op = -1, map_u = -1, map_v = -1;
+        float blend = NAN;
+        uint64_t seen = 0;
+        for (unsigned int p = 0; p < mat->mNumProperties; ++p) {
+            const struct aiMaterialProperty *prop = mat->mProperties[p];
+            if (prop->mSemantic != keys[k].type || prop->mIndex != keys[k].index) continue;
+            int key_index = material_key_index(prop->mKey.data);
+            if (key_index < 0 || (seen & ((uint64_t)1 << key_index))) continue;
+            seen |= (uint64_t)1 << key_index;
+
+            int i;
+            if (key_index == MK_TEXTURE_BLEND) {
+                float fval[16];
+                int ival[16];
+                int is_int;
+                if (material_property_numbers(prop, fval, ival, &is_int)) blend = is_int ? (float)ival[0] : fval[0];
+            } else if (material_property_int(prop, &i)) {
+                switch (key_index) {
+                    case MK_TEXTURE_UVWSRC: uv_index = i; break;
+                    case MK_TEXTURE_MAPPING: mapping = i; break;
+                    case MK_TEXTURE_OP: op = i; break;
+                    case MK_TEXTURE_MAPMODE_U: map_u = i; break;
+                    case MK_TEXTURE_MAPMODE_V: map_v = i; break;
+                    default: break;
+                }
+            }
+        }
 
-    for (unsigned int i = 0; i < py_node->num_children; ++i) {
-        // Recursively process child
-        PyObject* py_child = process_node_recursive(c_node->mChildren[i]);
-        if (!py_child) {
-            // Error occurred deeper in recursion
-            goto node_proc_error; // Children list and self will be cleaned up
+        const struct aiMaterialProperty *file = mat->mProperties[keys[k].prop];
+        PyObject *path;
+        if (file->mType == aiPTI_String && file->mDataLength >= 5) {
+            path = PyUnicode_FromString(file->mData + 4);
+        } else {
+            Py_INCREF(Py_None);
+            path = Py_None;
         }
-        // PyList_SET_ITEM steals the reference to py_child
-        if (PyList_SetItem(py_node->children, i, py_child) < 0) {
-            Py_DECREF(py_child); // Decref if SET_ITEM failed
-            goto node_proc_error;
+        PyObject *py_blend, *py_op, *py_map_mode;
+        if (isnan(blend)) {
+            Py_INCREF(Py_None);
+            py_blend = Py_None;
+        } else {
+            py_blend = PyFloat_FromDouble(blend);
+        }
+        if (op < 0) {
+            Py_INCREF(Py_None);
+            py_op = Py_None;
+        } else {
+            py_op = PyLong_FromLong(op);
+        }
+        if (map_u < 0 && map_v < 0) {
+            Py_INCREF(Py_None);
+            py_map_mode = Py_None;
+        } else {
+            py_map_mode = Py_BuildValue("(ii)", map_u < 0 ? aiTextureMapMode_Wrap : map_u,
+                                        map_v < 0 ? aiTextureMapMode_Wrap : map_v);
+        }
+        PyObject *slot = PyStructSequence_New(&TextureSlotType);
+        if (slot) PyTuple_SET_ITEM(slots, k, slot); // Steals ref, cleaned up with the tuple on error
+        if (!slot || !path || !py_blend || !py_op || !py_map_mode) {
+            Py_XDECREF(path);
+            Py_XDECREF(py_blend);
+            Py_XDECREF(py_op);
+            Py_XDECREF(py_map_mode);
+            goto fail;
+        }
+        PyStructSequence_SET_ITEM(slot, 0, PyLong_FromUnsignedLong(keys[k].type));
+        PyStructSequence_SET_ITEM(slot, 1, PyLong_FromUnsignedLong(keys[k].index));
+        PyStructSequence_SET_ITEM(slot, 2, path);
+        PyStructSequence_SET_ITEM(slot, 3, PyLong_FromLong(uv_index));
+        PyStructSequence_SET_ITEM(slot, 4, PyLong_FromLong(mapping));
+        PyStructSequence_SET_ITEM(slot, 5, py_blend);
+        PyStructSequence_SET_ITEM(slot, 6, py_op);
+        PyStructSequence_SET_ITEM(slot, 7, py_map_mode);
+        for (int f = 0; f < 8; ++f) {
+            if (!PyStructSequence_GET_ITEM(slot, f)) goto fail;
         }
     }
+    PyMem_Free(keys);
+    return slots;
 
-    // Success
-    return (PyObject*)py_node;
-
-// Error handling: clean up partially created node
-node_proc_error:
-    Py_DECREF(py_node); // This calls Node_dealloc which Py_CLEARs members
+fail:
+    Py_XDECREF(slots);
+    PyMem_Free(keys);
     return NULL;
 }
 
-// --- Module Methods ---
-
-PyDoc_STRVAR(import_file_doc,
-"import_file(filename: str, flags: int) -> Scene\n"
-"--\n\n"
-"Imports the 3D model from the given filename.\n\n"
-"Args:\n"
-"    filename: Path to the model file.\n"
-"    flags: Post-processing flags (e.g., Process_Triangulate | Process_GenNormals).\n"
-"           Process_Triangulate is highly recommended for predictable index buffers.\n"
-"           Process_JoinIdenticalVertices is useful for reducing vertex count.\n"
-"           Process_CalcTangentSpace is needed if you require tangents/bitangents.\n"
-"           Process_GenSmoothNormals or Process_GenNormals if normals are missing.\n"
-"           Process_FlipUVs can be important depending on texture conventions.\n\n"
-"Returns:\n"
-"    A Scene object containing the loaded data.\n\n"
-"Raises:\n"
-"    FileNotFoundError: If the file does not exist.\n"
-"    RuntimeError: If Assimp fails to load the file.\n"
-"    MemoryError: If memory allocation fails.\n"
-"    ValueError: If arguments are invalid or mesh data is inconsistent (e.g., non-triangulated when expected).");
-
-static PyObject* py_import_file(PyObject *self, PyObject *args) {
-    const char* filename = NULL;
-    unsigned int flags = 0;
-    const struct aiScene *c_scene = NULL;
-    Scene *py_scene = NULL; // The Python Scene object we will return
+static void texture_capsule_destructor(PyObject *capsule) {
+    release_texture((struct aiTexture *)PyCapsule_GetPointer(capsule, "assimp_py.aiTexture"));
+}
 
-    if (!PyArg_ParseTuple(args, "sI:import_file", &filename, &flags)) {
-        // Error already set by PyArg_ParseTuple
-        return NULL;
+// Convert one aiTexture into a Texture whose data view borrows the texels
+// from `owner`. Returns a new reference to the Texture, or NULL on error.
+static PyObject* process_texture(const struct aiTexture *c_texture, PyObject *owner) {
+    Texture *py_texture = (Texture *)TextureType.tp_alloc(&TextureType, 0);
+    if (!py_texture) return NULL;
+    py_texture->width = c_texture->mWidth;
+    py_texture->height = c_texture->mHeight;
+
+    const char *hint = c_texture->achFormatHint;
+    size_t hint_len = 0;
+    while (hint_len < HINTMAXTEXTURELEN && hint[hint_len]) ++hint_len;
+    py_texture->format_hint = PyUnicode_FromStringAndSize(hint, hint_len);
+    if (c_texture->mFilename.length) {
+        py_texture->filename = PyUnicode_FromStringAndSize(c_texture->mFilename.data, c_texture->mFilename.length);
+    } else {
+        Py_INCREF(Py_None);
+        py_texture->filename = Py_None;
     }
+    if (!py_texture->format_hint || !py_texture->filename) goto fail;
 
-    // Basic check if file exists before calling Assimp
-    // Use Python's built-in os.path.exists for better cross-platform compatibility?
-    // For C extension, fopen is reasonable.
-    FILE *f = fopen(filename, "rb"); // Use "rb" for binary check
-    if (!f) {
-        // Map C's file not found to Python's FileNotFoundError
-        // Note: Python 3.3+ needed for FileNotFoundError. Use IOError for older.
-        PyErr_SetString(PyExc_FileNotFoundError, filename);
-        return NULL;
+    if (c_texture->mHeight == 0) {
+        // Compressed: mWidth is the size of the file in bytes
+        Py_ssize_t shape[1] = {c_texture->pcData ? c_texture->mWidth : 0};
+        py_texture->data = buffer_memoryview(c_texture->pcData, 1, shape, NULL, "B", 1, owner);
+    } else {
+        // aiTexel is {b, g, r, a}
+        Py_ssize_t shape[3] = {c_texture->mHeight, c_texture->mWidth, 4};
+        if (!c_texture->pcData) shape[0] = shape[1] = 0;
+        py_texture->data = buffer_memoryview(c_texture->pcData, 3, shape, NULL, "B", 1, owner);
     }
-    fclose(f);
+    if (!py_texture->data) goto fail;
+    return (PyObject *)py_texture;
 
-    // Import the file using Assimp
-    c_scene = aiImportFile(filename, flags);
+fail:
+    Py_DECREF(py_texture);
+    return NULL;
+}
 
-    // Check for Assimp loading errors
-    if (!c_scene || !c_scene->mRootNode || (c_scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE)) {
-        PyErr_Format(PyExc_RuntimeError, "Assimp error loading '%s': %s", filename, aiGetErrorString());
-        aiReleaseImport(c_scene); // Release even if partially loaded
-        return NULL;
+// Convert the embedded textures of an aiScene into a Python list of Texture
+// objects, without copying their data. With `owner` (the capsule retaining
+// the scene) the textures borrow from the scene. Otherwise each aiTexture is
+// detached from the scene and owned by a capsule of its own, so the scene can
+// still be released as soon as it is converted.
+// Returns a new reference to the list, or NULL on error.
+static PyObject* process_textures(struct aiScene *c_scene, PyObject *owner) {
+    unsigned int num_textures = c_scene->mTextures ? c_scene->mNumTextures : 0;
+    PyObject *py_textures_list = PyList_New(num_textures);
+    if (!py_textures_list) return NULL;
+
+    for (unsigned int i = 0; i < num_textures; ++i) {
+        struct aiTexture *c_texture = c_scene->mTextures[i];
+        PyObject *texture_owner = owner;
+        if (owner) {
+            Py_INCREF(owner);
+        } else {
+            texture_owner = PyCapsule_New(c_texture, "assimp_py.aiTexture", texture_capsule_destructor);
+            if (!texture_owner) {
+                Py_DECREF(py_textures_list);
+                return NULL;
+            }
+            c_scene->mTextures[i] = NULL; // Now owned by the capsule
+        }
+        PyObject *py_texture = process_texture(c_texture, texture_owner);
+        Py_DECREF(texture_owner);
+        if (!py_texture) {
+            Py_DECREF(py_textures_list);
+            return NULL;
+        }
+        PyList_SET_ITEM(py_textures_list, i, py_texture); // Steals ref
     }
+    return py_textures_list;
+}
 
-    // Create the Python Scene object
-    py_scene = (Scene *)SceneType.tp_alloc(&SceneType, 0);
-    if (!py_scene) {
-        aiReleaseImport(c_scene);
-        return NULL; // Error already set (likely MemoryError)
-    }
+static void animation_keys_destructor(PyObject *capsule) {
+    free(PyCapsule_GetPointer(capsule, "assimp_py.AnimationKeys"));
+}
 
-    py_scene->num_meshes = c_scene->mNumMeshes;
-    py_scene->num_materials = c_scene->mNumMaterials;
+// Key arrays of one morph channel in the key block of an Animation
+typedef struct {
+    double *times;
+    uint32_t *targets;
+    float *weights;
+    unsigned int width;
+} MorphKeys;
+
+// Set the items of a channel struct sequence, which takes the references.
+// Returns -1 if any of them is NULL (an error is set).
+static int set_channel_items(PyObject *channel, PyObject **items, int num_items) {
+    int ok = 1;
+    for (int i = 0; i < num_items; ++i) {
+        PyStructSequence_SET_ITEM(channel, i, items[i]);
+        ok &= items[i] != NULL;
+    }
+    return ok ? 0 : -1;
+}
 
-    // Process Meshes
-    py_scene->meshes = process_meshes(c_scene);
-    if (!py_scene->meshes) {
-        goto fail; // Error occurred during mesh processing
+// Convert one aiAnimation into a Python Animation. The keys of all channels
+// are unpacked in a single pass into one block: all key times (float64)
+// first, then the values (float32, uint32 for morph targets).
+// Returns a new reference to the Animation, or NULL on error.
+static PyObject* process_animation(const struct aiAnimation *c_anim) {
+    unsigned int num_channels = c_anim->mChannels ? c_anim->mNumChannels : 0;
+    unsigned int num_morph = c_anim->mMorphMeshChannels ? c_anim->mNumMorphMeshChannels : 0;
+    MorphKeys *morph_keys = NULL;
+
+    Animation *py_anim = (Animation *)AnimationType.tp_alloc(&AnimationType, 0);
+    if (!py_anim) return NULL;
+    py_anim->duration = c_anim->mDuration;
+    py_anim->ticks_per_second = c_anim->mTicksPerSecond;
+    py_anim->name = PyUnicode_FromString(c_anim->mName.data);
+    py_anim->channels = PyTuple_New(num_channels);
+    py_anim->morph_channels = PyTuple_New(num_morph);
+    py_anim->tracks = (AnimTrack *)PyMem_Calloc(num_channels ? num_channels : 1, sizeof(AnimTrack));
+    morph_keys = (MorphKeys *)PyMem_Calloc(num_morph ? num_morph : 1, sizeof(MorphKeys));
+    if (!py_anim->name || !py_anim->channels || !py_anim->morph_channels) goto fail;
+    if (!py_anim->tracks || !morph_keys) {
+        PyErr_NoMemory();
+        goto fail;
     }
 
-    // Process Materials
-    py_scene->materials = process_materials(c_scene);
-    if (!py_scene->materials) {
-        goto fail; // Error occurred during material processing
+    size_t num_times = 0, num_values = 0;
+    for (unsigned int c = 0; c < num_channels; ++c) {
+        const struct aiNodeAnim *ch = c_anim->mChannels[c];
+        num_times += (size_t)ch->mNumPositionKeys + ch->mNumRotationKeys + ch->mNumScalingKeys;
+        num_values += (size_t)ch->mNumPositionKeys * 3 + (size_t)ch->mNumRotationKeys * 4 + (size_t)ch->mNumScalingKeys * 3;
+    }
+    for (unsigned int m = 0; m < num_morph; ++m) {
+        const struct aiMeshMorphAnim *ch = c_anim->mMorphMeshChannels[m];
+        morph_keys[m].width = max_morph_targets(ch->mKeys, ch->mNumKeys);
+        num_times += ch->mNumKeys;
+        num_values += (size_t)ch->mNumKeys * morph_keys[m].width * 2; // Targets and weights
+    }
+    size_t block_size = num_times * sizeof(double) + num_values * sizeof(float);
+    void *block = malloc(block_size ? block_size : 1);
+    if (!block) {
+        PyErr_NoMemory();
+        goto fail;
+    }
+    py_anim->keys = PyCapsule_New(block, "assimp_py.AnimationKeys", animation_keys_destructor);
+    if (!py_anim->keys) {
+        free(block);
+        goto fail;
     }
 
-    // **** Process Node Hierarchy ****
-    if (c_scene->mRootNode) {
-        py_scene->root_node = process_node_recursive(c_scene->mRootNode);
-        if (!py_scene->root_node) {
-            // Error occurred during node processing
-            goto fail;
+    Py_BEGIN_ALLOW_THREADS
+    double *times = (double *)block;
+    float *values = (float *)(times + num_times);
+    for (unsigned int c = 0; c < num_channels; ++c) {
+        const struct aiNodeAnim *ch = c_anim->mChannels[c];
+        AnimTrack *track = &py_anim->tracks[c];
+        AnimKeys *keys[3] = {&track->position, &track->rotation, &track->scaling};
+        unsigned int counts[3] = {ch->mNumPositionKeys, ch->mNumRotationKeys, ch->mNumScalingKeys};
+        for (int k = 0; k < 3; ++k) {
+            keys[k]->times = times;
+            keys[k]->values = values;
+            keys[k]->count = counts[k];
+            times += counts[k];
+            values += (size_t)counts[k] * (k == 1 ? 4 : 3);
         }
-    } else {
-        // Should not happen if aiImportFile succeeded, but handle defensively
-        Py_INCREF(Py_None);
-        py_scene->root_node = Py_None;
-    }    
-
-    // Success! Release the C scene and return the Python scene
-    aiReleaseImport(c_scene);
+        track->position.step = unpack_vector_keys(ch->mPositionKeys, ch->mNumPositionKeys,
+                                                  (double *)track->position.times, (float *)track->position.values);
+        track->rotation.step = unpack_quat_keys(ch->mRotationKeys, ch->mNumRotationKeys,
+                                                (double *)track->rotation.times, (float *)track->rotation.values);
+        track->scaling.step = unpack_vector_keys(ch->mScalingKeys, ch->mNumScalingKeys,
+                                                 (double *)track->scaling.times, (float *)track->scaling.values);
+    }
+    for (unsigned int m = 0; m < num_morph; ++m) {
+        const struct aiMeshMorphAnim *ch = c_anim->mMorphMeshChannels[m];
+        size_t num_slots = (size_t)ch->mNumKeys * morph_keys[m].width;
+        morph_keys[m].times = times;
+        morph_keys[m].targets = (uint32_t *)values;
+        morph_keys[m].weights = values + num_slots;
+        times += ch->mNumKeys;
+        values += num_slots * 2;
+        unpack_morph_keys(ch->mKeys, ch->mNumKeys, morph_keys[m].width,
+                          morph_keys[m].times, morph_keys[m].targets, morph_keys[m].weights);
+    }
+    Py_END_ALLOW_THREADS
+
+    PyObject *owner = py_anim->keys;
+    for (unsigned int c = 0; c < num_channels; ++c) {
+        const struct aiNodeAnim *ch = c_anim->mChannels[c];
+        const AnimTrack *track = &py_anim->tracks[c];
+        PyObject *channel = PyStructSequence_New(&AnimationChannelType);
+        if (!channel) goto fail;
+        PyTuple_SET_ITEM(py_anim->channels, c, channel); // Steals ref
+        PyObject *items[9] = {
+            PyUnicode_FromString(ch->mNodeName.data),
+            create_memoryview((void *)track->position.times, track->position.count, 0, 0, "d", sizeof(double), owner),
+            create_memoryview((void *)track->position.values, track->position.count, 3, 0, "f", sizeof(float), owner),
+            create_memoryview((void *)track->rotation.times, track->rotation.count, 0, 0, "d", sizeof(double), owner),
+            create_memoryview((void *)track->rotation.values, track->rotation.count, 4, 0, "f", sizeof(float), owner),
+            create_memoryview((void *)track->scaling.times, track->scaling.count, 0, 0, "d", sizeof(double), owner),
+            create_memoryview((void *)track->scaling.values, track->scaling.count, 3, 0, "f", sizeof(float), owner),
+            PyLong_FromLong(ch->mPreState),
+            PyLong_FromLong(ch->mPostState),
+        };
+        if (set_channel_items(channel, items, 9) < 0) goto fail;
+    }
+    for (unsigned int m = 0; m < num_morph; ++m) {
+        const struct aiMeshMorphAnim *ch = c_anim->mMorphMeshChannels[m];
+        const MorphKeys *keys = &morph_keys[m];
+        PyObject *channel = PyStructSequence_New(&MorphChannelType);
+        if (!channel) goto fail;
+        PyTuple_SET_ITEM(py_anim->morph_channels, m, channel); // Steals ref
+        PyObject *items[4] = {
+            PyUnicode_FromString(ch->mName.data),
+            create_memoryview(keys->times, ch->mNumKeys, 0, 0, "d", sizeof(double), owner),
+            create_memoryview(keys->targets, ch->mNumKeys, keys->width, 0, "I", sizeof(uint32_t), owner),
+            create_memoryview(keys->weights, ch->mNumKeys, keys->width, 0, "f", sizeof(float), owner),
+        };
+        if (set_channel_items(channel, items, 4) < 0) goto fail;
+    }
+
+    PyMem_Free(morph_keys);
+    return (PyObject *)py_anim;
+
+fail:
+    PyMem_Free(morph_keys);
+    Py_DECREF(py_anim);
+    return NULL;
+}
+
+// Process the animations of an aiScene into a Python list of Animation objects.
+// Returns a new reference to the list, or NULL on error.
+static PyObject* process_animations(const struct aiScene *c_scene) {
+    unsigned int num_animations = c_scene->mAnimations ? c_scene->mNumAnimations : 0;
+    PyObject *py_animations_list = PyList_New(num_animations);
+    if (!py_animations_list) return NULL;
+
+    for (unsigned int i = 0; i < num_animations; ++i) {
+        PyObject *py_anim = process_animation(c_scene->mAnimations[i]);
+        if (!py_anim) {
+            Py_DECREF(py_animations_list);
+            return NULL;
+        }
+        PyList_SET_ITEM(py_animations_list, i, py_anim); // Steals ref
+    }
+    return py_animations_list;
+}
+
+// Process materials from aiScene into a Python list of dictionaries, or of
+// Material objects with opts->typed_materials (then `owner` is the capsule
+// retaining the aiScene).
+// Returns a new reference to the list, or NULL on error.
+static PyObject* process_materials(const struct aiScene *c_scene, PyObject *owner, const ConvertOptions *opts) {
+    unsigned int num_materials = c_scene->mNumMaterials;
+    PyObject *py_materials_list = PyList_New(num_materials);
+    if (!py_materials_list) return NULL;
+
+    for (unsigned int i = 0; i < num_materials; ++i) {
+        PyObject *py_mat = opts->typed_materials ? process_typed_material(c_scene->mMaterials[i], owner) :
+                                                   process_material(c_scene->mMaterials[i]);
+        if (!py_mat) {
+            Py_DECREF(py_materials_list);
+            return NULL;
+        }
+        PyList_SET_ITEM(py_materials_list, i, py_mat); // Steals ref
+    }
+    return py_materials_list;
+}
+
+
+// Convert one aiMesh into a Python Mesh object.
+// If `owner` is not NULL it is the capsule retaining the aiScene, and the float32
+// vertex attributes are borrowed from the aiMesh arrays instead of being copied.
+// `opts` selects compact index and attribute formats.
+// Returns a new reference to the Mesh, or NULL on error.
+static PyObject* process_mesh(const struct aiMesh *c_mesh, PyObject *owner, const ConvertOptions *opts) {
+    Mesh *py_mesh = (Mesh *)MeshType.tp_alloc(&MeshType, 0); // Create new Mesh object
+    if (!py_mesh) return NULL;
+
+    // --- Basic Info ---
+    py_mesh->name = PyUnicode_FromString(c_mesh->mName.data);
+    if (!py_mesh->name) goto fail_mesh;
+    py_mesh->num_vertices = c_mesh->mNumVertices;
+    py_mesh->num_faces = c_mesh->mNumFaces;
+    py_mesh->material_index = c_mesh->mMaterialIndex;
+
+    // --- Indices ---
+    // Faces are separate allocations in Assimp, so indices are always copied.
+    // Triangles are validated and flattened in a single pass. Other faces
+    // raise ValueError, unless `opts->polygons` asks for CSR output where
+    // face_offsets holds the start of each face in the flat index buffer.
+    size_t num_faces = c_mesh->mNumFaces;
+    size_t num_indices = num_faces * 3;
+    uint32_t *offsets = NULL;
+    // Indices are below num_vertices, so 16 bits are enough up to 65536 vertices
+    int compact = opts->compact_indices && c_mesh->mNumVertices <= 65536;
+    Py_ssize_t itemsize = compact ? sizeof(uint16_t) : sizeof(unsigned int);
+    void *c_indices = malloc(num_indices * itemsize + 1);
+    if (opts->polygons) {
+        offsets = (uint32_t *)malloc((num_faces + 1) * sizeof(uint32_t));
+    }
+    if (!c_indices || (opts->polygons && !offsets)) {
+        free(c_indices);
+        free(offsets);
+        PyErr_NoMemory();
+        goto fail_mesh;
+    }
+
+    size_t num_triangles;
+    Py_BEGIN_ALLOW_THREADS
+    num_triangles = flatten_triangles(c_indices, compact, c_mesh->mFaces, num_faces);
+    if (num_triangles == num_faces && offsets) {
+        for (size_t f = 0; f <= num_faces; ++f) offsets[f] = (uint32_t)(f * 3);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (num_triangles < num_faces) {
+        if (!opts->polygons) {
+            free(c_indices);
+            PyErr_SetString(PyExc_ValueError, "Mesh processing assumes triangulated faces "
+                            "(use aiProcess_Triangulate flag, or polygons=True).");
+            goto fail_mesh;
+        }
+        num_indices = 0;
+        for (size_t f = 0; f < num_faces; ++f) {
+            num_indices += c_mesh->mFaces[f].mNumIndices;
+        }
+        void *polygon_indices = realloc(c_indices, num_indices * itemsize + 1);
+        if (!polygon_indices) {
+            free(c_indices);
+            free(offsets);
+            PyErr_NoMemory();
+            goto fail_mesh;
+        }
+        c_indices = polygon_indices;
+        Py_BEGIN_ALLOW_THREADS
+        flatten_polygons(c_indices, compact, offsets, c_mesh->mFaces, num_faces);
+        Py_END_ALLOW_THREADS
+    }
+
+    py_mesh->num_indices = (unsigned int)num_indices;
+    if (num_indices > 0) {
+        // Format 'I' is standard unsigned int, 'H' unsigned short
+        py_mesh->indices = create_memoryview(c_indices, num_indices, 0, 0, compact ? "H" : "I", itemsize, NULL);
+        if (!py_mesh->indices) {
+            free(offsets);
+            goto fail_mesh;
+        }
+    } else {
+        free(c_indices);
+        Py_INCREF(Py_None); py_mesh->indices = Py_None; // No indices
+    }
+    if (offsets) {
+        py_mesh->face_offsets = create_memoryview(offsets, num_faces + 1, 0, 0, "I", sizeof(uint32_t), NULL);
+        if (!py_mesh->face_offsets) goto fail_mesh;
+    } else {
+        Py_INCREF(Py_None); py_mesh->face_offsets = Py_None;
+    }
+
+
+    // --- Vertices ---
+    if (c_mesh->mVertices && opts->quantize_positions) {
+        py_mesh->vertices = quantized_memoryview(c_mesh->mVertices, py_mesh->num_vertices,
+                                                 &py_mesh->position_scale, &py_mesh->position_offset);
+         if (!py_mesh->vertices) goto fail_mesh;
+    } else if (c_mesh->mVertices) {
+        py_mesh->vertices = float_memoryview(c_mesh->mVertices, py_mesh->num_vertices, 3, sizeof(struct aiVector3D), owner);
+         if (!py_mesh->vertices) goto fail_mesh;
+    } else {
+         Py_INCREF(Py_None); py_mesh->vertices = Py_None; // Should not happen for valid mesh
+    }
+
+    // --- Normals ---
+    if (c_mesh->mNormals) {
+        py_mesh->normals = attribute_memoryview(c_mesh->mNormals, py_mesh->num_vertices, 3, sizeof(struct aiVector3D), opts->normals, owner);
+         if (!py_mesh->normals) goto fail_mesh;
+    } else {
+         Py_INCREF(Py_None); py_mesh->normals = Py_None;
+    }
+
+    // --- Tangents ---
+    if (c_mesh->mTangents) {
+        py_mesh->tangents = attribute_memoryview(c_mesh->mTangents, py_mesh->num_vertices, 3, sizeof(struct aiVector3D), opts->normals, owner);
+         if (!py_mesh->tangents) goto fail_mesh;
+    } else {
+         Py_INCREF(Py_None); py_mesh->tangents = Py_None;
+    }
+
+    // --- Bitangents ---
+    if (c_mesh->mBitangents) {
+        py_mesh->bitangents = attribute_memoryview(c_mesh->mBitangents, py_mesh->num_vertices, 3, sizeof(struct aiVector3D), opts->normals, owner);
+         if (!py_mesh->bitangents) goto fail_mesh;
+    } else {
+         Py_INCREF(Py_None); py_mesh->bitangents = Py_None;
+    }
+
+    // --- Colors ---
+    py_mesh->num_color_sets = 0;
+    for(unsigned int k=0; k < AI_MAX_NUMBER_OF_COLOR_SETS; ++k) {
+        if(c_mesh->mColors[k] != NULL) py_mesh->num_color_sets++; else break;
+    }
+
+    if (py_mesh->num_color_sets > 0) {
+        py_mesh->colors = PyList_New(py_mesh->num_color_sets);
+        if (!py_mesh->colors) goto fail_mesh;
+
+        for(unsigned int k=0; k < py_mesh->num_color_sets; ++k) {
+             // Colors are aiColor4D (r,g,b,a) -> 4 packed floats
+             PyObject *memview = float_memoryview(c_mesh->mColors[k], py_mesh->num_vertices, 4, sizeof(struct aiColor4D), owner);
+             if (!memview) goto fail_mesh;
+             PyList_SET_ITEM(py_mesh->colors, k, memview); // Steals ref
+        }
+    } else {
+         Py_INCREF(Py_None); py_mesh->colors = Py_None;
+    }
+
+    // --- Texture Coordinates ---
+    py_mesh->num_texcoord_sets = 0;
+    for(unsigned int k=0; k < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++k) {
+        if(c_mesh->mTextureCoords[k] != NULL) py_mesh->num_texcoord_sets++; else break;
+    }
+
+    if (py_mesh->num_texcoord_sets > 0) {
+        py_mesh->texcoords = PyList_New(py_mesh->num_texcoord_sets);
+         if (!py_mesh->texcoords) goto fail_mesh;
+        py_mesh->num_uv_components = PyList_New(py_mesh->num_texcoord_sets);
+         if (!py_mesh->num_uv_components) goto fail_mesh;
+
+        for(unsigned int k=0; k < py_mesh->num_texcoord_sets; ++k) {
+             unsigned int ncomp = c_mesh->mNumUVComponents[k]; // 1, 2 or 3
+             PyObject *comp_obj = PyLong_FromUnsignedLong(ncomp);
+             if (!comp_obj) goto fail_mesh;
+             PyList_SET_ITEM(py_mesh->num_uv_components, k, comp_obj); // Steals ref
+
+             // Texcoords live in aiVector3D arrays, only the first ncomp components are used
+             PyObject *memview = attribute_memoryview(c_mesh->mTextureCoords[k], py_mesh->num_vertices, ncomp, sizeof(struct aiVector3D),
+                                                 opts->texcoords, owner);
+             if (!memview) goto fail_mesh;
+             PyList_SET_ITEM(py_mesh->texcoords, k, memview); // Steals ref
+        }
+    } else {
+         Py_INCREF(Py_None); py_mesh->texcoords = Py_None;
+         py_mesh->num_uv_components = PyList_New(0); // Empty list if no texcoords
+         if (!py_mesh->num_uv_components) goto fail_mesh;
+    }
+
+    // --- Bones ---
+    py_mesh->num_bones = c_mesh->mNumBones;
+    py_mesh->bone_names = PyList_New(c_mesh->mNumBones);
+    if (!py_mesh->bone_names) goto fail_mesh;
+    for (unsigned int b = 0; b < c_mesh->mNumBones; ++b) {
+        PyObject *bone_name = PyUnicode_FromString(c_mesh->mBones[b]->mName.data);
+        if (!bone_name) goto fail_mesh;
+        PyList_SET_ITEM(py_mesh->bone_names, b, bone_name); // Steals ref
+    }
+
+    if (c_mesh->mNumBones > 0) {
+        // Offset matrices, row-major like every aiMatrix4x4
+        float *matrices = (float *)malloc(c_mesh->mNumBones * sizeof(struct aiMatrix4x4));
+        if (!matrices) { PyErr_NoMemory(); goto fail_mesh; }
+        for (unsigned int b = 0; b < c_mesh->mNumBones; ++b) {
+            memcpy(matrices + b * 16, &c_mesh->mBones[b]->mOffsetMatrix, sizeof(struct aiMatrix4x4));
+        }
+        Py_ssize_t matrices_shape[3] = {c_mesh->mNumBones, 4, 4};
+        py_mesh->bone_offset_matrices = buffer_memoryview(matrices, 3, matrices_shape, NULL, "f", sizeof(float), NULL);
+        if (!py_mesh->bone_offset_matrices) goto fail_mesh;
+
+        // Weights are stored per bone, gather them per vertex into K slots where
+        // K is the most weights any vertex has (at most 4 with Process_LimitBoneWeights)
+        size_t num_vertices = c_mesh->mNumVertices;
+        int compact_joints = c_mesh->mNumBones <= 65536;
+        Py_ssize_t joint_size = compact_joints ? sizeof(uint16_t) : sizeof(uint32_t);
+        unsigned int *counts = (unsigned int *)malloc(num_vertices * sizeof(unsigned int) + 1);
+        if (!counts) { PyErr_NoMemory(); goto fail_mesh; }
+        unsigned int width = max_bone_influences(c_mesh, counts);
+        void *joints = malloc(num_vertices * width * joint_size + 1);
+        float *weights = (float *)malloc(num_vertices * width * sizeof(float) + 1);
+        if (!joints || !weights) {
+            free(counts);
+            free(joints);
+            free(weights);
+            PyErr_NoMemory();
+            goto fail_mesh;
+        }
+        Py_BEGIN_ALLOW_THREADS
+        pack_bone_weights(c_mesh, width, joints, compact_joints, weights, counts);
+        Py_END_ALLOW_THREADS
+        free(counts);
+
+        py_mesh->joint_indices = create_memoryview(joints, num_vertices, width, 0, compact_joints ? "H" : "I", joint_size, NULL);
+        if (!py_mesh->joint_indices) {
+            free(weights);
+            goto fail_mesh;
+        }
+        py_mesh->joint_weights = create_memoryview(weights, num_vertices, width, 0, "f", sizeof(float), NULL);
+        if (!py_mesh->joint_weights) goto fail_mesh;
+    } else {
+        Py_INCREF(Py_None); py_mesh->bone_offset_matrices = Py_None;
+        Py_INCREF(Py_None); py_mesh->joint_indices = Py_None;
+        Py_INCREF(Py_None); py_mesh->joint_weights = Py_None;
+    }
+
+    if (!py_mesh->position_scale) {
+        Py_INCREF(Py_None); py_mesh->position_scale = Py_None;
+        Py_INCREF(Py_None); py_mesh->position_offset = Py_None;
+    }
+
+    if (opts->allocated) {
+        PyObject *arrays[] = {py_mesh->indices, py_mesh->face_offsets, py_mesh->vertices, py_mesh->normals,
+                              py_mesh->tangents, py_mesh->bitangents, py_mesh->colors, py_mesh->texcoords,
+                              py_mesh->bone_offset_matrices, py_mesh->joint_indices, py_mesh->joint_weights};
+        for (size_t i = 0; i < sizeof(arrays) / sizeof(arrays[0]); ++i) {
+            *opts->allocated += allocated_bytes(arrays[i]);
+        }
+    }
+    return (PyObject *)py_mesh;
+
+fail_mesh:
+    Py_DECREF(py_mesh); // Mesh_dealloc clears the members set so far
+    return NULL;
+}
+
+// Process meshes from aiScene into a Python list of Mesh objects, see process_mesh.
+// Returns a new reference to the list, or NULL on error.
+static PyObject* process_meshes(const struct aiScene *c_scene, PyObject *owner, const ConvertOptions *opts) {
+    unsigned int num_meshes = c_scene->mNumMeshes;
+    PyObject *py_meshes_list = PyList_New(num_meshes);
+    if (!py_meshes_list) return NULL;
+
+    for (unsigned int i = 0; i < num_meshes; ++i) {
+        PyObject *py_mesh = process_mesh(c_scene->mMeshes[i], owner, opts);
+        if (!py_mesh) {
+            Py_DECREF(py_meshes_list);
+            return NULL;
+        }
+        PyList_SET_ITEM(py_meshes_list, i, py_mesh); // Steals ref
+    }
+    return py_meshes_list;
+}
+
+
+// Recursively process Assimp nodes and build the Python Node hierarchy
+// Returns a NEW reference to the created Node or NULL on error
+static PyObject* process_node_recursive(struct aiNode* c_node) {
+    if (!c_node) { // Should not happen for root, but check anyway
+        PyErr_SetString(PyExc_ValueError, "Encountered NULL aiNode during processing");
+        return NULL;
+    }
+
+    // 1. Create Python Node object
+    Node* py_node = (Node*)NodeType.tp_alloc(&NodeType, 0);
+    if (!py_node) return NULL; // Allocation failed (MemoryError likely set)
+
+    // 2. Populate Simple Members
+    py_node->name = PyUnicode_FromString(c_node->mName.data);
+    if (!py_node->name) goto node_proc_error;
+
+    py_node->transformation = tuple_from_matrix4x4(&c_node->mTransformation);
+    if (!py_node->transformation) goto node_proc_error;
+
+    // Parent Name (or None for root)
+    if (c_node->mParent) {
+        py_node->parent_name = PyUnicode_FromString(c_node->mParent->mName.data);
+        if (!py_node->parent_name) goto node_proc_error;
+    } else {
+        Py_INCREF(Py_None);
+        py_node->parent_name = Py_None;
+    }
+
+    // Mesh Indices
+    py_node->num_meshes = c_node->mNumMeshes;
+    py_node->mesh_indices = tuple_from_uint_array(c_node->mMeshes, c_node->mNumMeshes);
+    if (!py_node->mesh_indices) goto node_proc_error;
+
+    // 3. Populate Children (Recursive Step)
+    py_node->num_children = c_node->mNumChildren;
+    py_node->children = PyList_New(py_node->num_children);
+    if (!py_node->children) goto node_proc_error;
+
+    for (unsigned int i = 0; i < py_node->num_children; ++i) {
+        // Recursively process child
+        PyObject* py_child = process_node_recursive(c_node->mChildren[i]);
+        if (!py_child) {
+            // Error occurred deeper in recursion
+            goto node_proc_error; // Children list and self will be cleaned up
+        }
+        // PyList_SET_ITEM steals the reference to py_child
+        if (PyList_SetItem(py_node->children, i, py_child) < 0) {
+            Py_DECREF(py_child); // Decref if SET_ITEM failed
+            goto node_proc_error;
+        }
+    }
+
+    // Success
+    return (PyObject*)py_node;
+
+// Error handling: clean up partially created node
+node_proc_error:
+    Py_DECREF(py_node); // This calls Node_dealloc which Py_CLEARs members
+    return NULL;
+}
+
+// Flatten the node hierarchy into a dictionary of arrays, see NodeTable.
+// Returns a new reference to the dictionary, or NULL on error.
+static PyObject* process_node_table(const struct aiNode *root) {
+    NodeTable table;
+    int err;
+    Py_BEGIN_ALLOW_THREADS
+    err = build_node_table(root, &table);
+    Py_END_ALLOW_THREADS
+    if (err < 0) return PyErr_NoMemory();
+
+    Py_ssize_t n = (Py_ssize_t)table.num_nodes;
+    struct {
+        const char *key;
+        void **data;
+        int ndim;
+        Py_ssize_t shape[3];
+        const char *format;
+        Py_ssize_t itemsize;
+    } columns[] = {
+        {"parent_index", (void **)&table.parent_index, 1, {n}, "i", sizeof(int32_t)},
+        {"transforms", (void **)&table.transforms, 3, {n, 4, 4}, "f", sizeof(float)},
+        {"world_transforms", (void **)&table.world_transforms, 3, {n, 4, 4}, "f", sizeof(float)},
+        {"name_offsets", (void **)&table.name_offsets, 1, {n + 1}, "I", sizeof(uint32_t)},
+        {"names", (void **)&table.names, 1, {table.name_offsets[n]}, "B", 1},
+        {"mesh_offsets", (void **)&table.mesh_offsets, 1, {n + 1}, "I", sizeof(uint32_t)},
+        {"mesh_indices", (void **)&table.mesh_indices, 1, {table.mesh_offsets[n]}, "I", sizeof(uint32_t)},
+    };
+
+    PyObject *dict = PyDict_New();
+    if (!dict) {
+        free_node_table(&table);
+        return NULL;
+    }
+    for (size_t c = 0; c < sizeof(columns) / sizeof(columns[0]); ++c) {
+        // The memoryview owns the array from here on, also if it fails
+        PyObject *column = buffer_memoryview(*columns[c].data, columns[c].ndim, columns[c].shape, NULL,
+                                             columns[c].format, columns[c].itemsize, NULL);
+        *columns[c].data = NULL;
+        if (!column || PyDict_SetItemString(dict, columns[c].key, column) < 0) {
+            Py_XDECREF(column);
+            Py_DECREF(dict);
+            free_node_table(&table);
+            return NULL;
+        }
+        Py_DECREF(column);
+    }
+    return dict;
+}
+
+// --- LazySequence Type Definition ---
+// Read-only sequence over the meshes or materials of a retained aiScene for
+// lazy imports. Each item is converted on first access and then cached, so
+// the cost of an import follows what is actually used.
+typedef struct LazySequence LazySequence;
+
+// Converts item `index` of the sequence's aiScene. Returns a NEW reference or NULL.
+typedef PyObject* (*LazyItemFunc)(LazySequence *seq, Py_ssize_t index);
+
+struct LazySequence {
+    PyObject_HEAD
+    PyObject *owner;                // Capsule retaining c_scene
+    const struct aiScene *c_scene;
+    ConvertOptions opts;
+    LazyItemFunc convert;
+    Py_ssize_t length;
+    PyObject **items;               // Converted items, NULL until first accessed
+};
+
+static PyObject* lazy_mesh(LazySequence *seq, Py_ssize_t index) {
+    return process_mesh(seq->c_scene->mMeshes[index], seq->opts.zero_copy ? seq->owner : NULL, &seq->opts);
+}
+
+static PyObject* lazy_animation(LazySequence *seq, Py_ssize_t index) {
+    return process_animation(seq->c_scene->mAnimations[index]);
+}
+
+static PyObject* lazy_material(LazySequence *seq, Py_ssize_t index) {
+    struct aiMaterial *mat = seq->c_scene->mMaterials[index];
+    return seq->opts.typed_materials ? process_typed_material(mat, seq->owner) : process_material(mat);
+}
+
+// Returns a NEW reference to a LazySequence of `length` items, or NULL on error
+static PyObject* lazy_sequence_new(PyObject *owner, const struct aiScene *c_scene, const ConvertOptions *opts,
+                                   LazyItemFunc convert, Py_ssize_t length) {
+    LazySequence *seq = (LazySequence *)LazySequenceType.tp_alloc(&LazySequenceType, 0);
+    if (!seq) return NULL;
+    seq->items = (PyObject **)PyMem_Calloc(length ? length : 1, sizeof(PyObject *));
+    if (!seq->items) {
+        Py_DECREF(seq);
+        return PyErr_NoMemory();
+    }
+    Py_INCREF(owner);
+    seq->owner = owner;
+    seq->c_scene = c_scene;
+    seq->opts = *opts;
+    seq->convert = convert;
+    seq->length = length;
+    return (PyObject *)seq;
+}
+
+static void LazySequence_dealloc(LazySequence *self) {
+    if (self->items) {
+        for (Py_ssize_t i = 0; i < self->length; ++i) {
+            Py_XDECREF(self->items[i]);
+        }
+        PyMem_Free(self->items);
+    }
+    Py_CLEAR(self->owner);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static Py_ssize_t LazySequence_length(LazySequence *self) {
+    return self->length;
+}
+
+static PyObject* LazySequence_item(LazySequence *self, Py_ssize_t index) {
+    if (index < 0 || index >= self->length) {
+        PyErr_SetString(PyExc_IndexError, "index out of range");
+        return NULL;
+    }
+    if (!self->items[index]) {
+        PyObject *item = self->convert(self, index);
+        if (!item) return NULL;
+        // Conversion may release the GIL, another thread can have got there first
+        if (self->items[index]) {
+            Py_DECREF(item);
+        } else {
+            self->items[index] = item;
+        }
+    }
+    Py_INCREF(self->items[index]);
+    return self->items[index];
+}
+
+static PyObject* LazySequence_subscript(LazySequence *self, PyObject *key) {
+    if (PyIndex_Check(key)) {
+        Py_ssize_t index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+        if (index == -1 && PyErr_Occurred()) return NULL;
+        if (index < 0) index += self->length;
+        return LazySequence_item(self, index);
+    }
+    if (PySlice_Check(key)) {
+        Py_ssize_t start, stop, step;
+        if (PySlice_Unpack(key, &start, &stop, &step) < 0) return NULL;
+        Py_ssize_t count = PySlice_AdjustIndices(self->length, &start, &stop, step);
+        PyObject *list = PyList_New(count);
+        if (!list) return NULL;
+        for (Py_ssize_t i = 0, index = start; i < count; ++i, index += step) {
+            PyObject *item = LazySequence_item(self, index);
+            if (!item) {
+                Py_DECREF(list);
+                return NULL;
+            }
+            PyList_SET_ITEM(list, i, item); // Steals ref
+        }
+        return list;
+    }
+    PyErr_Format(PyExc_TypeError, "indices must be integers or slices, not %.200s", Py_TYPE(key)->tp_name);
+    return NULL;
+}
+
+static PyObject* LazySequence_repr(LazySequence *self) {
+    Py_ssize_t converted = 0;
+    for (Py_ssize_t i = 0; i < self->length; ++i) {
+        converted += self->items[i] != NULL;
+    }
+    return PyUnicode_FromFormat("<LazySequence of %zd items, %zd converted>", self->length, converted);
+}
+
+static PySequenceMethods LazySequence_as_sequence = {
+    .sq_length = (lenfunc)LazySequence_length,
+    .sq_item = (ssizeargfunc)LazySequence_item,
+};
+
+static PyMappingMethods LazySequence_as_mapping = {
+    .mp_length = (lenfunc)LazySequence_length,
+    .mp_subscript = (binaryfunc)LazySequence_subscript,
+};
+
+static PyTypeObject LazySequenceType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "assimp_py.LazySequence",
+    .tp_doc = "Read-only sequence converting scene items on first access",
+    .tp_basicsize = sizeof(LazySequence),
+    .tp_itemsize = 0,
+#ifdef Py_TPFLAGS_SEQUENCE
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_SEQUENCE,
+#else
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+#endif
+    .tp_dealloc = (destructor)LazySequence_dealloc,
+    .tp_repr = (reprfunc)LazySequence_repr,
+    .tp_as_sequence = &LazySequence_as_sequence,
+    .tp_as_mapping = &LazySequence_as_mapping,
+};
+
+
+// Destructor of the capsule retaining an aiScene for zero-copy buffers
+static void scene_capsule_destructor(PyObject *capsule) {
+    const struct aiScene *c_scene = (const struct aiScene *)PyCapsule_GetPointer(capsule, "assimp_py.aiScene");
+    aiReleaseImport(c_scene);
+}
+
+// Builds the Scene.import_stats dictionary from the import's ImportStats and
+// the measurements of the conversion
+static PyObject* process_import_stats(const ImportStats *stats, double convert_seconds, Py_ssize_t convert_allocated) {
+    PyObject *postprocess = PyDict_New();
+    if (!postprocess) return NULL;
+    for (unsigned int i = 0; i < stats->num_steps; ++i) {
+        PyObject *seconds = PyFloat_FromDouble(stats->steps[i].seconds);
+        if (!seconds || PyDict_SetItemString(postprocess, stats->steps[i].name, seconds) < 0) {
+            Py_XDECREF(seconds);
+            Py_DECREF(postprocess);
+            return NULL;
+        }
+        Py_DECREF(seconds);
+    }
+
+    const struct aiMemoryInfo *m = &stats->memory;
+    return Py_BuildValue("{s:d,s:d,s:d,s:N,s:d,s:d,s:n,s:{s:I,s:I,s:I,s:I,s:I,s:I,s:I,s:I}}",
+                         "detect", stats->detect,
+                         "read", stats->read,
+                         "preprocess", stats->preprocess,
+                         "postprocess", postprocess,
+                         "import", stats->total,
+                         "convert", convert_seconds,
+                         "convert_allocated", convert_allocated,
+                         "memory",
+                         "textures", m->textures, "materials", m->materials, "meshes", m->meshes, "nodes", m->nodes,
+                         "animations", m->animations, "cameras", m->cameras, "lights", m->lights, "total", m->total);
+}
+
+// Convert an imported aiScene into a Python Scene. Takes ownership of
+// `c_scene`: it is either released before returning or, with `opts->zero_copy`
+// or `opts->lazy`, retained by the Scene for as long as any of its buffers or
+// lazy sequences are alive.
+// Returns a NEW reference to the Scene or NULL on error.
+static PyObject* build_scene(const struct aiScene *c_scene, const ConvertOptions *opts, const ImportStats *stats) {
+    PyObject *owner = NULL;
+    Scene *py_scene = NULL;
+    double convert_start = stats ? monotonic_seconds() : 0.0;
+    // Arrays allocated by this conversion. Lazy sequences keep a copy of the
+    // options, which must not point here.
+    Py_ssize_t allocated = 0;
+    ConvertOptions counted = *opts;
+    counted.allocated = stats ? &allocated : NULL;
+
+    if (opts->zero_copy || opts->lazy || opts->typed_materials || opts->retain_scene) {
+        owner = PyCapsule_New((void *)c_scene, "assimp_py.aiScene", scene_capsule_destructor);
+        if (!owner) {
+            aiReleaseImport(c_scene);
+            return NULL;
+        }
+    }
+
+    // Create the Python Scene object
+    py_scene = (Scene *)SceneType.tp_alloc(&SceneType, 0);
+    if (!py_scene) {
+        goto fail; // Error already set (likely MemoryError)
+    }
+    // The Scene holds the capsule, so the aiScene lives at least as long as it
+    py_scene->c_scene = owner;
+    owner = NULL;
+
+    py_scene->num_meshes = c_scene->mNumMeshes;
+    py_scene->num_materials = c_scene->mNumMaterials;
+
+    // Process Meshes and Materials, or defer it until they are accessed
+    if (opts->lazy) {
+        py_scene->meshes = lazy_sequence_new(py_scene->c_scene, c_scene, opts, lazy_mesh, c_scene->mNumMeshes);
+        py_scene->materials = py_scene->meshes ?
+            lazy_sequence_new(py_scene->c_scene, c_scene, opts, lazy_material, c_scene->mNumMaterials) : NULL;
+        py_scene->animations = py_scene->materials ?
+            lazy_sequence_new(py_scene->c_scene, c_scene, opts, lazy_animation,
+                              c_scene->mAnimations ? c_scene->mNumAnimations : 0) : NULL;
+    } else {
+        py_scene->meshes = process_meshes(c_scene, opts->zero_copy ? py_scene->c_scene : NULL, &counted);
+        py_scene->materials = py_scene->meshes ? process_materials(c_scene, py_scene->c_scene, opts) : NULL;
+        py_scene->animations = py_scene->materials ? process_animations(c_scene) : NULL;
+    }
+    if (!py_scene->meshes || !py_scene->materials || !py_scene->animations) {
+        goto fail; // Error occurred during mesh, material or animation processing
+    }
+    py_scene->num_animations = c_scene->mAnimations ? c_scene->mNumAnimations : 0;
+    py_scene->num_textures = c_scene->mNumTextures;
+    py_scene->textures = process_textures((struct aiScene *)c_scene, py_scene->c_scene);
+    if (!py_scene->textures) {
+        goto fail;
+    }
+
+    // **** Process Node Hierarchy ****
+    if (opts->node_table) {
+        py_scene->node_table = process_node_table(c_scene->mRootNode);
+        if (!py_scene->node_table) {
+            goto fail;
+        }
+        PyObject *column;
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(py_scene->node_table, &pos, NULL, &column)) {
+            allocated += allocated_bytes(column);
+        }
+        Py_INCREF(Py_None);
+        py_scene->root_node = Py_None;
+    } else if (c_scene->mRootNode) {
+        Py_INCREF(Py_None);
+        py_scene->node_table = Py_None;
+        py_scene->root_node = process_node_recursive(c_scene->mRootNode);
+        if (!py_scene->root_node) {
+            // Error occurred during node processing
+            goto fail;
+        }
+    } else {
+        // Should not happen if aiImportFile succeeded, but handle defensively
+        Py_INCREF(Py_None);
+        py_scene->root_node = Py_None;
+        Py_INCREF(Py_None);
+        py_scene->node_table = Py_None;
+    }
+
+    // Success! Release the C scene unless the Scene retains it
+    if (!py_scene->c_scene) {
+        Py_BEGIN_ALLOW_THREADS
+        aiReleaseImport(c_scene);
+        Py_END_ALLOW_THREADS
+    }
+    if (stats) {
+        py_scene->import_stats = process_import_stats(stats, monotonic_seconds() - convert_start, allocated);
+        if (!py_scene->import_stats) {
+            Py_DECREF(py_scene); // The aiScene is already released
+            return NULL;
+        }
+    } else {
+        Py_INCREF(Py_None);
+        py_scene->import_stats = Py_None;
+    }
     return (PyObject *)py_scene;
 
 fail:
-    // Cleanup on error
-    aiReleaseImport(c_scene);
-    Py_XDECREF(py_scene); // Use XDECREF as py_scene might be NULL if allocation failed
+    // Cleanup on error. A retained scene is released with its capsule.
+    if (owner) {
+        Py_DECREF(owner);
+    } else if (!py_scene || !py_scene->c_scene) {
+        aiReleaseImport(c_scene);
+    }
+    Py_XDECREF(py_scene); // Use XDECREF as py_scene might be NULL if allocation failed
+    return NULL;
+}
+
+// --- CancelToken Type Definition ---
+// Cancels the imports it is passed to from any thread. The flag itself lives
+// in C++ so the imports can poll it without the GIL.
+typedef struct {
+    PyObject_HEAD
+    CancelFlag *flag;
+} CancelToken;
+
+static PyObject* CancelToken_new(PyTypeObject *type, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, ":CancelToken", kwlist)) {
+        return NULL;
+    }
+    CancelToken *self = (CancelToken *)type->tp_alloc(type, 0);
+    if (!self) return NULL;
+    self->flag = cancel_flag_create();
+    if (!self->flag) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    return (PyObject *)self;
+}
+
+static void CancelToken_dealloc(CancelToken *self) {
+    cancel_flag_destroy(self->flag);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject* CancelToken_cancel(CancelToken *self, PyObject *Py_UNUSED(ignored)) {
+    cancel_flag_set(self->flag);
+    Py_RETURN_NONE;
+}
+
+static PyObject* CancelToken_get_cancelled(CancelToken *self, void *closure) {
+    return PyBool_FromLong(cancel_flag_is_set(self->flag));
+}
+
+static PyMethodDef CancelToken_methods[] = {
+    {"cancel", (PyCFunction)CancelToken_cancel, METH_NOARGS,
+     "Cancel every import using this token. Running imports stop at their next progress checkpoint."},
+    {NULL} /* Sentinel */
+};
+
+static PyGetSetDef CancelToken_getset[] = {
+    {"cancelled", (getter)CancelToken_get_cancelled, NULL, "Whether cancel() was called", NULL},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject CancelTokenType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "assimp_py.CancelToken",
+    .tp_doc = "CancelToken()\n--\n\nThread-safe token cancelling the imports it is passed to",
+    .tp_basicsize = sizeof(CancelToken),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_new = CancelToken_new,
+    .tp_dealloc = (destructor)CancelToken_dealloc,
+    .tp_methods = CancelToken_methods,
+    .tp_getset = CancelToken_getset,
+};
+
+// --- ImportCache Type Definition ---
+// On-disk cache of post-processed scenes for import_file, see import_cache.h
+typedef struct {
+    PyObject_HEAD
+    ImportCache *cache;
+} PyImportCache;
+
+static PyObject* ImportCache_new(PyTypeObject *type, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"directory", "max_bytes", NULL};
+    PyObject *directory = NULL;
+    unsigned long long max_bytes = 1ULL << 30;
+    char error[512] = "";
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|K:ImportCache", kwlist, PyUnicode_FSConverter, &directory,
+                                     &max_bytes)) {
+        return NULL;
+    }
+    PyImportCache *self = (PyImportCache *)type->tp_alloc(type, 0);
+    if (!self) {
+        Py_DECREF(directory);
+        return NULL;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    self->cache = import_cache_open(PyBytes_AS_STRING(directory), max_bytes, error, sizeof(error));
+    Py_END_ALLOW_THREADS
+    if (!self->cache) {
+        PyErr_Format(PyExc_OSError, "Cannot open the import cache '%s': %s", PyBytes_AS_STRING(directory), error);
+        Py_DECREF(directory);
+        Py_DECREF(self);
+        return NULL;
+    }
+    Py_DECREF(directory);
+    return (PyObject *)self;
+}
+
+static void ImportCache_dealloc(PyImportCache *self) {
+    if (self->cache) import_cache_close(self->cache);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject* ImportCache_clear(PyImportCache *self, PyObject *Py_UNUSED(ignored)) {
+    Py_BEGIN_ALLOW_THREADS
+    import_cache_clear(self->cache);
+    Py_END_ALLOW_THREADS
+    Py_RETURN_NONE;
+}
+
+static PyObject* ImportCache_get_stats(PyImportCache *self, void *closure) {
+    ImportCacheStats stats;
+    import_cache_get_stats(self->cache, &stats);
+    return Py_BuildValue("{s:K,s:K,s:K,s:K,s:K,s:K,s:K}",
+                         "hits", (unsigned long long)stats.hits,
+                         "misses", (unsigned long long)stats.misses,
+                         "stores", (unsigned long long)stats.stores,
+                         "evictions", (unsigned long long)stats.evictions,
+                         "entries", (unsigned long long)stats.entries,
+                         "bytes", (unsigned long long)stats.bytes,
+                         "max_bytes", (unsigned long long)stats.max_bytes);
+}
+
+static PyMethodDef ImportCache_methods[] = {
+    {"clear", (PyCFunction)ImportCache_clear, METH_NOARGS, "Remove every entry from the cache directory."},
+    {NULL} /* Sentinel */
+};
+
+static PyGetSetDef ImportCache_getset[] = {
+    {"stats", (getter)ImportCache_get_stats, NULL,
+     "Dict of hits, misses, stores, evictions, entries, bytes and max_bytes", NULL},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject ImportCacheType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "assimp_py.ImportCache",
+    .tp_doc = "ImportCache(directory, max_bytes=1 << 30)\n--\n\n"
+              "On-disk cache of post-processed scenes, for import_file(cache=...).\n"
+              "Least recently used entries are evicted beyond max_bytes.",
+    .tp_basicsize = sizeof(PyImportCache),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_new = ImportCache_new,
+    .tp_dealloc = (destructor)ImportCache_dealloc,
+    .tp_methods = ImportCache_methods,
+    .tp_getset = ImportCache_getset,
+};
+
+// --- ImportIterator Type Definition ---
+// Iterator over the results of import_files, in completion order.
+typedef struct {
+    PyObject_HEAD
+    ImportPool *pool;
+    PyObject *paths;    // Tuple of the path objects as passed in
+    PyObject *cancel;   // CancelToken whose flag the pool watches, or NULL
+    ConvertOptions opts;
+} ImportIterator;
+
+static void ImportIterator_dealloc(ImportIterator *self) {
+    if (self->pool) {
+        // Waits for the workers to finish the file they are on
+        Py_BEGIN_ALLOW_THREADS
+        import_pool_destroy(self->pool);
+        Py_END_ALLOW_THREADS
+        self->pool = NULL;
+    }
+    Py_CLEAR(self->paths);
+    Py_CLEAR(self->cancel); // Only once the pool is gone
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+// Returns a NEW reference to the pending exception, normalized, and clears it
+static PyObject* fetch_exception(void) {
+    PyObject *type, *value, *traceback;
+    PyErr_Fetch(&type, &value, &traceback);
+    PyErr_NormalizeException(&type, &value, &traceback);
+    if (traceback) {
+        PyException_SetTraceback(value, traceback);
+    }
+    Py_XDECREF(type);
+    Py_XDECREF(traceback);
+    return value;
+}
+
+// An exception raised by a callback on the import thread, kept as fetched so
+// it can be raised again with its traceback once the import returns
+typedef struct {
+    PyObject *type;
+    PyObject *value;
+    PyObject *traceback;
+} PendingError;
+
+// Moves the pending exception into `pending`, unless it already holds one
+static void pending_error_fetch(PendingError *pending) {
+    if (pending->type) {
+        PyErr_Clear();
+        return;
+    }
+    PyErr_Fetch(&pending->type, &pending->value, &pending->traceback);
+}
+
+// Raises the held exception, if any. Returns 1 if it did, 0 otherwise.
+static int pending_error_restore(PendingError *pending) {
+    if (!pending->type) return 0;
+    PyErr_Restore(pending->type, pending->value, pending->traceback);
+    pending->type = pending->value = pending->traceback = NULL;
+    return 1;
+}
+
+static void pending_error_clear(PendingError *pending) {
+    Py_CLEAR(pending->type);
+    Py_CLEAR(pending->value);
+    Py_CLEAR(pending->traceback);
+}
+
+static PyObject* ImportIterator_next(ImportIterator *self) {
+    ImportResult result;
+    int has_result;
+
+    Py_BEGIN_ALLOW_THREADS
+    has_result = import_pool_next(self->pool, &result);
+    Py_END_ALLOW_THREADS
+    if (!has_result) {
+        return NULL; // StopIteration
+    }
+
+    PyObject *path = PyTuple_GET_ITEM(self->paths, result.index);
+    PyObject *value = NULL;
+    PyObject *filename = PyOS_FSPath(path);
+    if (!filename) {
+        aiReleaseImport(result.scene);
+        return NULL;
+    }
+
+    // Errors are raised exactly as import_file would, then handed out as values
+    switch (result.status) {
+        case IMPORT_OK:
+            value = build_scene(result.scene, &self->opts, self->opts.stats ? &result.stats : NULL);
+            break;
+        case IMPORT_NOT_FOUND:
+            PyErr_SetObject(PyExc_FileNotFoundError, filename);
+            break;
+        default:
+            PyErr_Format(PyExc_RuntimeError, "Assimp error loading '%S': %s", filename, result.error);
+            break;
+        case IMPORT_CANCELLED:
+            PyErr_SetString(ImportCancelledError, "Import cancelled");
+            break;
+    }
+    Py_DECREF(filename);
+    if (!value) {
+        if (PyErr_ExceptionMatches(PyExc_MemoryError)) {
+            return NULL; // Don't try to carry on when out of memory
+        }
+        value = fetch_exception();
+        if (!value) return NULL;
+    }
+    return Py_BuildValue("(ON)", path, value);
+}
+
+static PyTypeObject ImportIteratorType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "assimp_py.ImportIterator",
+    .tp_doc = "Iterator over (path, Scene or exception) pairs from import_files, in completion order",
+    .tp_basicsize = sizeof(ImportIterator),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc = (destructor)ImportIterator_dealloc,
+    .tp_iter = PyObject_SelfIter,
+    .tp_iternext = (iternextfunc)ImportIterator_next,
+};
+
+
+// --- Module Methods ---
+
+// Progress state of one import, passed to the C++ progress handler as context
+typedef struct {
+    PyObject *callback;     // callable(progress: float), returns False to cancel
+    PendingError error;     // Exception raised by the callback
+} PyProgress;
+
+// Minimum seconds between two progress callbacks, each one waits for the GIL
+#define PROGRESS_INTERVAL 0.05
+
+// Called from the import thread without the GIL
+static int py_progress_update(void *ctx, float progress) {
+    PyProgress *py_progress = (PyProgress *)ctx;
+    PyGILState_STATE gil = PyGILState_Ensure();
+
+    PyObject *value = PyFloat_FromDouble(progress);
+    PyObject *result = value ? PyObject_CallFunctionObjArgs(py_progress->callback, value, NULL) : NULL;
+    int keep_going = result && result != Py_False;
+    Py_XDECREF(result);
+    Py_XDECREF(value);
+    if (PyErr_Occurred()) {
+        pending_error_fetch(&py_progress->error);
+    }
+
+    PyGILState_Release(gil);
+    return keep_going;
+}
+
+// Checks the progress and cancel arguments of the import functions and fills
+// `progress`. Returns 1 if the import needs a progress handler, 0 if neither
+// argument was given, or -1 with an exception set.
+static int init_progress(PyObject *callback, PyObject *cancel, PyProgress *py_progress, ImportProgress *progress) {
+    if (callback != Py_None && !PyCallable_Check(callback)) {
+        PyErr_SetString(PyExc_TypeError, "progress must be callable or None");
+        return -1;
+    }
+    if (cancel != Py_None && !PyObject_TypeCheck(cancel, &CancelTokenType)) {
+        PyErr_SetString(PyExc_TypeError, "cancel must be a CancelToken or None");
+        return -1;
+    }
+    py_progress->callback = callback;
+    py_progress->error.type = py_progress->error.value = py_progress->error.traceback = NULL;
+    progress->update = callback != Py_None ? py_progress_update : NULL;
+    progress->ctx = py_progress;
+    progress->interval = PROGRESS_INTERVAL;
+    progress->cancel = cancel != Py_None ? ((CancelToken *)cancel)->flag : NULL;
+    progress->stats = NULL;
+    progress->cancelled = 0;
+    return callback != Py_None || cancel != Py_None;
+}
+
+// Checks a thread count argument and stores it in `num_threads`. Returns 0,
+// or -1 with ValueError set if it is negative.
+static int check_num_threads(const char *name, int threads, unsigned int *num_threads) {
+    if (threads < 0) {
+        PyErr_Format(PyExc_ValueError, "%s must not be negative", name);
+        return -1;
+    }
+    *num_threads = (unsigned int)threads;
+    return 0;
+}
+
+// Raises the exception of an import stopped through its progress handler:
+// the callback's own exception, or ImportCancelled. Returns 1 if it was
+// stopped, 0 otherwise.
+static int raise_if_stopped(PyProgress *py_progress, const ImportProgress *progress) {
+    if (pending_error_restore(&py_progress->error)) {
+        return 1;
+    }
+    if (progress->cancelled) {
+        PyErr_SetString(ImportCancelledError, "Import cancelled");
+        return 1;
+    }
+    return 0;
+}
+
+PyDoc_STRVAR(import_file_doc,
+"import_file(filename: str, flags: int, *, zero_copy: bool = False, compact_indices: bool = False, normals: str = 'f32', texcoords: str = 'f32', quantize_positions: bool = False, lazy: bool = False, polygons: bool = False, typed_materials: bool = False, node_table: bool = False, stats: bool = False, retain_scene: bool = False, progress: Callable[[float], bool | None] | None = None, cancel: CancelToken | None = None, cache: ImportCache | None = None, threads: int = 1, fuse_steps: bool = False, mmap: bool = False) -> Scene\n"
+"--\n\n"
+"Imports the 3D model from the given filename.\n\n"
+"Args:\n"
+"    filename: Path to the model file.\n"
+"    flags: Post-processing flags (e.g., Process_Triangulate | Process_GenNormals).\n"
+"           Process_Triangulate is highly recommended for predictable index buffers.\n"
+"           Process_JoinIdenticalVertices is useful for reducing vertex count.\n"
+"           Process_CalcTangentSpace is needed if you require tangents/bitangents.\n"
+"           Process_GenSmoothNormals or Process_GenNormals if normals are missing.\n"
+"           Process_FlipUVs can be important depending on texture conventions.\n"
+"    zero_copy: Keep the Assimp scene alive and let the mesh memoryviews point\n"
+"           directly into its arrays instead of copying them. The scene is\n"
+"           freed once the Scene and every view into it are gone.\n"
+"           Only float32 attributes are borrowed, converted ones are copies.\n"
+"    compact_indices: Store indices as uint16 for meshes of at most 65536\n"
+"           vertices, uint32 otherwise.\n"
+"    normals: Format of normals, tangents and bitangents: 'f32', 'f16' or\n"
+"           'snorm16' (int16, value * 32767).\n"
+"    texcoords: Format of texture coordinates: 'f32' or 'f16'.\n"
+"    quantize_positions: Store vertices as uint16 over the bounding box of\n"
+"           each mesh; position = vertices * mesh.position_scale +\n"
+"           mesh.position_offset.\n"
+"    lazy: Keep the Assimp scene alive and make Scene.meshes and\n"
+"           Scene.materials sequences that convert each item on first\n"
+"           access. Mesh errors are then raised on access.\n"
+"    polygons: Accept faces that are not triangles. Mesh.indices then holds\n"
+"           the indices of all faces back to back and Mesh.face_offsets\n"
+"           where each face starts (CSR layout).\n"
+"    typed_materials: Keep the Assimp scene alive and return Material\n"
+"           objects with typed PBR/Phong parameters and texture slots\n"
+"           instead of property dictionaries (see Scene.material_table).\n"
+"    node_table: Build Scene.node_table, flat arrays of the node hierarchy\n"
+"           (parents, local and world transforms, names, mesh references),\n"
+"           instead of the Node object tree; root_node is then None.\n"
+"    stats: Time the import stages (format detection, reading, each\n"
+"           post-processing step, conversion) and record the memory of the\n"
+"           imported scene in Scene.import_stats.\n"
+"    retain_scene: Keep the Assimp scene alive with the Scene, so that it\n"
+"           can be exported with export().\n"
+"    progress: Called with the estimated progress, from 0 to 1, at most\n"
+"           every 50 ms. Returning False cancels the import.\n"
+"    cancel: CancelToken cancelling the import from another thread.\n"
+"           Imports stop at the next progress checkpoint: before and after\n"
+"           parsing (OBJ files also while parsing) and between\n"
+"           post-processing steps.\n"
+"    cache: ImportCache to read the post-processed scene from, skipping\n"
+"           parsing and post-processing, or to store it in.\n"
+"    threads: Number of threads the importer may use, 0 for one per\n"
+"           hardware thread. glTF 2 files build their meshes in parallel,\n"
+"           and so do the per-mesh post-processing steps (Triangulate,\n"
+"           GenSmoothNormals, CalcTangentSpace, JoinIdenticalVertices,\n"
+"           ImproveCacheLocality). The scene does not depend on the number\n"
+"           of threads.\n"
+"    fuse_steps: Run consecutive per-mesh post-processing steps (the ones\n"
+"           listed for threads) back to back on each mesh, in one pass over\n"
+"           the meshes, instead of one pass per step. The scene is the\n"
+"           same; with stats=True such a pass is timed as 'MeshPass'.\n"
+"    mmap: Read the model and its secondary files through read-only memory\n"
+"           mappings, which most binary formats, binary FBX and XML parse in\n"
+"           place instead of copying. Only use it for files nothing\n"
+"           truncates during the import: reading a page lost to truncation\n"
+"           kills the process with SIGBUS (an access violation on Windows)\n"
+"           instead of raising an error.\n\n"
+"Returns:\n"
+"    A Scene object containing the loaded data.\n\n"
+"Raises:\n"
+"    FileNotFoundError: If the file does not exist.\n"
+"    RuntimeError: If Assimp fails to load the file.\n"
+"    ImportCancelled: If the import was cancelled.\n"
+"    Any exception raised by the progress callback.\n"
+"    MemoryError: If memory allocation fails.\n"
+"    ValueError: If arguments are invalid or mesh data is inconsistent (e.g., non-triangulated without polygons=True).");
+
+static PyObject* py_import_file(PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"filename", "flags", "progress", "cancel", "cache", "threads", "fuse_steps", "mmap",
+                             NULL};
+    const char* filename = NULL;
+    unsigned int flags = 0;
+    ImportConfig config = {1, 0, 0};
+    PyObject *callback = Py_None;
+    PyObject *cancel = Py_None;
+    PyObject *cache = Py_None;
+    int threads = 1;
+    ConvertOptions opts;
+    PyObject *rest = NULL;
+    const struct aiScene *c_scene = NULL;
+    PyProgress py_progress;
+    ImportProgress progress;
+    char error[512] = "";
+
+    if (parse_convert_options(kwds, &opts, &rest) < 0) {
+        return NULL;
+    }
+    int parsed = PyArg_ParseTupleAndKeywords(args, rest, "sI|$OOOipp:import_file", kwlist, &filename, &flags,
+                                             &callback, &cancel, &cache, &threads, &config.fuse_mesh_steps,
+                                             &config.map_files);
+    Py_XDECREF(rest);
+    if (!parsed) {
+        // Error already set by PyArg_ParseTupleAndKeywords
+        return NULL;
+    }
+    if (check_num_threads("threads", threads, &config.num_threads) < 0) {
+        return NULL;
+    }
+    if (cache != Py_None && !PyObject_TypeCheck(cache, &ImportCacheType)) {
+        PyErr_SetString(PyExc_TypeError, "cache must be an ImportCache or None");
+        return NULL;
+    }
+    int has_progress = init_progress(callback, cancel, &py_progress, &progress);
+    if (has_progress < 0) {
+        return NULL;
+    }
+    ImportStats stats;
+    if (opts.stats) {
+        progress.stats = &stats;
+        has_progress = 1;
+    }
+
+    // Basic check if file exists before calling Assimp
+    // Use Python's built-in os.path.exists for better cross-platform compatibility?
+    // For C extension, fopen is reasonable.
+    FILE *f = NULL;
+    Py_BEGIN_ALLOW_THREADS
+    f = fopen(filename, "rb"); // Use "rb" for binary check
+    if (f) fclose(f);
+    Py_END_ALLOW_THREADS
+    if (!f) {
+        // Map C's file not found to Python's FileNotFoundError
+        // Note: Python 3.3+ needed for FileNotFoundError. Use IOError for older.
+        PyErr_SetString(PyExc_FileNotFoundError, filename);
+        return NULL;
+    }
+
+    // Import the file using Assimp. The import and all post-processing steps
+    // only touch Assimp data, so the GIL is released to let other Python
+    // threads (e.g. a ThreadPoolExecutor running more imports) proceed.
+    // The progress callback takes it back only while it runs.
+    Py_BEGIN_ALLOW_THREADS
+    if (cache != Py_None) {
+        c_scene = import_path_cached(((PyImportCache *)cache)->cache, filename, flags, &config,
+                                     has_progress ? &progress : NULL, error, sizeof(error));
+    } else {
+        c_scene = import_path(filename, flags, &config, has_progress ? &progress : NULL, error, sizeof(error));
+    }
+    Py_END_ALLOW_THREADS
+
+    if (has_progress && raise_if_stopped(&py_progress, &progress)) {
+        aiReleaseImport(c_scene);
+        return NULL;
+    }
+    // Check for Assimp loading errors
+    if (!c_scene) {
+        PyErr_Format(PyExc_RuntimeError, "Assimp error loading '%s': %s", filename, error);
+        return NULL;
+    }
+
+    return build_scene(c_scene, &opts, opts.stats ? &stats : NULL);
+}
+
+
+PyDoc_STRVAR(import_files_doc,
+"import_files(paths: Iterable[str], flags: int, num_threads: int = 0, *, cancel: CancelToken | None = None, **options) -> Iterator[tuple[str, Scene | Exception]]\n"
+"--\n\n"
+"Imports many files on a pool of native threads.\n\n"
+"Each worker thread drives its own Assimp importer with the GIL released; the\n"
+"finished scenes are converted to Scene objects as they are consumed.\n\n"
+"Args:\n"
+"    paths: Paths of the model files.\n"
+"    flags: Post-processing flags, as for import_file.\n"
+"    num_threads: Number of worker threads, 0 uses one per hardware thread.\n"
+"    cancel: CancelToken stopping the imports. Running imports stop at their\n"
+"           next progress checkpoint, the remaining files are returned\n"
+"           with an ImportCancelled exception.\n"
+"    options: Conversion options (zero_copy, compact_indices, ...), as for\n"
+"           import_file.\n\n"
+"Returns:\n"
+"    An iterator of (path, result) pairs in completion order. result is a Scene,\n"
+"    or the exception import_file would have raised for that file.\n"
+"    Dropping the iterator stops the workers after their current file.");
+
+static PyObject* py_import_files(PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"paths", "flags", "num_threads", "cancel", NULL};
+    PyObject *paths_arg = NULL;
+    unsigned int flags = 0;
+    int num_threads = 0;
+    PyObject *cancel = Py_None;
+    ConvertOptions opts;
+    PyObject *rest = NULL;
+
+    if (parse_convert_options(kwds, &opts, &rest) < 0) {
+        return NULL;
+    }
+    int parsed = PyArg_ParseTupleAndKeywords(args, rest, "OI|i$O:import_files", kwlist, &paths_arg, &flags, &num_threads,
+                                             &cancel);
+    Py_XDECREF(rest);
+    if (!parsed) {
+        return NULL;
+    }
+    unsigned int pool_threads;
+    if (check_num_threads("num_threads", num_threads, &pool_threads) < 0) {
+        return NULL;
+    }
+    if (cancel != Py_None && !PyObject_TypeCheck(cancel, &CancelTokenType)) {
+        PyErr_SetString(PyExc_TypeError, "cancel must be a CancelToken or None");
+        return NULL;
+    }
+
+    PyObject *paths = PySequence_Tuple(paths_arg);
+    if (!paths) return NULL;
+
+    Py_ssize_t num_paths = PyTuple_GET_SIZE(paths);
+    PyObject *encoded = PyList_New(num_paths);     // Keeps the encoded bytes alive
+    const char **c_paths = (const char **)malloc((num_paths ? num_paths : 1) * sizeof(char *));
+    ImportIterator *iter = NULL;
+    if (!encoded || !c_paths) {
+        if (!PyErr_Occurred()) PyErr_NoMemory();
+        goto done;
+    }
+
+    for (Py_ssize_t i = 0; i < num_paths; ++i) {
+        PyObject *bytes = NULL;
+        if (!PyUnicode_FSConverter(PyTuple_GET_ITEM(paths, i), &bytes)) {
+            goto done;
+        }
+        PyList_SET_ITEM(encoded, i, bytes); // Steals ref
+        c_paths[i] = PyBytes_AS_STRING(bytes);
+    }
+
+    iter = (ImportIterator *)ImportIteratorType.tp_alloc(&ImportIteratorType, 0);
+    if (!iter) goto done;
+    iter->opts = opts;
+    iter->paths = paths;
+    Py_INCREF(paths);
+    const CancelFlag *cancel_flag = NULL;
+    if (cancel != Py_None) {
+        iter->cancel = cancel;
+        Py_INCREF(cancel);
+        cancel_flag = ((CancelToken *)cancel)->flag;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    iter->pool = import_pool_create(c_paths, num_paths, flags, pool_threads, cancel_flag, opts.stats);
+    Py_END_ALLOW_THREADS
+    if (!iter->pool) {
+        PyErr_SetString(PyExc_RuntimeError, "Failed to start the import threads");
+        Py_CLEAR(iter);
+    }
+
+done:
+    free(c_paths);
+    Py_XDECREF(encoded);
+    Py_DECREF(paths);
+    return (PyObject *)iter;
+}
+
+
+// Resolver state for import_bytes, passed to the C++ IOSystem as context
+typedef struct {
+    PyObject *callback;     // callable(path) -> buffer-like or None
+    PendingError error;     // First exception raised by the callback
+} PyResolver;
+
+// Called from the import thread without the GIL. Keeps the returned object's
+// buffer exported (no copy) until py_resolver_release.
+static int py_resolver_open(void *ctx, const char *path, const void **data, size_t *size, void **handle) {
+    PyResolver *resolver = (PyResolver *)ctx;
+    int found = 0;
+    PyGILState_STATE gil = PyGILState_Ensure();
+
+    if (!resolver->error.type) { // Stop calling back once the callback has failed
+        PyObject *py_path = PyUnicode_DecodeFSDefault(path);
+        PyObject *result = py_path ? PyObject_CallFunctionObjArgs(resolver->callback, py_path, NULL) : NULL;
+        if (result && result != Py_None) {
+            Py_buffer *view = (Py_buffer *)PyMem_Malloc(sizeof(Py_buffer));
+            if (!view) {
+                PyErr_NoMemory();
+            } else if (PyObject_GetBuffer(result, view, PyBUF_SIMPLE) < 0) {
+                PyMem_Free(view);
+            } else {
+                *data = view->buf;
+                *size = (size_t)view->len;
+                *handle = view;
+                found = 1;
+            }
+        }
+        Py_XDECREF(result);
+        Py_XDECREF(py_path);
+        if (PyErr_Occurred()) {
+            pending_error_fetch(&resolver->error);
+        }
+    }
+
+    PyGILState_Release(gil);
+    return found;
+}
+
+static void py_resolver_release(void *ctx, void *handle) {
+    PyGILState_STATE gil = PyGILState_Ensure();
+    PyBuffer_Release((Py_buffer *)handle);
+    PyMem_Free(handle);
+    PyGILState_Release(gil);
+}
+
+PyDoc_STRVAR(import_bytes_doc,
+"import_bytes(data: Buffer, flags: int, hint: str = '', *, resolver: Callable[[str], Buffer | None] | None = None, progress: Callable[[float], bool | None] | None = None, cancel: CancelToken | None = None, threads: int = 1, fuse_steps: bool = False, **options) -> Scene\n"
+"--\n\n"
+"Imports a 3D model from memory without touching the disk.\n\n"
+"Args:\n"
+"    data: The file contents, any object supporting the buffer protocol\n"
+"           (bytes, bytearray, memoryview, mmap, numpy arrays, ...). It is\n"
+"           not copied and must not be modified during the import.\n"
+"    flags: Post-processing flags, as for import_file.\n"
+"    hint: File extension of the data (e.g. 'glb', 'obj'), used to pick the\n"
+"           importer. If empty Assimp guesses from the contents.\n"
+"    resolver: Called with the name of every secondary file the importer\n"
+"           needs (.mtl, .bin, textures, ...). Returns its contents as a\n"
+"           buffer-like object, or None if it does not exist. Without a\n"
+"           resolver secondary files are never found.\n"
+"    progress, cancel, threads, fuse_steps: Progress callback,\n"
+"           CancelToken, number of threads and mesh step fusion, as for\n"
+"           import_file.\n"
+"    options: Conversion options (zero_copy, compact_indices, ...), as for\n"
+"           import_file.\n\n"
+"Returns:\n"
+"    A Scene object containing the loaded data.\n\n"
+"Raises:\n"
+"    RuntimeError: If Assimp fails to load the data.\n"
+"    ValueError: If data is empty or mesh data is inconsistent.\n"
+"    ImportCancelled: If the import was cancelled.\n"
+"    Any exception raised by the resolver or the progress callback.");
+
+static PyObject* py_import_bytes(PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"data", "flags", "hint", "resolver", "progress", "cancel", "threads", "fuse_steps", NULL};
+    Py_buffer data;
+    unsigned int flags = 0;
+    ImportConfig config = {1, 0, 0};
+    const char *hint = "";
+    PyObject *callback = Py_None;
+    PyObject *progress_callback = Py_None;
+    PyObject *cancel = Py_None;
+    int threads = 1;
+    PyProgress py_progress;
+    ImportProgress progress;
+    ConvertOptions opts;
+    PyObject *rest = NULL;
+    const struct aiScene *c_scene = NULL;
+    char error[512] = "";
+
+    if (parse_convert_options(kwds, &opts, &rest) < 0) {
+        return NULL;
+    }
+    int parsed = PyArg_ParseTupleAndKeywords(args, rest, "y*I|s$OOOip:import_bytes", kwlist,
+                                             &data, &flags, &hint, &callback, &progress_callback, &cancel,
+                                             &threads, &config.fuse_mesh_steps);
+    Py_XDECREF(rest);
+    if (!parsed) {
+        return NULL;
+    }
+    if (check_num_threads("threads", threads, &config.num_threads) < 0) {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+    if (data.len == 0) {
+        PyBuffer_Release(&data);
+        PyErr_SetString(PyExc_ValueError, "data is empty");
+        return NULL;
+    }
+    if (callback != Py_None && !PyCallable_Check(callback)) {
+        PyBuffer_Release(&data);
+        PyErr_SetString(PyExc_TypeError, "resolver must be callable or None");
+        return NULL;
+    }
+    int has_progress = init_progress(progress_callback, cancel, &py_progress, &progress);
+    if (has_progress < 0) {
+        PyBuffer_Release(&data);
+        return NULL;
+    }
+    ImportStats stats;
+    if (opts.stats) {
+        progress.stats = &stats;
+        has_progress = 1;
+    }
+
+    PyResolver py_resolver = {callback, {NULL, NULL, NULL}};
+    ImportResolver resolver = {py_resolver_open, py_resolver_release, &py_resolver};
+
+    Py_BEGIN_ALLOW_THREADS
+    c_scene = import_memory(data.buf, (size_t)data.len, flags, hint,
+                            callback != Py_None ? &resolver : NULL, &config, has_progress ? &progress : NULL,
+                            error, sizeof(error));
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&data);
+
+    if (py_resolver.error.type) {
+        // The resolver's own exception explains the failure better than Assimp
+        aiReleaseImport(c_scene);
+        pending_error_restore(&py_resolver.error);
+        if (has_progress) pending_error_clear(&py_progress.error);
+        return NULL;
+    }
+    if (has_progress && raise_if_stopped(&py_progress, &progress)) {
+        aiReleaseImport(c_scene);
+        return NULL;
+    }
+    if (!c_scene) {
+        PyErr_Format(PyExc_RuntimeError, "Assimp error loading bytes: %s", error);
+        return NULL;
+    }
+
+    return build_scene(c_scene, &opts, opts.stats ? &stats : NULL);
+}
+
+
+static void export_blob_capsule_destructor(PyObject *capsule) {
+    aiReleaseExportBlob((const struct aiExportDataBlob *)PyCapsule_GetPointer(capsule, "assimp_py.aiExportDataBlob"));
+}
+
+// Whether `format_id` names one of the exporters of this build
+static int is_export_format(const char *format_id) {
+    size_t count = aiGetExportFormatCount();
+    for (size_t i = 0; i < count; ++i) {
+        const struct aiExportFormatDesc *desc = aiGetExportFormatDescription(i);
+        int found = desc && strcmp(desc->id, format_id) == 0;
+        aiReleaseExportFormatDescription(desc);
+        if (found) return 1;
+    }
+    return 0;
+}
+
+PyDoc_STRVAR(export_doc,
+"export(scene: Scene, path_or_buffer: str | PathLike | BinaryIO | None, format_id: str, flags: int = 0) -> memoryview | None\n"
+"--\n\n"
+"Exports a scene from its retained Assimp scene, with the GIL released.\n\n"
+"The Python objects of the scene are not read: the scene must have been\n"
+"imported with retain_scene=True (or zero_copy, lazy or typed_materials).\n\n"
+"Args:\n"
+"    scene: The Scene to export.\n"
+"    path_or_buffer: A path to write the file to (auxiliary files such as\n"
+"           .mtl or .bin go next to it), a binary file object to write it\n"
+"           to, or None to return it.\n"
+"    format_id: Exporter id, see export_formats() (e.g. 'glb2', 'ply', 'stl').\n"
+"    flags: Post-processing flags applied to a copy of the scene before\n"
+"           exporting.\n\n"
+"Returns:\n"
+"    With path_or_buffer None, a memoryview of the exported file, read\n"
+"    straight from Assimp's output without a copy. Otherwise None.\n\n"
+"Raises:\n"
+"    ValueError: If the scene was not retained, the format is unknown, or it\n"
+"           writes several files and path_or_buffer is not a path.\n"
+"    RuntimeError: If Assimp fails to export the scene.");
+
+static PyObject* py_export(PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"scene", "path_or_buffer", "format_id", "flags", NULL};
+    Scene *scene = NULL;
+    PyObject *target = NULL;
+    const char *format_id = NULL;
+    unsigned int flags = 0;
+    char error[512] = "";
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!Os|I:export", kwlist, &SceneType, &scene, &target,
+                                     &format_id, &flags)) {
+        return NULL;
+    }
+    if (!scene->c_scene) {
+        PyErr_SetString(PyExc_ValueError, "export() needs the Assimp scene, import with retain_scene=True");
+        return NULL;
+    }
+    if (!is_export_format(format_id)) {
+        PyErr_Format(PyExc_ValueError, "Unknown export format '%s'", format_id);
+        return NULL;
+    }
+    const struct aiScene *c_scene = (const struct aiScene *)PyCapsule_GetPointer(scene->c_scene, "assimp_py.aiScene");
+    if (!c_scene) return NULL;
+
+    int to_memory = target == Py_None || PyObject_HasAttrString(target, "write");
+    if (!to_memory) {
+        PyObject *path = NULL;
+        if (!PyUnicode_FSConverter(target, &path)) {
+            return NULL;
+        }
+        int status;
+        Py_BEGIN_ALLOW_THREADS
+        status = export_file(c_scene, format_id, flags, PyBytes_AS_STRING(path), error, sizeof(error));
+        Py_END_ALLOW_THREADS
+        Py_DECREF(path);
+        if (status < 0) {
+            PyErr_Format(PyExc_RuntimeError, "Assimp error exporting '%s': %s", format_id, error);
+            return NULL;
+        }
+        Py_RETURN_NONE;
+    }
+
+    const struct aiExportDataBlob *blob = NULL;
+    Py_BEGIN_ALLOW_THREADS
+    blob = export_blob(c_scene, format_id, flags, error, sizeof(error));
+    Py_END_ALLOW_THREADS
+    if (!blob) {
+        PyErr_Format(PyExc_RuntimeError, "Assimp error exporting '%s': %s", format_id, error);
+        return NULL;
+    }
+    if (blob->next) {
+        PyErr_Format(PyExc_ValueError, "Export format '%s' writes several files (%s), export it to a path",
+                     format_id, blob->next->name.data);
+        aiReleaseExportBlob(blob);
+        return NULL;
+    }
+
+    // The view reads the blob in place, the capsule frees it with the last view
+    PyObject *owner = PyCapsule_New((void *)blob, "assimp_py.aiExportDataBlob", export_blob_capsule_destructor);
+    if (!owner) {
+        aiReleaseExportBlob(blob);
+        return NULL;
+    }
+    PyObject *view = create_memoryview(blob->data, (Py_ssize_t)blob->size, 0, 0, "B", 1, owner);
+    Py_DECREF(owner);
+    if (!view || target == Py_None) {
+        return view;
+    }
+    PyObject *result = PyObject_CallMethod(target, "write", "O", view);
+    Py_DECREF(view);
+    if (!result) return NULL;
+    Py_DECREF(result);
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(export_formats_doc,
+"export_formats() -> list[tuple[str, str, str]]\n"
+"--\n\n"
+"Returns the (format_id, file_extension, description) of every exporter\n"
+"in this build.");
+
+static PyObject* py_export_formats(PyObject *self, PyObject *Py_UNUSED(ignored)) {
+    size_t count = aiGetExportFormatCount();
+    PyObject *formats = PyList_New(0);
+    if (!formats) return NULL;
+    for (size_t i = 0; i < count; ++i) {
+        const struct aiExportFormatDesc *desc = aiGetExportFormatDescription(i);
+        if (!desc) continue;
+        PyObject *item = Py_BuildValue("(sss)", desc->id, desc->fileExtension, desc->description);
+        aiReleaseExportFormatDescription(desc);
+        if (!item || PyList_Append(formats, item) < 0) {
+            Py_XDECREF(item);
+            Py_DECREF(formats);
+            return NULL;
+        }
+        Py_DECREF(item);
+    }
+    return formats;
+}
+
+// --- Snapshots ---
+// save_snapshot writes the arrays of a Scene to a snapshot file (snapshot.h)
+// as they are, and describes the rest of the scene in its first chunk, a
+// packed dict (see snapshot_pack):
+//   {"meshes": [dict of the Mesh attributes], "materials": [dict],
+//    "nodes": [(name, transformation, mesh_indices, parent_index)] in
+//             pre-order, or None with node_table,
+//    "node_table": dict of the node_table columns, or None}
+// where arrays are replaced by the index of their chunk. load_snapshot maps
+// the file and rebuilds the Scene around views of the mapping.
+
+// Mesh arrays, and lists of arrays, stored in chunks
+static const struct {
+    const char *key;
+    size_t offset;
+    uint32_t chunk;
+    int is_list;
+} snapshot_mesh_arrays[] = {
+    {"indices", offsetof(Mesh, indices), SNAPSHOT_CHUNK_MESH, 0},
+    {"face_offsets", offsetof(Mesh, face_offsets), SNAPSHOT_CHUNK_MESH, 0},
+    {"vertices", offsetof(Mesh, vertices), SNAPSHOT_CHUNK_MESH, 0},
+    {"normals", offsetof(Mesh, normals), SNAPSHOT_CHUNK_MESH, 0},
+    {"tangents", offsetof(Mesh, tangents), SNAPSHOT_CHUNK_MESH, 0},
+    {"bitangents", offsetof(Mesh, bitangents), SNAPSHOT_CHUNK_MESH, 0},
+    {"colors", offsetof(Mesh, colors), SNAPSHOT_CHUNK_MESH, 1},
+    {"texcoords", offsetof(Mesh, texcoords), SNAPSHOT_CHUNK_MESH, 1},
+    {"bone_offset_matrices", offsetof(Mesh, bone_offset_matrices), SNAPSHOT_CHUNK_BONE, 0},
+    {"joint_indices", offsetof(Mesh, joint_indices), SNAPSHOT_CHUNK_BONE, 0},
+    {"joint_weights", offsetof(Mesh, joint_weights), SNAPSHOT_CHUNK_BONE, 0},
+};
+
+// Mesh attributes stored in the description as they are, of `type` or None
+static const struct {
+    const char *key;
+    size_t offset;
+    PyTypeObject *type;
+} snapshot_mesh_objects[] = {
+    {"name", offsetof(Mesh, name), &PyUnicode_Type},
+    {"num_uv_components", offsetof(Mesh, num_uv_components), &PyList_Type},
+    {"position_scale", offsetof(Mesh, position_scale), &PyTuple_Type},
+    {"position_offset", offsetof(Mesh, position_offset), &PyTuple_Type},
+    {"bone_names", offsetof(Mesh, bone_names), &PyList_Type},
+};
+
+static const struct {
+    const char *key;
+    size_t offset;
+} snapshot_mesh_counts[] = {
+    {"num_vertices", offsetof(Mesh, num_vertices)},
+    {"num_indices", offsetof(Mesh, num_indices)},
+    {"num_faces", offsetof(Mesh, num_faces)},
+    {"material_index", offsetof(Mesh, material_index)},
+    {"num_color_sets", offsetof(Mesh, num_color_sets)},
+    {"num_texcoord_sets", offsetof(Mesh, num_texcoord_sets)},
+    {"num_bones", offsetof(Mesh, num_bones)},
+};
+
+#define MESH_FIELD(mesh, offset) (*(PyObject **)((char *)(mesh) + (offset)))
+#define MESH_COUNT(mesh, offset) (*(unsigned int *)((char *)(mesh) + (offset)))
+
+// The scene description is packed in a small tagged encoding of the values
+// it holds, in native byte order: a tag byte, then
+//   'N' None, 'F' False, 'T' True, nothing more
+//   'i' int64, 'f' double
+//   's' str, 'b' bytes: uint32 length and the (UTF-8) bytes
+//   '(' tuple, '[' list: uint32 count and the items
+//   '{' dict: uint32 count and the key, value pairs
+// Unlike marshal it does not depend on the Python version, and unpacking it
+// only builds these types, checking every length against the chunk.
+#define SNAPSHOT_MAX_DEPTH 32
+
+typedef struct {
+    char *data;
+    size_t size;
+    size_t capacity;
+} SnapshotPacker;
+
+static int snapshot_pack_raw(SnapshotPacker *p, const void *data, size_t size) {
+    if (size > p->capacity - p->size) {
+        size_t capacity = p->capacity ? p->capacity : 4096;
+        while (capacity - p->size < size) {
+            if (capacity > (size_t)PY_SSIZE_T_MAX / 2) {
+                PyErr_NoMemory();
+                return -1;
+            }
+            capacity *= 2;
+        }
+        char *grown = (char *)PyMem_Realloc(p->data, capacity);
+        if (!grown) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        p->data = grown;
+        p->capacity = capacity;
+    }
+    if (size) memcpy(p->data + p->size, data, size);
+    p->size += size;
+    return 0;
+}
+
+static int snapshot_pack_header(SnapshotPacker *p, char tag, Py_ssize_t length) {
+    if ((uint64_t)length > UINT32_MAX) {
+        PyErr_SetString(PyExc_ValueError, "Scene description too large for a snapshot");
+        return -1;
+    }
+    uint32_t n = (uint32_t)length;
+    return snapshot_pack_raw(p, &tag, 1) < 0 ? -1 : snapshot_pack_raw(p, &n, sizeof(n));
+}
+
+// Appends `obj` to the packed description. Returns -1 with ValueError for
+// values of other types.
+static int snapshot_pack(SnapshotPacker *p, PyObject *obj, int depth) {
+    if (depth > SNAPSHOT_MAX_DEPTH) {
+        PyErr_SetString(PyExc_ValueError, "Scene description nested too deeply for a snapshot");
+        return -1;
+    }
+    if (obj == Py_None || obj == Py_False || obj == Py_True) {
+        char tag = obj == Py_None ? 'N' : obj == Py_False ? 'F' : 'T';
+        return snapshot_pack_raw(p, &tag, 1);
+    }
+    if (PyLong_Check(obj)) {
+        int overflow = 0;
+        int64_t value = (int64_t)PyLong_AsLongLongAndOverflow(obj, &overflow);
+        if (overflow) {
+            PyErr_SetString(PyExc_ValueError, "Snapshots store integers of up to 64 bits");
+            return -1;
+        }
+        if (value == -1 && PyErr_Occurred()) return -1;
+        return snapshot_pack_raw(p, "i", 1) < 0 ? -1 : snapshot_pack_raw(p, &value, sizeof(value));
+    }
+    if (PyFloat_Check(obj)) {
+        double value = PyFloat_AS_DOUBLE(obj);
+        return snapshot_pack_raw(p, "f", 1) < 0 ? -1 : snapshot_pack_raw(p, &value, sizeof(value));
+    }
+    if (PyUnicode_Check(obj) || PyBytes_Check(obj)) {
+        Py_ssize_t size;
+        const char *data = PyUnicode_Check(obj) ? PyUnicode_AsUTF8AndSize(obj, &size) : NULL;
+        if (PyBytes_Check(obj)) {
+            data = PyBytes_AS_STRING(obj);
+            size = PyBytes_GET_SIZE(obj);
+        }
+        if (!data || snapshot_pack_header(p, PyBytes_Check(obj) ? 'b' : 's', size) < 0) return -1;
+        return snapshot_pack_raw(p, data, (size_t)size);
+    }
+    if (PyTuple_Check(obj) || PyList_Check(obj)) {
+        PyObject **items = PySequence_Fast_ITEMS(obj);
+        Py_ssize_t count = PySequence_Fast_GET_SIZE(obj);
+        if (snapshot_pack_header(p, PyTuple_Check(obj) ? '(' : '[', count) < 0) return -1;
+        for (Py_ssize_t i = 0; i < count; ++i) {
+            if (snapshot_pack(p, items[i], depth + 1) < 0) return -1;
+        }
+        return 0;
+    }
+    if (PyDict_Check(obj)) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        if (snapshot_pack_header(p, '{', PyDict_GET_SIZE(obj)) < 0) return -1;
+        while (PyDict_Next(obj, &pos, &key, &value)) {
+            if (snapshot_pack(p, key, depth + 1) < 0 || snapshot_pack(p, value, depth + 1) < 0) return -1;
+        }
+        return 0;
+    }
+    PyErr_Format(PyExc_ValueError, "Cannot store a %.200s in a snapshot", Py_TYPE(obj)->tp_name);
+    return -1;
+}
+
+typedef struct {
+    const char *pos;
+    const char *end;
+} SnapshotUnpacker;
+
+static PyObject* snapshot_corrupt(const char *what) {
+    PyErr_Format(PyExc_ValueError, "Corrupt snapshot: %s", what);
+    return NULL;
+}
+
+static int snapshot_unpack_raw(SnapshotUnpacker *u, void *out, size_t size) {
+    if (size > (size_t)(u->end - u->pos)) {
+        snapshot_corrupt("truncated scene description");
+        return -1;
+    }
+    memcpy(out, u->pos, size);
+    u->pos += size;
+    return 0;
+}
+
+// Reads a uint32 length of items of at least `min_size` bytes each
+static int snapshot_unpack_length(SnapshotUnpacker *u, size_t min_size, Py_ssize_t *length) {
+    uint32_t n;
+    if (snapshot_unpack_raw(u, &n, sizeof(n)) < 0) return -1;
+    if (n > (size_t)(u->end - u->pos) / min_size) {
+        snapshot_corrupt("truncated scene description");
+        return -1;
+    }
+    *length = (Py_ssize_t)n;
+    return 0;
+}
+
+// Reads back a value written by snapshot_pack. Returns a new reference, or
+// NULL with ValueError (or MemoryError) set.
+static PyObject* snapshot_unpack(SnapshotUnpacker *u, int depth) {
+    char tag;
+    Py_ssize_t length;
+    if (depth > SNAPSHOT_MAX_DEPTH) return snapshot_corrupt("scene description nested too deeply");
+    if (snapshot_unpack_raw(u, &tag, 1) < 0) return NULL;
+    switch (tag) {
+    case 'N': Py_RETURN_NONE;
+    case 'F': Py_RETURN_FALSE;
+    case 'T': Py_RETURN_TRUE;
+    case 'i': {
+        int64_t value;
+        return snapshot_unpack_raw(u, &value, sizeof(value)) < 0 ? NULL : PyLong_FromLongLong((long long)value);
+    }
+    case 'f': {
+        double value;
+        return snapshot_unpack_raw(u, &value, sizeof(value)) < 0 ? NULL : PyFloat_FromDouble(value);
+    }
+    case 's':
+    case 'b': {
+        if (snapshot_unpack_length(u, 1, &length) < 0) return NULL;
+        const char *data = u->pos;
+        u->pos += length;
+        if (tag == 'b') return PyBytes_FromStringAndSize(data, length);
+        PyObject *str = PyUnicode_DecodeUTF8(data, length, "strict");
+        if (!str && PyErr_ExceptionMatches(PyExc_UnicodeDecodeError)) {
+            PyErr_Clear();
+            return snapshot_corrupt("bad string in the scene description");
+        }
+        return str;
+    }
+    case '(':
+    case '[': {
+        if (snapshot_unpack_length(u, 1, &length) < 0) return NULL;
+        PyObject *seq = tag == '(' ? PyTuple_New(length) : PyList_New(length);
+        if (!seq) return NULL;
+        for (Py_ssize_t i = 0; i < length; ++i) {
+            PyObject *item = snapshot_unpack(u, depth + 1);
+            if (!item) {
+                Py_DECREF(seq);
+                return NULL;
+            }
+            if (tag == '(') PyTuple_SET_ITEM(seq, i, item); // Steals ref
+            else PyList_SET_ITEM(seq, i, item);
+        }
+        return seq;
+    }
+    case '{': {
+        if (snapshot_unpack_length(u, 2, &length) < 0) return NULL;
+        PyObject *dict = PyDict_New();
+        if (!dict) return NULL;
+        for (Py_ssize_t i = 0; i < length; ++i) {
+            PyObject *key = snapshot_unpack(u, depth + 1);
+            PyObject *value = key ? snapshot_unpack(u, depth + 1) : NULL;
+            int err = value ? PyDict_SetItem(dict, key, value) : -1;
+            Py_XDECREF(key);
+            Py_XDECREF(value);
+            if (err < 0) {
+                Py_DECREF(dict);
+                if (value && PyErr_ExceptionMatches(PyExc_TypeError)) { // Unhashable key
+                    PyErr_Clear();
+                    return snapshot_corrupt("bad key in the scene description");
+                }
+                return NULL;
+            }
+        }
+        return dict;
+    }
+    default:
+        return snapshot_corrupt("bad scene description");
+    }
+}
+
+// Chunks of a snapshot being written. Chunk 0 is the description, the
+// others hold the buffers of the exported views until the file is written.
+typedef struct {
+    SnapshotChunk *chunks;
+    const void **data;
+    Py_buffer *views;
+    void **copies;          // Contiguous copies of strided views, or NULL
+    uint32_t count;
+    uint32_t capacity;
+} SnapshotWriter;
+
+static void snapshot_writer_free(SnapshotWriter *w) {
+    for (uint32_t i = 1; i < w->count; ++i) {
+        PyBuffer_Release(&w->views[i]);
+        free(w->copies[i]);
+    }
+    PyMem_Free(w->chunks);
+    PyMem_Free(w->data);
+    PyMem_Free(w->views);
+    PyMem_Free(w->copies);
+    memset(w, 0, sizeof(*w));
+}
+
+// Reserves a zeroed chunk and returns its index, or -1 on error
+static Py_ssize_t snapshot_writer_reserve(SnapshotWriter *w) {
+    if (w->count == UINT32_MAX) {
+        PyErr_SetString(PyExc_ValueError, "Too many arrays for a snapshot");
+        return -1;
+    }
+    if (w->count == w->capacity) {
+        uint32_t capacity = w->capacity ? w->capacity * 2 : 64;
+        SnapshotChunk *chunks = (SnapshotChunk *)PyMem_Realloc(w->chunks, capacity * sizeof(*chunks));
+        if (chunks) w->chunks = chunks;
+        const void **data = (const void **)PyMem_Realloc(w->data, capacity * sizeof(*data));
+        if (data) w->data = data;
+        Py_buffer *views = (Py_buffer *)PyMem_Realloc(w->views, capacity * sizeof(*views));
+        if (views) w->views = views;
+        void **copies = (void **)PyMem_Realloc(w->copies, capacity * sizeof(*copies));
+        if (copies) w->copies = copies;
+        if (!chunks || !data || !views || !copies) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        w->capacity = capacity;
+    }
+    memset(&w->chunks[w->count], 0, sizeof(SnapshotChunk));
+    w->data[w->count] = NULL;
+    w->copies[w->count] = NULL;
+    return w->count;
+}
+
+// Adds the buffer of `obj` as a chunk. Returns the index of the chunk, None
+// for None, or NULL on error.
+static PyObject* snapshot_add_array(SnapshotWriter *w, PyObject *obj, uint32_t id) {
+    if (!obj || obj == Py_None) Py_RETURN_NONE;
+    Py_ssize_t index = snapshot_writer_reserve(w);
+    if (index < 0) return NULL;
+    Py_buffer *view = &w->views[index];
+    if (PyObject_GetBuffer(obj, view, PyBUF_RECORDS_RO) < 0) return NULL;
+
+    size_t itemsize = 0;
+    const char *format = view->format ? snapshot_format(view->format, &itemsize) : NULL;
+    if (!format || (Py_ssize_t)itemsize != view->itemsize || view->ndim < 1 || view->ndim > SNAPSHOT_MAX_NDIM) {
+        PyErr_Format(PyExc_ValueError, "Cannot store a buffer of format '%s' with %d dimensions in a snapshot",
+                     view->format ? view->format : "B", view->ndim);
+        PyBuffer_Release(view);
+        return NULL;
+    }
+    const void *data = view->buf;
+    if (!PyBuffer_IsContiguous(view, 'C')) {
+        // Borrowed views with padded rows, e.g. zero_copy texcoords
+        void *copy = malloc(view->len ? (size_t)view->len : 1);
+        if (!copy || PyBuffer_ToContiguous(copy, view, view->len, 'C') < 0) {
+            if (!copy) PyErr_NoMemory();
+            free(copy);
+            PyBuffer_Release(view);
+            return NULL;
+        }
+        w->copies[index] = copy;
+        data = copy;
+    }
+
+    SnapshotChunk *chunk = &w->chunks[index];
+    chunk->id = id;
+    chunk->ndim = (uint32_t)view->ndim;
+    chunk->size = (uint64_t)view->len;
+    for (int d = 0; d < view->ndim; ++d) chunk->shape[d] = (uint64_t)view->shape[d];
+    strcpy(chunk->format, format);
+    w->data[index] = data;
+    w->count++;
+    return PyLong_FromSsize_t(index);
+}
+
+// Adds every array of a list of them, see snapshot_add_array
+static PyObject* snapshot_add_array_list(SnapshotWriter *w, PyObject *list, uint32_t id) {
+    if (!list || list == Py_None) Py_RETURN_NONE;
+    if (!PyList_Check(list)) {
+        PyErr_SetString(PyExc_TypeError, "Expected a list of arrays");
+        return NULL;
+    }
+    PyObject *indices = PyList_New(PyList_GET_SIZE(list));
+    if (!indices) return NULL;
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(list); ++i) {
+        PyObject *index = snapshot_add_array(w, PyList_GET_ITEM(list, i), id);
+        if (!index) {
+            Py_DECREF(indices);
+            return NULL;
+        }
+        PyList_SET_ITEM(indices, i, index); // Steals ref
+    }
+    return indices;
+}
+
+// Sets dict[key] = value and releases value. Returns -1 on error, also if
+// value is NULL.
+static int snapshot_set(PyObject *dict, const char *key, PyObject *value) {
+    if (!value) return -1;
+    int err = PyDict_SetItemString(dict, key, value);
+    Py_DECREF(value);
+    return err;
+}
+
+static PyObject* snapshot_describe_mesh(SnapshotWriter *w, PyObject *obj) {
+    if (!PyObject_TypeCheck(obj, &MeshType)) {
+        PyErr_SetString(PyExc_TypeError, "Scene.meshes must hold Mesh objects");
+        return NULL;
+    }
+    PyObject *dict = PyDict_New();
+    if (!dict) return NULL;
+    for (size_t i = 0; i < sizeof(snapshot_mesh_arrays) / sizeof(snapshot_mesh_arrays[0]); ++i) {
+        PyObject *field = MESH_FIELD(obj, snapshot_mesh_arrays[i].offset);
+        PyObject *value = snapshot_mesh_arrays[i].is_list ?
+            snapshot_add_array_list(w, field, snapshot_mesh_arrays[i].chunk) :
+            snapshot_add_array(w, field, snapshot_mesh_arrays[i].chunk);
+        if (snapshot_set(dict, snapshot_mesh_arrays[i].key, value) < 0) goto fail;
+    }
+    for (size_t i = 0; i < sizeof(snapshot_mesh_objects) / sizeof(snapshot_mesh_objects[0]); ++i) {
+        PyObject *field = MESH_FIELD(obj, snapshot_mesh_objects[i].offset);
+        if (snapshot_set(dict, snapshot_mesh_objects[i].key, Py_NewRef(field ? field : Py_None)) < 0) goto fail;
+    }
+    for (size_t i = 0; i < sizeof(snapshot_mesh_counts) / sizeof(snapshot_mesh_counts[0]); ++i) {
+        PyObject *value = PyLong_FromUnsignedLong(MESH_COUNT(obj, snapshot_mesh_counts[i].offset));
+        if (snapshot_set(dict, snapshot_mesh_counts[i].key, value) < 0) goto fail;
+    }
+    return dict;
+
+fail:
+    Py_DECREF(dict);
+    return NULL;
+}
+
+// Flattens the Node tree under `root` into pre-order
+// (name, transformation, mesh_indices, parent_index) tuples, iteratively
+static PyObject* snapshot_describe_nodes(PyObject *root) {
+    PyObject *nodes = PyList_New(0);
+    PyObject *stack = PyList_New(0); // (node, parent_index) pairs
+    PyObject *pending = nodes && stack ? Py_BuildValue("(Oi)", root, -1) : NULL;
+    if (!pending || PyList_Append(stack, pending) < 0) goto fail;
+    Py_CLEAR(pending);
+
+    while (PyList_GET_SIZE(stack)) {
+        Py_ssize_t top = PyList_GET_SIZE(stack) - 1;
+        pending = Py_NewRef(PyList_GET_ITEM(stack, top));
+        if (PyList_SetSlice(stack, top, top + 1, NULL) < 0) goto fail;
+        Node *node = (Node *)PyTuple_GET_ITEM(pending, 0);
+        if (!PyObject_TypeCheck((PyObject *)node, &NodeType)) {
+            PyErr_SetString(PyExc_TypeError, "Scene.root_node must be a tree of Node objects");
+            goto fail;
+        }
+        if (!node->name || !node->transformation || !node->mesh_indices ||
+            (node->children && !PyList_Check(node->children))) {
+            PyErr_SetString(PyExc_ValueError, "Cannot save a Node without name, transformation and mesh_indices");
+            goto fail;
+        }
+        Py_ssize_t index = PyList_GET_SIZE(nodes);
+        PyObject *item = Py_BuildValue("(OOOO)", node->name, node->transformation, node->mesh_indices,
+                                       PyTuple_GET_ITEM(pending, 1));
+        if (!item || PyList_Append(nodes, item) < 0) {
+            Py_XDECREF(item);
+            goto fail;
+        }
+        Py_DECREF(item);
+        Py_CLEAR(pending);
+
+        // Children pushed last to first, so they are visited in order
+        for (Py_ssize_t c = node->children ? PyList_GET_SIZE(node->children) : 0; c-- > 0;) {
+            pending = Py_BuildValue("(On)", PyList_GET_ITEM(node->children, c), index);
+            if (!pending || PyList_Append(stack, pending) < 0) goto fail;
+            Py_CLEAR(pending);
+        }
+    }
+    Py_DECREF(stack);
+    return nodes;
+
+fail:
+    Py_XDECREF(pending);
+    Py_XDECREF(stack);
+    Py_XDECREF(nodes);
+    return NULL;
+}
+
+// Description of `scene`, adding its arrays to `w`
+static PyObject* snapshot_describe_scene(SnapshotWriter *w, Scene *scene) {
+    PyObject *meshes = NULL, *materials = NULL, *value = NULL;
+    if (!scene->meshes || !scene->materials || !scene->textures || !scene->animations) {
+        PyErr_SetString(PyExc_ValueError, "Cannot save a Scene without meshes, materials, textures and animations");
+        return NULL;
+    }
+    PyObject *dict = PyDict_New();
+    if (!dict) return NULL;
+
+    Py_ssize_t num_textures = PyObject_Length(scene->textures);
+    Py_ssize_t num_animations = num_textures < 0 ? -1 : PyObject_Length(scene->animations);
+    if (num_animations < 0) goto fail;
+    if (num_textures || num_animations) {
+        PyErr_SetString(PyExc_ValueError, "Snapshots do not store embedded textures or animations");
+        goto fail;
+    }
+
+    meshes = PySequence_Fast(scene->meshes, "Scene.meshes must be a sequence");
+    value = meshes ? PyList_New(PySequence_Fast_GET_SIZE(meshes)) : NULL;
+    if (!value) goto fail;
+    for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(meshes); ++i) {
+        PyObject *mesh = snapshot_describe_mesh(w, PySequence_Fast_GET_ITEM(meshes, i));
+        if (!mesh) goto fail;
+        PyList_SET_ITEM(value, i, mesh); // Steals ref
+    }
+    if (snapshot_set(dict, "meshes", value) < 0) {
+        value = NULL;
+        goto fail;
+    }
+
+    materials = PySequence_Fast(scene->materials, "Scene.materials must be a sequence");
+    if (!materials) goto fail;
+    for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(materials); ++i) {
+        if (!PyDict_Check(PySequence_Fast_GET_ITEM(materials, i))) {
+            PyErr_SetString(PyExc_ValueError, "Snapshots store property dictionary materials, "
+                                              "import without typed_materials");
+            goto fail;
+        }
+    }
+    if (snapshot_set(dict, "materials", PySequence_List(materials)) < 0) goto fail;
+
+    if (scene->node_table && scene->node_table != Py_None) {
+        PyObject *key, *column;
+        Py_ssize_t pos = 0;
+        value = PyDict_New();
+        while (value && PyDict_Next(scene->node_table, &pos, &key, &column)) {
+            PyObject *index = snapshot_add_array(w, column, SNAPSHOT_CHUNK_NODE);
+            if (!index || PyDict_SetItem(value, key, index) < 0) {
+                Py_XDECREF(index);
+                goto fail;
+            }
+            Py_DECREF(index);
+        }
+        if (snapshot_set(dict, "node_table", value) < 0 || snapshot_set(dict, "nodes", Py_NewRef(Py_None)) < 0) {
+            value = NULL;
+            goto fail;
+        }
+    } else {
+        value = scene->root_node && scene->root_node != Py_None ? snapshot_describe_nodes(scene->root_node) :
+                                                                  Py_NewRef(Py_None);
+        if (snapshot_set(dict, "nodes", value) < 0 || snapshot_set(dict, "node_table", Py_NewRef(Py_None)) < 0) {
+            value = NULL;
+            goto fail;
+        }
+    }
+    Py_DECREF(meshes);
+    Py_DECREF(materials);
+    return dict;
+
+fail:
+    Py_XDECREF(value);
+    Py_XDECREF(meshes);
+    Py_XDECREF(materials);
+    Py_DECREF(dict);
+    return NULL;
+}
+
+PyDoc_STRVAR(save_snapshot_doc,
+"save_snapshot(scene: Scene, path: str | PathLike) -> None\n"
+"--\n\n"
+"Writes the scene to a snapshot file, for load_snapshot.\n\n"
+"Every array is stored as the scene exposes it (e.g. float16 normals or\n"
+"uint16 indices with the matching import options), 64-byte aligned.\n"
+"Snapshots use the byte order of this machine.\n\n"
+"Raises:\n"
+"    ValueError: If the scene has embedded textures, animations or typed\n"
+"           materials, which snapshots do not store, or lacks its meshes,\n"
+"           materials, textures or animations.\n"
+"    OSError: If the file cannot be written.");
+
+static PyObject* py_save_snapshot(PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"scene", "path", NULL};
+    Scene *scene = NULL;
+    PyObject *path = NULL;
+    SnapshotWriter w = {0};
+    PyObject *description = NULL;
+    SnapshotPacker packed = {NULL, 0, 0};
+    char error[512] = "";
+    int status = -1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O!O&:save_snapshot", kwlist, &SceneType, &scene,
+                                     PyUnicode_FSConverter, &path)) {
+        return NULL;
+    }
+    if (snapshot_writer_reserve(&w) < 0) goto done; // The description
+    w.count = 1;
+    description = snapshot_describe_scene(&w, scene);
+    if (!description || snapshot_pack(&packed, description, 0) < 0) goto done;
+    w.chunks[0].id = SNAPSHOT_CHUNK_SCENE;
+    w.chunks[0].ndim = 1;
+    w.chunks[0].size = (uint64_t)packed.size;
+    w.chunks[0].shape[0] = w.chunks[0].size;
+    strcpy(w.chunks[0].format, "B");
+    w.data[0] = packed.data;
+
+    Py_BEGIN_ALLOW_THREADS
+    status = write_snapshot(PyBytes_AS_STRING(path), w.chunks, w.data, w.count, error, sizeof(error));
+    Py_END_ALLOW_THREADS
+    if (status < 0) {
+        PyErr_Format(PyExc_OSError, "Cannot save the snapshot '%s': %s", PyBytes_AS_STRING(path), error);
+    }
+
+done:
+    snapshot_writer_free(&w);
+    PyMem_Free(packed.data);
+    Py_XDECREF(description);
+    Py_DECREF(path);
+    if (status < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+static void snapshot_capsule_destructor(PyObject *capsule) {
+    MappedFile *file = (MappedFile *)PyCapsule_GetPointer(capsule, "assimp_py.Snapshot");
+    unmap_file(file);
+    PyMem_Free(file);
+}
+
+// Mapped snapshot being loaded
+typedef struct {
+    const MappedFile *file;
+    const SnapshotChunk *chunks;
+    uint32_t num_chunks;
+    PyObject *owner;        // Capsule unmapping the file
+} SnapshotReader;
+
+// Borrowed dict[key], or NULL and ValueError if missing
+static PyObject* snapshot_get(PyObject *dict, const char *key) {
+    PyObject *value = PyDict_Check(dict) ? PyDict_GetItemString(dict, key) : NULL;
+    if (!value) PyErr_Format(PyExc_ValueError, "Corrupt snapshot: no '%s'", key);
+    return value;
+}
+
+// View of the chunk at `index`, None for None
+static PyObject* snapshot_array(SnapshotReader *r, PyObject *index) {
+    if (index == Py_None) Py_RETURN_NONE;
+    Py_ssize_t i = PyLong_Check(index) ? PyLong_AsSsize_t(index) : -1;
+    if (i < 1 || (size_t)i >= r->num_chunks) {
+        PyErr_Clear();
+        PyErr_SetString(PyExc_ValueError, "Corrupt snapshot: bad chunk index");
+        return NULL;
+    }
+    const SnapshotChunk *chunk = &r->chunks[i];
+    Py_ssize_t shape[SNAPSHOT_MAX_NDIM];
+    for (uint32_t d = 0; d < chunk->ndim; ++d) shape[d] = (Py_ssize_t)chunk->shape[d];
+    size_t itemsize = 0;
+    const char *format = snapshot_format(chunk->format, &itemsize); // Checked by map_snapshot
+    return buffer_memoryview((void *)(r->file->data + chunk->offset), (int)chunk->ndim, shape, NULL, format,
+                             (Py_ssize_t)itemsize, r->owner);
+}
+
+static PyObject* snapshot_array_list(SnapshotReader *r, PyObject *indices) {
+    if (indices == Py_None) Py_RETURN_NONE;
+    if (!PyList_Check(indices)) {
+        PyErr_SetString(PyExc_ValueError, "Corrupt snapshot: bad array list");
+        return NULL;
+    }
+    PyObject *list = PyList_New(PyList_GET_SIZE(indices));
+    if (!list) return NULL;
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(indices); ++i) {
+        PyObject *view = snapshot_array(r, PyList_GET_ITEM(indices, i));
+        if (!view) {
+            Py_DECREF(list);
+            return NULL;
+        }
+        PyList_SET_ITEM(list, i, view); // Steals ref
+    }
+    return list;
+}
+
+static PyObject* snapshot_load_mesh(SnapshotReader *r, PyObject *dict) {
+    Mesh *mesh = (Mesh *)MeshType.tp_alloc(&MeshType, 0);
+    if (!mesh) return NULL;
+    for (size_t i = 0; i < sizeof(snapshot_mesh_arrays) / sizeof(snapshot_mesh_arrays[0]); ++i) {
+        PyObject *index = snapshot_get(dict, snapshot_mesh_arrays[i].key);
+        if (!index) goto fail;
+        PyObject *value = snapshot_mesh_arrays[i].is_list ? snapshot_array_list(r, index) : snapshot_array(r, index);
+        if (!value) goto fail;
+        MESH_FIELD(mesh, snapshot_mesh_arrays[i].offset) = value;
+    }
+    for (size_t i = 0; i < sizeof(snapshot_mesh_objects) / sizeof(snapshot_mesh_objects[0]); ++i) {
+        PyObject *value = snapshot_get(dict, snapshot_mesh_objects[i].key);
+        if (!value) goto fail;
+        if (value != Py_None && !PyObject_TypeCheck(value, snapshot_mesh_objects[i].type)) {
+            PyErr_Format(PyExc_ValueError, "Corrupt snapshot: bad '%s'", snapshot_mesh_objects[i].key);
+            goto fail;
+        }
+        MESH_FIELD(mesh, snapshot_mesh_objects[i].offset) = Py_NewRef(value);
+    }
+    for (size_t i = 0; i < sizeof(snapshot_mesh_counts) / sizeof(snapshot_mesh_counts[0]); ++i) {
+        PyObject *value = snapshot_get(dict, snapshot_mesh_counts[i].key);
+        if (!value) goto fail;
+        int overflow = 0;
+        long long count = PyLong_Check(value) ? PyLong_AsLongLongAndOverflow(value, &overflow) : -1;
+        if (overflow || count < 0 || count > UINT_MAX) {
+            PyErr_Format(PyExc_ValueError, "Corrupt snapshot: bad '%s'", snapshot_mesh_counts[i].key);
+            goto fail;
+        }
+        MESH_COUNT(mesh, snapshot_mesh_counts[i].offset) = (unsigned int)count;
+    }
+    return (PyObject *)mesh;
+
+fail:
+    Py_DECREF(mesh);
+    return NULL;
+}
+
+// Rebuilds the Node tree from its pre-order description
+static PyObject* snapshot_load_nodes(PyObject *description) {
+    if (!PyList_Check(description) || PyList_GET_SIZE(description) == 0) {
+        PyErr_SetString(PyExc_ValueError, "Corrupt snapshot: bad node list");
+        return NULL;
+    }
+    Py_ssize_t num_nodes = PyList_GET_SIZE(description);
+    PyObject *nodes = PyList_New(num_nodes); // Keeps the nodes alive while linking them
+    if (!nodes) return NULL;
+    for (Py_ssize_t i = 0; i < num_nodes; ++i) {
+        PyObject *name, *transformation, *mesh_indices;
+        Py_ssize_t parent;
+        if (!PyArg_ParseTuple(PyList_GET_ITEM(description, i), "UO!O!n;Corrupt snapshot: bad node", &name,
+                              &PyTuple_Type, &transformation, &PyTuple_Type, &mesh_indices, &parent)) {
+            goto fail;
+        }
+        if (parent >= i || (parent < 0) != (i == 0)) {
+            PyErr_SetString(PyExc_ValueError, "Corrupt snapshot: bad node parent");
+            goto fail;
+        }
+        Node *node = (Node *)NodeType.tp_alloc(&NodeType, 0);
+        if (!node) goto fail;
+        PyList_SET_ITEM(nodes, i, (PyObject *)node); // Steals ref
+        node->name = Py_NewRef(name);
+        node->transformation = Py_NewRef(transformation);
+        node->mesh_indices = Py_NewRef(mesh_indices);
+        node->num_meshes = (unsigned int)PyTuple_GET_SIZE(mesh_indices);
+        node->children = PyList_New(0);
+        if (!node->children) goto fail;
+        if (parent < 0) {
+            node->parent_name = Py_NewRef(Py_None);
+        } else {
+            Node *parent_node = (Node *)PyList_GET_ITEM(nodes, parent);
+            node->parent_name = Py_NewRef(parent_node->name);
+            if (PyList_Append(parent_node->children, (PyObject *)node) < 0) goto fail;
+            parent_node->num_children++;
+        }
+    }
+    PyObject *root = Py_NewRef(PyList_GET_ITEM(nodes, 0));
+    Py_DECREF(nodes);
+    return root;
+
+fail:
+    Py_DECREF(nodes);
+    return NULL;
+}
+
+static PyObject* snapshot_load_scene(SnapshotReader *r, PyObject *description) {
+    Scene *scene = (Scene *)SceneType.tp_alloc(&SceneType, 0);
+    if (!scene) return NULL;
+    PyObject *meshes = snapshot_get(description, "meshes");
+    PyObject *materials = meshes ? snapshot_get(description, "materials") : NULL;
+    PyObject *nodes = materials ? snapshot_get(description, "nodes") : NULL;
+    PyObject *node_table = nodes ? snapshot_get(description, "node_table") : NULL;
+    if (!node_table) goto fail;
+    if (!PyList_Check(meshes) || !PyList_Check(materials) || (node_table != Py_None && !PyDict_Check(node_table))) {
+        PyErr_SetString(PyExc_ValueError, "Corrupt snapshot: bad scene description");
+        goto fail;
+    }
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(materials); ++i) {
+        if (!PyDict_Check(PyList_GET_ITEM(materials, i))) {
+            PyErr_SetString(PyExc_ValueError, "Corrupt snapshot: bad material");
+            goto fail;
+        }
+    }
+
+    scene->meshes = PyList_New(PyList_GET_SIZE(meshes));
+    if (!scene->meshes) goto fail;
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(meshes); ++i) {
+        PyObject *mesh = snapshot_load_mesh(r, PyList_GET_ITEM(meshes, i));
+        if (!mesh) goto fail;
+        PyList_SET_ITEM(scene->meshes, i, mesh); // Steals ref
+    }
+    scene->materials = Py_NewRef(materials);
+    scene->textures = PyList_New(0);
+    scene->animations = PyList_New(0);
+    if (!scene->textures || !scene->animations) goto fail;
+
+    if (node_table != Py_None) {
+        PyObject *key, *index;
+        Py_ssize_t pos = 0;
+        scene->node_table = PyDict_New();
+        while (scene->node_table && PyDict_Next(node_table, &pos, &key, &index)) {
+            PyObject *column = snapshot_array(r, index);
+            if (!column || PyDict_SetItem(scene->node_table, key, column) < 0) {
+                Py_XDECREF(column);
+                goto fail;
+            }
+            Py_DECREF(column);
+        }
+        if (!scene->node_table) goto fail;
+        scene->root_node = Py_NewRef(Py_None);
+    } else {
+        scene->node_table = Py_NewRef(Py_None);
+        scene->root_node = nodes != Py_None ? snapshot_load_nodes(nodes) : Py_NewRef(Py_None);
+        if (!scene->root_node) goto fail;
+    }
+    scene->import_stats = Py_NewRef(Py_None);
+    scene->num_meshes = (unsigned int)PyList_GET_SIZE(meshes);
+    scene->num_materials = (unsigned int)PyList_GET_SIZE(materials);
+    return (PyObject *)scene;
+
+fail:
+    Py_DECREF(scene);
     return NULL;
 }
 
+PyDoc_STRVAR(load_snapshot_doc,
+"load_snapshot(path: str | PathLike) -> Scene\n"
+"--\n\n"
+"Loads a scene written by save_snapshot.\n\n"
+"The file is memory-mapped: every array of the scene is a read-only view of\n"
+"the mapping, paged in from disk as it is read, so loading only reads the\n"
+"scene description. The mapping lives as long as any of the views.\n\n"
+"Raises:\n"
+"    OSError: If the file cannot be opened or mapped.\n"
+"    ValueError: If the file is not a valid snapshot.");
+
+static PyObject* py_load_snapshot(PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"path", NULL};
+    PyObject *path = NULL;
+    char error[512] = "";
+    int status, os_error;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&:load_snapshot", kwlist, PyUnicode_FSConverter, &path)) {
+        return NULL;
+    }
+    MappedFile *file = (MappedFile *)PyMem_Malloc(sizeof(MappedFile));
+    if (!file) {
+        Py_DECREF(path);
+        return PyErr_NoMemory();
+    }
+    Py_BEGIN_ALLOW_THREADS
+    errno = 0;
+    status = map_snapshot(PyBytes_AS_STRING(path), file, error, sizeof(error));
+    os_error = errno;
+    Py_END_ALLOW_THREADS
+    if (status == -1 && os_error) {
+        errno = os_error; // FileNotFoundError and friends
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, PyBytes_AS_STRING(path));
+    } else if (status < 0) {
+        PyErr_Format(status == -1 ? PyExc_OSError : PyExc_ValueError, "Cannot load the snapshot '%s': %s",
+                     PyBytes_AS_STRING(path), error);
+    }
+    if (status < 0) {
+        PyMem_Free(file);
+        Py_DECREF(path);
+        return NULL;
+    }
+    Py_DECREF(path);
+
+    SnapshotReader r = {file, NULL, 0, NULL};
+    r.chunks = snapshot_chunks(file, &r.num_chunks);
+    r.owner = PyCapsule_New(file, "assimp_py.Snapshot", snapshot_capsule_destructor);
+    if (!r.owner) {
+        unmap_file(file);
+        PyMem_Free(file);
+        return NULL;
+    }
+    PyObject *scene = NULL;
+    PyObject *description = NULL;
+    if (r.chunks[0].id != SNAPSHOT_CHUNK_SCENE) {
+        PyErr_SetString(PyExc_ValueError, "Corrupt snapshot: no scene description");
+    } else {
+        const char *packed = (const char *)file->data + r.chunks[0].offset;
+        SnapshotUnpacker u = {packed, packed + r.chunks[0].size};
+        description = snapshot_unpack(&u, 0);
+        if (description && u.pos != u.end) {
+            Py_CLEAR(description);
+            snapshot_corrupt("bad scene description");
+        }
+    }
+    if (description) {
+        scene = snapshot_load_scene(&r, description);
+        Py_DECREF(description);
+    }
+    Py_DECREF(r.owner); // Held by the views from here on
+    return scene;
+}
+
 
 // --- Module Definition ---
 
 static PyMethodDef assimp_py_methods[] = {
-    {"import_file", py_import_file, METH_VARARGS, import_file_doc},
+    {"import_file", (PyCFunction)(void(*)(void))py_import_file, METH_VARARGS | METH_KEYWORDS, import_file_doc},
+    {"import_files", (PyCFunction)(void(*)(void))py_import_files, METH_VARARGS | METH_KEYWORDS, import_files_doc},
+    {"import_bytes", (PyCFunction)(void(*)(void))py_import_bytes, METH_VARARGS | METH_KEYWORDS, import_bytes_doc},
+    {"export", (PyCFunction)(void(*)(void))py_export, METH_VARARGS | METH_KEYWORDS, export_doc},
+    {"export_formats", (PyCFunction)py_export_formats, METH_NOARGS, export_formats_doc},
+    {"save_snapshot", (PyCFunction)(void(*)(void))py_save_snapshot, METH_VARARGS | METH_KEYWORDS, save_snapshot_doc},
+    {"load_snapshot", (PyCFunction)(void(*)(void))py_load_snapshot, METH_VARARGS | METH_KEYWORDS, load_snapshot_doc},
     {NULL, NULL, 0, NULL} /* Sentinel */
 };
 
@@ -1128,6 +4641,18 @@ PyMODINIT_FUNC PyInit_assimp_py(void) {
     if (PyType_Ready(&MeshType) < 0) return NULL;
     if (PyType_Ready(&SceneType) < 0) return NULL;
     if (PyType_Ready(&NodeType) < 0) return NULL;
+    if (PyType_Ready(&BufferType) < 0) return NULL;
+    if (PyType_Ready(&ImportIteratorType) < 0) return NULL;
+    if (PyType_Ready(&LazySequenceType) < 0) return NULL;
+    if (PyType_Ready(&CancelTokenType) < 0) return NULL;
+    if (PyType_Ready(&ImportCacheType) < 0) return NULL;
+    if (PyStructSequence_InitType2(&TextureSlotType, &TextureSlot_desc) < 0) return NULL;
+    if (PyType_Ready(&MaterialType) < 0) return NULL;
+    if (PyType_Ready(&TextureType) < 0) return NULL;
+    if (PyType_Ready(&AnimationType) < 0) return NULL;
+    if (PyStructSequence_InitType2(&AnimationChannelType, &AnimationChannel_desc) < 0) return NULL;
+    if (PyStructSequence_InitType2(&MorphChannelType, &MorphChannel_desc) < 0) return NULL;
+    if (init_material_keys() < 0) return NULL;
 
     // Create Module
     module = PyModule_Create(&assimp_py_module);
@@ -1163,6 +4688,94 @@ PyMODINIT_FUNC PyInit_assimp_py(void) {
         return NULL;
     }    
 
+    Py_INCREF(&MaterialType);
+    if (PyModule_AddObject(module, "Material", (PyObject *)&MaterialType) < 0) {
+        Py_DECREF(&MaterialType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    Py_INCREF(&TextureType);
+    if (PyModule_AddObject(module, "Texture", (PyObject *)&TextureType) < 0) {
+        Py_DECREF(&TextureType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    Py_INCREF(&AnimationType);
+    if (PyModule_AddObject(module, "Animation", (PyObject *)&AnimationType) < 0) {
+        Py_DECREF(&AnimationType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    Py_INCREF(&AnimationChannelType);
+    if (PyModule_AddObject(module, "AnimationChannel", (PyObject *)&AnimationChannelType) < 0) {
+        Py_DECREF(&AnimationChannelType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    Py_INCREF(&MorphChannelType);
+    if (PyModule_AddObject(module, "MorphChannel", (PyObject *)&MorphChannelType) < 0) {
+        Py_DECREF(&MorphChannelType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    Py_INCREF(&TextureSlotType);
+    if (PyModule_AddObject(module, "TextureSlot", (PyObject *)&TextureSlotType) < 0) {
+        Py_DECREF(&TextureSlotType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    Py_INCREF(&LazySequenceType);
+    if (PyModule_AddObject(module, "LazySequence", (PyObject *)&LazySequenceType) < 0) {
+        Py_DECREF(&LazySequenceType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    // Py_TPFLAGS_SEQUENCE (3.10+) only enables sequence patterns in match
+    // statements, isinstance(x, collections.abc.Sequence) needs registering
+    PyObject *abc = PyImport_ImportModule("collections.abc");
+    PyObject *sequence_abc = abc ? PyObject_GetAttrString(abc, "Sequence") : NULL;
+    Py_XDECREF(abc);
+    PyObject *registered = sequence_abc ?
+        PyObject_CallMethod(sequence_abc, "register", "O", (PyObject *)&LazySequenceType) : NULL;
+    Py_XDECREF(sequence_abc);
+    if (!registered) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    Py_DECREF(registered);
+
+    Py_INCREF(&CancelTokenType);
+    if (PyModule_AddObject(module, "CancelToken", (PyObject *)&CancelTokenType) < 0) {
+        Py_DECREF(&CancelTokenType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    Py_INCREF(&ImportCacheType);
+    if (PyModule_AddObject(module, "ImportCache", (PyObject *)&ImportCacheType) < 0) {
+        Py_DECREF(&ImportCacheType);
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    ImportCancelledError = PyErr_NewExceptionWithDoc("assimp_py.ImportCancelled",
+        "Raised when an import is cancelled through its CancelToken or progress callback",
+        PyExc_RuntimeError, NULL);
+    Py_XINCREF(ImportCancelledError); // Module takes one reference, we keep the other
+    if (!ImportCancelledError || PyModule_AddObject(module, "ImportCancelled", ImportCancelledError) < 0) {
+        Py_XDECREF(ImportCancelledError);
+        Py_CLEAR(ImportCancelledError);
+        Py_DECREF(module);
+        return NULL;
+    }
+
     // Add Constants (Post-processing flags) - Abbreviated list for example
     int error = 0;
     error |= add_int_constant(module, "Process_CalcTangentSpace", aiProcess_CalcTangentSpace);
@@ -1,3 +1,6 @@
+from os import PathLike
+from typing import Any, BinaryIO, Callable, Iterable, Iterator, Sequence
+
 Process_CalcTangentSpace: int
 Process_Debone: int
 Process_FindDegenerates: int
@@ -41,19 +44,101 @@ TextureType_UNKNOWN: int
 
 class Mesh:
     bitangents: memoryview
+    bone_names: list[str]
+    bone_offset_matrices: memoryview | None
     colors: list[memoryview]
+    face_offsets: memoryview | None
     indices: memoryview
+    joint_indices: memoryview | None  # uint16, uint32 for meshes of more than 65536 bones
+    joint_weights: memoryview | None
     material_index: int
     name: str
     normals: memoryview
+    num_bones: int
     num_faces: int
     num_indices: int
     num_uv_components: int
     num_vertices: int
+    position_offset: tuple[float, float, float] | None
+    position_scale: tuple[float, float, float] | None
     tangents: memoryview
     texcoords: list[memoryview]
     vertices: memoryview
     def __init__(self, *args, **kwargs) -> None: ...
+    def interleaved(self, layout: str = "P3N3T2", dtype: str = "f32") -> tuple[memoryview, int, dict[str, int]]: ...
+
+class AnimationChannel(tuple):
+    node_name: str
+    position_times: memoryview
+    positions: memoryview
+    rotation_times: memoryview
+    rotations: memoryview
+    scaling_times: memoryview
+    scalings: memoryview
+    pre_state: int
+    post_state: int
+
+class MorphChannel(tuple):
+    name: str
+    times: memoryview
+    targets: memoryview
+    weights: memoryview
+
+class Animation:
+    channels: tuple[AnimationChannel, ...]
+    duration: float
+    morph_channels: tuple[MorphChannel, ...]
+    name: str
+    ticks_per_second: float
+    def resample(self, fps: float, nodes: Sequence[str] | None = None) -> memoryview: ...
+
+class Material:
+    base_color: tuple[float, float, float, float] | None
+    diffuse: tuple[float, float, float, float] | None
+    emissive: tuple[float, float, float, float] | None
+    metallic: float | None
+    name: str | None
+    opacity: float | None
+    properties: dict
+    roughness: float | None
+    shading_model: int | None
+    shininess: float | None
+    specular: tuple[float, float, float, float] | None
+    textures: tuple['TextureSlot', ...]
+    two_sided: bool | None
+
+class Texture:
+    data: memoryview
+    filename: str | None
+    format_hint: str
+    height: int
+    width: int
+
+class TextureSlot(tuple):
+    type: int
+    index: int
+    path: str | None
+    uv_index: int
+    mapping: int
+    blend: float | None
+    op: int | None
+    map_mode: tuple[int, int] | None
+
+class CancelToken:
+    cancelled: bool
+    def __init__(self) -> None: ...
+    def cancel(self) -> None: ...
+
+class ImportCancelled(RuntimeError): ...
+
+class ImportCache:
+    stats: dict[str, int]
+    def __init__(self, directory: str | PathLike, max_bytes: int = 1 << 30) -> None: ...
+    def clear(self) -> None: ...
+
+class LazySequence(Sequence[Any]):
+    def __getitem__(self, index: Any) -> Any: ...
+    def __len__(self) -> int: ...
 
 class Node:
     children: list['Node']
@@ -66,11 +151,25 @@ class Node:
     def __init__(self, *args, **kwargs) -> None: ...
 
 class Scene:
-    materials: list[dict]
-    meshes: list[Mesh]
+    animations: Sequence[Animation]
+    materials: Sequence[dict] | Sequence[Material]
+    node_table: dict[str, memoryview] | None
+    import_stats: dict[str, Any] | None
+    meshes: Sequence[Mesh]
+    num_animations: int
     num_materials: int
     num_meshes: int
-    root_node: int
+    num_textures: int
+    root_node: Node | None
+    textures: list[Texture]
     def __init__(self, *args, **kwargs) -> None: ...
+    def embedded_texture(self, path: str) -> Texture | None: ...
+    def material_table(self) -> dict[str, list | memoryview]: ...
 
-def import_file(filename: str, flags: int) -> Scene: ...
+def import_file(filename: str, flags: int, *, zero_copy: bool = False, compact_indices: bool = False, normals: str = "f32", texcoords: str = "f32", quantize_positions: bool = False, lazy: bool = False, polygons: bool = False, typed_materials: bool = False, node_table: bool = False, stats: bool = False, retain_scene: bool = False, progress: Callable[[float], bool | None] | None = None, cancel: CancelToken | None = None, cache: ImportCache | None = None, threads: int = 1, fuse_steps: bool = False, mmap: bool = False) -> Scene: ...
+def import_bytes(data: Any, flags: int, hint: str = "", *, resolver: Callable[[str], Any] | None = None, progress: Callable[[float], bool | None] | None = None, cancel: CancelToken | None = None, threads: int = 1, fuse_steps: bool = False, zero_copy: bool = False, compact_indices: bool = False, normals: str = "f32", texcoords: str = "f32", quantize_positions: bool = False, lazy: bool = False, polygons: bool = False, typed_materials: bool = False, node_table: bool = False, stats: bool = False, retain_scene: bool = False) -> Scene: ...
+def import_files(paths: Iterable[str | PathLike], flags: int, num_threads: int = 0, *, cancel: CancelToken | None = None, zero_copy: bool = False, compact_indices: bool = False, normals: str = "f32", texcoords: str = "f32", quantize_positions: bool = False, lazy: bool = False, polygons: bool = False, typed_materials: bool = False, node_table: bool = False, stats: bool = False, retain_scene: bool = False) -> Iterator[tuple[str | PathLike, Scene | Exception]]: ...
+def export(scene: Scene, path_or_buffer: str | PathLike | BinaryIO | None, format_id: str, flags: int = 0) -> memoryview | None: ...
+def export_formats() -> list[tuple[str, str, str]]: ...
+def save_snapshot(scene: Scene, path: str | PathLike) -> None: ...
+def load_snapshot(path: str | PathLike) -> Scene: ...
@@ -0,0 +1,7 @@
+#include "embedded_textures.h"
+
+// aiTexture is allocated with new by the importers and frees pcData in its
+// destructor, so it has to be deleted from C++.
+extern "C" void release_texture(struct aiTexture *texture) {
+    delete texture;
+}
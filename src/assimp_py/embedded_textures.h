@@ -0,0 +1,21 @@
+#ifndef ASSIMP_PY_EMBEDDED_TEXTURES_H
+#define ASSIMP_PY_EMBEDDED_TEXTURES_H
+
+// Ownership of embedded textures taken out of an aiScene. A texture detached
+// from its scene (the mTextures entry set to NULL, which ~aiScene skips)
+// outlives the scene and is freed with release_texture.
+
+#include <assimp/texture.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Deletes a detached aiTexture and its pcData. Safe to call with NULL.
+void release_texture(struct aiTexture *texture);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSIMP_PY_EMBEDDED_TEXTURES_H
@@ -0,0 +1,509 @@
+#include "import_cache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include <assimp/MMapIOSystem.h>
+#include <assimp/config.h>
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/version.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Entry files are "<key>.aicache", written to "<key>.aicache.<random>.tmp"
+// first and renamed, so readers never see partial entries
+const char kSuffix[] = ".aicache";
+const char kMagic[8] = {'A', 'P', 'Y', 'C', 'A', 'C', 'H', 'E'};
+const uint32_t kFormat = 1; // Bump when the entry layout changes
+const size_t kHashChunk = 1 << 16; // Bytes hash_file reads at a time, a multiple of 8
+
+uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+// Non-cryptographic 64-bit hash: xxHash64's single lane round and avalanche,
+// split so that files can be hashed a chunk at a time (see hash_file)
+const uint64_t kPrime1 = 0x9E3779B185EBCA87ULL, kPrime2 = 0xC2B2AE3D27D4EB4FULL, kPrime3 = 0x165667B19E3779F9ULL;
+
+uint64_t hash_begin(uint64_t size, uint64_t seed) {
+    return seed + kPrime3 + size;
+}
+
+// Mixes in the whole 8-byte words of `data`; returns the state
+uint64_t hash_words(uint64_t h, const unsigned char *p, size_t size) {
+    for (; size >= 8; size -= 8, p += 8) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        h ^= rotl(word * kPrime2, 31) * kPrime1;
+        h = rotl(h, 27) * kPrime1 + kPrime3;
+    }
+    return h;
+}
+
+// Mixes in the last `size` bytes (fewer than 8) and returns the hash
+uint64_t hash_end(uint64_t h, const unsigned char *p, size_t size) {
+    for (; size; --size, ++p) {
+        h ^= *p * kPrime3;
+        h = rotl(h, 11) * kPrime1;
+    }
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t hash_bytes(const void *data, size_t size, uint64_t seed) {
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    size_t words = size & ~static_cast<size_t>(7);
+    return hash_end(hash_words(hash_begin(size, seed), p, words), p + words, size - words);
+}
+
+// Same as hash_bytes(<contents of path>, size, 0), reading the file in
+// chunks of kHashChunk bytes instead of holding all of it
+bool hash_file(const fs::path &path, uint64_t &size, uint64_t &hash) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    std::streamoff length = file.tellg();
+    if (length < 0) return false;
+    file.seekg(0);
+
+    std::unique_ptr<unsigned char[]> chunk(new unsigned char[kHashChunk]);
+    uint64_t left = static_cast<uint64_t>(length);
+    uint64_t h = hash_begin(left, 0);
+    size_t n = 0;
+    while (left > 0) {
+        n = static_cast<size_t>(std::min<uint64_t>(left, kHashChunk));
+        if (!file.read(reinterpret_cast<char *>(chunk.get()), static_cast<std::streamsize>(n))) return false;
+        left -= n;
+        if (left > 0) h = hash_words(h, chunk.get(), n);
+    }
+    size_t words = n & ~static_cast<size_t>(7);
+    size = static_cast<uint64_t>(length);
+    hash = hash_end(hash_words(h, chunk.get(), words), chunk.get() + words, n - words);
+    return true;
+}
+
+bool read_file(const fs::path &path, std::vector<char> &data) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    std::streamoff size = file.tellg();
+    if (size < 0) return false;
+    data.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    return static_cast<bool>(file.read(data.data(), size));
+}
+
+// A file besides the model the import read, and what it held
+struct Dependency {
+    std::string path;   // Absolute, UTF-8
+    uint64_t size;
+    uint64_t hash;
+};
+
+bool read_dependency(const std::string &path, Dependency &dep) {
+    if (!hash_file(fs::u8path(path), dep.size, dep.hash)) return false;
+    dep.path = path;
+    return true;
+}
+
+// Default or memory-mapped file access, recording the files other than the
+// model the importer opens for reading
+class RecordingIOSystem : public Assimp::MMapIOSystem {
+public:
+    RecordingIOSystem(std::string model, bool map) : MMapIOSystem(map), mModel(std::move(model)) {}
+
+    Assimp::IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        Assimp::IOStream *stream = MMapIOSystem::Open(pFile, pMode);
+        if (stream && !std::strchr(pMode, 'w') && !std::strchr(pMode, 'a')) {
+            std::string path = absolute(pFile);
+            if (!path.empty() && path != mModel && std::find(mOpened.begin(), mOpened.end(), path) == mOpened.end()) {
+                mOpened.push_back(path);
+            }
+        }
+        return stream;
+    }
+
+    const std::vector<std::string> &Opened() const {
+        return mOpened;
+    }
+
+    static std::string absolute(const char *path) {
+        std::error_code ec;
+        fs::path result = fs::absolute(fs::u8path(path), ec);
+        return ec ? std::string() : result.lexically_normal().u8string();
+    }
+
+private:
+    std::string mModel;
+    std::vector<std::string> mOpened;
+};
+
+// Entry layout, in native byte order (caches are not meant to move between
+// machines):
+//   magic[8] format:u32 flags:u32 model_size:u64 model_hash:u64 num_deps:u32
+//   num_deps x (path_len:u32 path[path_len] size:u64 hash:u64)
+//   num_meshes:u32 num_meshes x (name_len:u32 name[name_len])
+//   Assbin file up to the end
+// Assbin does not store mesh names, they are restored from the entry.
+template <typename T> void put(std::string &out, T value) {
+    out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+struct EntryReader {
+    const char *pos, *end;
+
+    template <typename T> bool get(T &value) {
+        if (static_cast<size_t>(end - pos) < sizeof(value)) return false;
+        std::memcpy(&value, pos, sizeof(value));
+        pos += sizeof(value);
+        return true;
+    }
+
+    bool get(std::string &value, size_t size) {
+        if (static_cast<size_t>(end - pos) < size) return false;
+        value.assign(pos, size);
+        pos += size;
+        return true;
+    }
+};
+
+std::string entry_header(unsigned int flags, uint64_t model_size, uint64_t model_hash,
+                         const std::vector<Dependency> &deps, const aiScene *scene) {
+    std::string header(kMagic, sizeof(kMagic));
+    put<uint32_t>(header, kFormat);
+    put<uint32_t>(header, flags);
+    put<uint64_t>(header, model_size);
+    put<uint64_t>(header, model_hash);
+    put<uint32_t>(header, static_cast<uint32_t>(deps.size()));
+    for (const Dependency &dep : deps) {
+        put<uint32_t>(header, static_cast<uint32_t>(dep.path.size()));
+        header += dep.path;
+        put<uint64_t>(header, dep.size);
+        put<uint64_t>(header, dep.hash);
+    }
+    put<uint32_t>(header, scene->mNumMeshes);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiString &name = scene->mMeshes[i]->mName;
+        put<uint32_t>(header, name.length);
+        header.append(name.data, name.length);
+    }
+    return header;
+}
+
+// Checks the entry belongs to the model and every dependency is unchanged,
+// and finds its mesh names and Assbin data
+bool check_entry(const std::vector<char> &entry, unsigned int flags, uint64_t model_size, uint64_t model_hash,
+                 std::vector<std::string> &mesh_names, const char **assbin, size_t *assbin_size) {
+    EntryReader reader{entry.data(), entry.data() + entry.size()};
+    std::string magic;
+    uint32_t format, entry_flags, num_deps;
+    uint64_t size, hash;
+    if (!reader.get(magic, sizeof(kMagic)) || magic.compare(0, sizeof(kMagic), kMagic, sizeof(kMagic)) != 0 ||
+        !reader.get(format) || format != kFormat || !reader.get(entry_flags) || entry_flags != flags ||
+        !reader.get(size) || size != model_size || !reader.get(hash) || hash != model_hash ||
+        !reader.get(num_deps)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < num_deps; ++i) {
+        uint32_t path_size;
+        Dependency expected, current;
+        if (!reader.get(path_size) || !reader.get(expected.path, path_size) || !reader.get(expected.size) ||
+            !reader.get(expected.hash)) {
+            return false;
+        }
+        if (!read_dependency(expected.path, current) || current.size != expected.size ||
+            current.hash != expected.hash) {
+            return false;
+        }
+    }
+    uint32_t num_meshes;
+    if (!reader.get(num_meshes)) return false;
+    mesh_names.resize(num_meshes);
+    for (std::string &name : mesh_names) {
+        uint32_t name_size;
+        if (!reader.get(name_size) || name_size >= AI_MAXLEN || !reader.get(name, name_size)) return false;
+    }
+    *assbin = reader.pos;
+    *assbin_size = static_cast<size_t>(reader.end - reader.pos);
+    return true;
+}
+
+} // namespace
+
+struct ImportCache {
+    struct Entry {
+        uint64_t size;
+        uint64_t last_use;  // Value of `clock` when last read or written
+    };
+
+    fs::path directory;
+    std::mutex mutex;       // Guards everything below
+    std::unordered_map<std::string, Entry> entries; // By file name
+    uint64_t clock = 0;
+    ImportCacheStats stats{};
+
+    // Records a use of the entry `name` of `size` bytes
+    void Use(const std::string &name, uint64_t size) {
+        auto found = entries.find(name);
+        if (found != entries.end()) {
+            stats.bytes -= found->second.size;
+        }
+        entries[name] = Entry{size, ++clock};
+        stats.bytes += size;
+        stats.entries = entries.size();
+    }
+
+    // Removes least recently used entries, except `keep`, until the cache
+    // fits in max_bytes
+    void Evict(const std::string &keep) {
+        while (stats.bytes > stats.max_bytes) {
+            auto oldest = entries.end();
+            for (auto it = entries.begin(); it != entries.end(); ++it) {
+                if (it->first != keep && (oldest == entries.end() || it->second.last_use < oldest->second.last_use)) {
+                    oldest = it;
+                }
+            }
+            if (oldest == entries.end()) break;
+            std::error_code ec;
+            fs::remove(directory / fs::u8path(oldest->first), ec);
+            stats.bytes -= oldest->second.size;
+            stats.evictions++;
+            entries.erase(oldest);
+        }
+        stats.entries = entries.size();
+    }
+};
+
+namespace {
+
+// Whether the scene holds data Assbin does not store, which would be lost
+bool assbin_drops_data(const aiScene *scene) {
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        if (scene->mMeshes[i]->mNumAnimMeshes) return true;
+    }
+    for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
+        if (scene->mAnimations[i]->mNumMorphMeshChannels || scene->mAnimations[i]->mNumMeshChannels) return true;
+    }
+    return false;
+}
+
+// Writes the entry for a freshly imported scene. Failures only mean the next
+// import misses again.
+void store_entry(ImportCache *cache, const std::string &name, unsigned int flags, uint64_t model_size,
+                 uint64_t model_hash, const std::vector<std::string> &opened, const aiScene *scene) {
+    try {
+        if (assbin_drops_data(scene)) return;
+        std::vector<Dependency> deps(opened.size());
+        for (size_t i = 0; i < opened.size(); ++i) {
+            if (!read_dependency(opened[i], deps[i])) return;
+        }
+
+        Assimp::Exporter exporter;
+        const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "assbin", 0);
+        if (!blob) return;
+        std::string header = entry_header(flags, model_size, model_hash, deps, scene);
+        uint64_t size = header.size() + blob->size;
+        {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            if (size > cache->stats.max_bytes) return;
+        }
+
+        char suffix[32];
+        std::snprintf(suffix, sizeof(suffix), ".%08x.tmp", static_cast<unsigned int>(std::random_device()()));
+        fs::path path = cache->directory / fs::u8path(name);
+        fs::path tmp = cache->directory / fs::u8path(name + suffix);
+        {
+            std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+            file.write(header.data(), static_cast<std::streamsize>(header.size()));
+            file.write(static_cast<const char *>(blob->data), static_cast<std::streamsize>(blob->size));
+            if (!file.flush()) {
+                file.close();
+                std::error_code ec;
+                fs::remove(tmp, ec);
+                return;
+            }
+        }
+        std::error_code ec;
+        fs::rename(tmp, path, ec);
+        if (ec) {
+            fs::remove(tmp, ec);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(cache->mutex);
+        cache->stats.stores++;
+        cache->Use(name, size);
+        cache->Evict(name);
+    } catch (const std::exception &) {
+        // Not cached
+    }
+}
+
+} // namespace
+
+extern "C" ImportCache *import_cache_open(const char *directory, uint64_t max_bytes, char *error,
+                                          size_t error_size) {
+    try {
+        std::unique_ptr<ImportCache> cache(new ImportCache());
+        cache->directory = fs::u8path(directory);
+        cache->stats.max_bytes = max_bytes;
+        fs::create_directories(cache->directory);
+
+        // Entries left by earlier runs, least recently used first: hits
+        // refresh the modification time of their entry. Temporary files a
+        // crashed writer left behind are removed; a writer in another process
+        // whose file goes this way only fails to store its entry
+        struct Found {
+            fs::file_time_type time;
+            std::string name;
+            uint64_t size;
+        };
+        std::vector<Found> found;
+        for (const fs::directory_entry &item : fs::directory_iterator(cache->directory)) {
+            std::error_code ec;
+            if (item.path().extension() != kSuffix) {
+                if (item.path().filename().u8string().find(kSuffix) != std::string::npos) {
+                    fs::remove(item.path(), ec);
+                }
+                continue;
+            }
+            if (!item.is_regular_file(ec)) continue;
+            Found entry{item.last_write_time(ec), item.path().filename().u8string(), 0};
+            if (!ec) entry.size = item.file_size(ec);
+            if (!ec) found.push_back(entry);
+        }
+        std::sort(found.begin(), found.end(), [](const Found &a, const Found &b) { return a.time < b.time; });
+        for (const Found &entry : found) {
+            cache->Use(entry.name, entry.size);
+        }
+        cache->Evict("");
+        return cache.release();
+    } catch (const std::exception &e) {
+        copy_error(e.what(), error, error_size);
+        return nullptr;
+    }
+}
+
+extern "C" void import_cache_close(ImportCache *cache) {
+    delete cache;
+}
+
+extern "C" void import_cache_get_stats(ImportCache *cache, ImportCacheStats *stats) {
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    *stats = cache->stats;
+}
+
+extern "C" void import_cache_clear(ImportCache *cache) {
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    std::vector<fs::path> files;
+    std::error_code ec;
+    for (fs::directory_iterator it(cache->directory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().filename().u8string().find(kSuffix) != std::string::npos) {
+            files.push_back(it->path()); // Entries and temporary files
+        }
+    }
+    for (const fs::path &file : files) {
+        fs::remove(file, ec);
+    }
+    cache->entries.clear();
+    cache->stats.bytes = 0;
+    cache->stats.entries = 0;
+}
+
+extern "C" const aiScene *import_path_cached(ImportCache *cache, const char *path, unsigned int flags,
+                                             const ImportConfig *config, ImportProgress *progress,
+                                             char *error, size_t error_size) {
+    uint64_t model_size = 0, model_hash = 0;
+    std::string model_path = RecordingIOSystem::absolute(path);
+    if (model_path.empty() || !hash_file(fs::u8path(model_path), model_size, model_hash)) {
+        return import_path(path, flags, config, progress, error, error_size); // Assimp reports the error
+    }
+
+    // The key covers everything deciding what the import returns, but the
+    // other files it reads, which the entry checks
+    std::string extension = fs::u8path(model_path).extension().u8string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    std::string meta = extension + '|' + std::to_string(flags) + '|' + std::to_string(aiGetVersionMajor()) + '.' +
+                       std::to_string(aiGetVersionMinor()) + '.' + std::to_string(aiGetVersionPatch()) + '.' +
+                       std::to_string(aiGetVersionRevision()) + '|' + std::to_string(kFormat);
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx%s",
+                  static_cast<unsigned long long>(hash_bytes(meta.data(), meta.size(), model_hash)), kSuffix);
+    fs::path entry_path = cache->directory / fs::u8path(name);
+
+    const aiScene *scene = nullptr;
+    std::string message;
+    try {
+        std::vector<char> entry;
+        std::vector<std::string> mesh_names;
+        const char *assbin = nullptr;
+        size_t assbin_size = 0;
+        if (read_file(entry_path, entry) &&
+            check_entry(entry, flags, model_size, model_hash, mesh_names, &assbin, &assbin_size)) {
+            // Hit: the stored scene is already post-processed
+            Assimp::Importer importer;
+            ImportProgressHandler *handler = attach_progress(importer, progress, 0);
+            scene = finish_import(importer, importer.ReadFileFromMemory(assbin, assbin_size, 0, "assbin"), progress,
+                                  handler, message);
+            if (scene && scene->mNumMeshes != mesh_names.size()) {
+                message = "Corrupt cache entry";
+                scene = nullptr;
+            }
+            if (scene) {
+                scene = importer.GetOrphanedScene();
+                for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+                    scene->mMeshes[i]->mName.Set(mesh_names[i]);
+                }
+                std::error_code ec;
+                fs::last_write_time(entry_path, fs::file_time_type::clock::now(), ec);
+                std::lock_guard<std::mutex> lock(cache->mutex);
+                cache->stats.hits++;
+                cache->Use(name, entry.size());
+            }
+            if (scene || (progress && progress->cancelled)) {
+                if (!scene) copy_error(message.c_str(), error, error_size);
+                return scene;
+            }
+            // Unreadable entry, replaced by the import below
+        }
+        std::vector<char>().swap(entry);
+
+        {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            cache->stats.misses++;
+        }
+        Assimp::Importer importer;
+        RecordingIOSystem *io = new RecordingIOSystem(model_path, config->map_files != 0);
+        importer.SetIOHandler(io); // Owned by the importer
+        apply_import_config(importer, config);
+        ImportProgressHandler *handler = attach_progress(importer, progress, flags);
+        scene = finish_import(importer, importer.ReadFile(path, flags), progress, handler, message);
+        if (scene) {
+            store_entry(cache, name, flags, model_size, model_hash, io->Opened(), scene);
+            scene = importer.GetOrphanedScene();
+        }
+    } catch (const std::exception &e) {
+        message = e.what();
+        scene = nullptr;
+    }
+
+    if (!scene) copy_error(message.c_str(), error, error_size);
+    return scene;
+}
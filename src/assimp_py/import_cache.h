@@ -0,0 +1,57 @@
+#ifndef ASSIMP_PY_IMPORT_CACHE_H
+#define ASSIMP_PY_IMPORT_CACHE_H
+
+// On-disk cache of post-processed scenes, stored with Assimp's Assbin
+// exporter. Entries are keyed by a hash of the model file's contents, the
+// post-processing flags, its extension and the Assimp version. Each entry
+// also records the size and hash of every other file the import opened
+// (.mtl, textures, .bin buffers), and a change to any of them is a miss. A hit
+// reads the Assbin entry instead of parsing and post-processing the model.
+// None of these functions touch Python, call them with the GIL released.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assimp/scene.h>
+
+#include "import_progress.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Cache directory shared by any number of concurrent imports
+typedef struct ImportCache ImportCache;
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t stores;        // Entries written after a miss
+    uint64_t evictions;     // Entries removed to stay under max_bytes
+    uint64_t entries;       // Entries currently in the directory
+    uint64_t bytes;         // Their total size
+    uint64_t max_bytes;
+} ImportCacheStats;
+
+// Open (creating it if needed) the cache in `directory`, keeping it under
+// `max_bytes` by evicting the least recently used entries. Returns NULL and
+// fills `error` if the directory cannot be created or read.
+ImportCache *import_cache_open(const char *directory, uint64_t max_bytes, char *error, size_t error_size);
+void import_cache_close(ImportCache *cache);
+
+void import_cache_get_stats(ImportCache *cache, ImportCacheStats *stats);
+
+// Remove every entry in the directory
+void import_cache_clear(ImportCache *cache);
+
+// Import the file at `path` like import_path, answering from `cache` when it
+// holds an up to date entry and storing the scene in it otherwise. Failing to
+// write the entry does not fail the import.
+const struct aiScene *import_path_cached(ImportCache *cache, const char *path, unsigned int flags,
+                                         const ImportConfig *config, ImportProgress *progress,
+                                         char *error, size_t error_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSIMP_PY_IMPORT_CACHE_H
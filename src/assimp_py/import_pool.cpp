@@ -0,0 +1,175 @@
+#include "import_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <assimp/Importer.hpp>
+#include <assimp/cimport.h>
+
+struct ImportPool {
+    std::vector<std::string> paths;
+    unsigned int flags = 0;
+    const CancelFlag *cancel = nullptr;
+    bool collect_stats = false;
+
+    std::atomic<size_t> next_path{0};   // Next file a worker should pick up
+    std::atomic<bool> stopping{false};
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::vector<ImportResult> done;     // Finished imports in completion order, reserved up front so
+                                        // a worker can always queue its result
+    size_t num_returned = 0;            // done[num_returned:] have not been handed out yet
+
+    std::vector<std::thread> workers;
+};
+
+static void fail_import(ImportResult &result, const char *message) {
+    result.status = IMPORT_FAILED;
+    result.scene = nullptr;
+    copy_error(message, result.error, sizeof(result.error));
+}
+
+static void import_one(Assimp::Importer &importer, ImportProgressHandler *handler, ImportProgress &progress,
+                       const std::string &path, unsigned int flags, ImportResult &result) {
+    if (progress.cancel && cancel_flag_is_set(progress.cancel)) {
+        result.status = IMPORT_CANCELLED;
+        return;
+    }
+
+    // Same existence check as import_file, so missing files map to FileNotFoundError
+    FILE *f = std::fopen(path.c_str(), "rb");
+    if (!f) {
+        result.status = IMPORT_NOT_FOUND;
+        return;
+    }
+    std::fclose(f);
+
+    if (handler) handler->Reset(&importer, flags);
+    std::string message;
+    if (!finish_import(importer, importer.ReadFile(path, flags), &progress, handler, message)) {
+        if (progress.cancelled) {
+            result.status = IMPORT_CANCELLED;
+        } else {
+            fail_import(result, message.c_str());
+        }
+        importer.FreeScene();
+        return;
+    }
+
+    // Detach the scene from the importer so it can be reused for the next
+    // file; the orphaned scene is freed by aiReleaseImport.
+    if (handler && progress.stats) result.stats = *progress.stats;
+    result.status = IMPORT_OK;
+    result.scene = importer.GetOrphanedScene();
+}
+
+static void worker_main(ImportPool *pool) {
+    std::unique_ptr<Assimp::Importer> importer;
+    ImportStats stats;
+    ImportProgress progress = {nullptr, nullptr, 0.0, pool->cancel, pool->collect_stats ? &stats : nullptr, 0};
+    ImportProgressHandler *handler = nullptr;
+    try {
+        importer.reset(new Assimp::Importer());
+        if (pool->cancel || pool->collect_stats) {
+            handler = new ImportProgressHandler(&progress);
+            importer->SetProgressHandler(handler); // Owned by the importer
+        }
+    } catch (...) {
+        // Keep claiming files so each one still gets a (failed) result
+        importer.reset();
+        handler = nullptr;
+    }
+    while (!pool->stopping.load()) {
+        size_t index = pool->next_path.fetch_add(1);
+        if (index >= pool->paths.size()) break;
+
+        ImportResult result;
+        std::memset(&result, 0, sizeof(result));
+        result.index = index;
+        // Nothing may escape a worker: a file without a result would leave
+        // import_pool_next waiting forever.
+        try {
+            if (importer) {
+                import_one(*importer, handler, progress, pool->paths[index], pool->flags, result);
+            } else {
+                fail_import(result, "Could not create an importer");
+            }
+        } catch (const std::exception &e) {
+            fail_import(result, e.what());
+        } catch (...) {
+            fail_import(result, "Unknown error during import");
+        }
+        if (result.status == IMPORT_FAILED && importer) importer->FreeScene();
+
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            pool->done.push_back(result);
+        }
+        pool->ready.notify_one();
+    }
+}
+
+extern "C" ImportPool *import_pool_create(const char *const *paths, size_t num_paths, unsigned int flags, unsigned int num_threads,
+                                          const CancelFlag *cancel, int collect_stats) {
+    ImportPool *pool = nullptr;
+    try {
+        pool = new ImportPool();
+        pool->paths.assign(paths, paths + num_paths);
+        pool->flags = flags;
+        pool->cancel = cancel;
+        pool->collect_stats = collect_stats != 0;
+
+        if (num_threads == 0) {
+            num_threads = std::thread::hardware_concurrency();
+        }
+        if (num_threads == 0) {
+            num_threads = 1;
+        }
+        if (num_threads > num_paths) {
+            num_threads = static_cast<unsigned int>(num_paths);
+        }
+
+        pool->done.reserve(num_paths);
+        pool->workers.reserve(num_threads);
+        for (unsigned int i = 0; i < num_threads; ++i) {
+            pool->workers.emplace_back(worker_main, pool);
+        }
+    } catch (...) {
+        import_pool_destroy(pool);
+        return nullptr;
+    }
+    return pool;
+}
+
+extern "C" int import_pool_next(ImportPool *pool, ImportResult *result) {
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    if (pool->num_returned >= pool->paths.size()) {
+        return 0;
+    }
+    pool->ready.wait(lock, [pool] { return pool->done.size() > pool->num_returned; });
+    *result = pool->done[pool->num_returned];
+    pool->num_returned++;
+    return 1;
+}
+
+extern "C" void import_pool_destroy(ImportPool *pool) {
+    if (!pool) return;
+
+    pool->stopping.store(true);
+    for (std::thread &worker : pool->workers) {
+        if (worker.joinable()) worker.join();
+    }
+    for (size_t i = pool->num_returned; i < pool->done.size(); ++i) {
+        aiReleaseImport(pool->done[i].scene);
+    }
+    delete pool;
+}
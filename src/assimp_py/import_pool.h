@@ -0,0 +1,55 @@
+#ifndef ASSIMP_PY_IMPORT_POOL_H
+#define ASSIMP_PY_IMPORT_POOL_H
+
+// C interface to a pool of native threads importing files with Assimp.
+// Each worker drives its own Assimp::Importer, so imports never share state.
+// None of these functions touch Python, call them with the GIL released.
+
+#include <stddef.h>
+#include <assimp/scene.h>
+
+#include "import_progress.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ImportPool ImportPool;
+
+typedef enum {
+    IMPORT_OK = 0,
+    IMPORT_NOT_FOUND,       // The file could not be opened
+    IMPORT_FAILED,          // Assimp failed to load the file
+    IMPORT_CANCELLED,       // The cancel flag was set before or during the import
+} ImportStatus;
+
+typedef struct {
+    size_t index;                   // Position of the file in the submitted list
+    ImportStatus status;
+    const struct aiScene *scene;    // Owned by the caller (aiReleaseImport), NULL unless IMPORT_OK
+    char error[512];                // Assimp error message when IMPORT_FAILED
+    ImportStats stats;              // Timings and memory when IMPORT_OK and the pool collects stats
+} ImportResult;
+
+// Start importing `num_paths` files on `num_threads` workers (0 picks the
+// number of hardware threads). The paths are copied. Once `cancel` (which
+// may be NULL, and must outlive the pool) is set, running imports stop at
+// their next checkpoint and the remaining files are returned as
+// IMPORT_CANCELLED. With `collect_stats` every result also gets its
+// ImportStats. Returns NULL if the pool could not be created.
+ImportPool *import_pool_create(const char *const *paths, size_t num_paths, unsigned int flags, unsigned int num_threads,
+                               const CancelFlag *cancel, int collect_stats);
+
+// Block until the next import finishes, in completion order. Returns 1 and
+// fills `result`, or 0 once every file has been returned.
+int import_pool_next(ImportPool *pool, ImportResult *result);
+
+// Stop the workers after their current file, wait for them and release
+// every scene that was not returned by import_pool_next.
+void import_pool_destroy(ImportPool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSIMP_PY_IMPORT_POOL_H
@@ -0,0 +1,266 @@
+#include "import_progress.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include <assimp/Exceptional.h>
+#include <assimp/config.h>
+#include <assimp/Importer.hpp>
+#include <assimp/MMapIOSystem.h>
+#include <assimp/postprocess.h>
+
+// Internal headers, for the list of post-processing steps behind
+// UpdatePostProcess() step indices
+#include "Common/BaseProcess.h"
+#include "Common/Importer.h"
+
+struct CancelFlag {
+    std::atomic<bool> set{false};
+};
+
+extern "C" CancelFlag *cancel_flag_create(void) {
+    return new (std::nothrow) CancelFlag();
+}
+
+extern "C" void cancel_flag_set(CancelFlag *flag) {
+    flag->set.store(true);
+}
+
+extern "C" int cancel_flag_is_set(const CancelFlag *flag) {
+    return flag->set.load();
+}
+
+extern "C" void cancel_flag_destroy(CancelFlag *flag) {
+    delete flag;
+}
+
+extern "C" double monotonic_seconds(void) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Post-processing steps are named after the aiProcess flag enabling them
+static const struct {
+    unsigned int flag;
+    const char *name;
+} step_names[] = {
+    {aiProcess_CalcTangentSpace, "CalcTangentSpace"},
+    {aiProcess_JoinIdenticalVertices, "JoinIdenticalVertices"},
+    {aiProcess_MakeLeftHanded, "MakeLeftHanded"},
+    {aiProcess_Triangulate, "Triangulate"},
+    {aiProcess_RemoveComponent, "RemoveComponent"},
+    {aiProcess_GenNormals, "GenNormals"},
+    {aiProcess_GenSmoothNormals, "GenSmoothNormals"},
+    {aiProcess_SplitLargeMeshes, "SplitLargeMeshes"},
+    {aiProcess_PreTransformVertices, "PreTransformVertices"},
+    {aiProcess_LimitBoneWeights, "LimitBoneWeights"},
+    {aiProcess_ImproveCacheLocality, "ImproveCacheLocality"},
+    {aiProcess_RemoveRedundantMaterials, "RemoveRedundantMaterials"},
+    {aiProcess_FixInfacingNormals, "FixInfacingNormals"},
+    {aiProcess_PopulateArmatureData, "PopulateArmatureData"},
+    {aiProcess_SortByPType, "SortByPType"},
+    {aiProcess_FindDegenerates, "FindDegenerates"},
+    {aiProcess_FindInvalidData, "FindInvalidData"},
+    {aiProcess_GenUVCoords, "GenUVCoords"},
+    {aiProcess_TransformUVCoords, "TransformUVCoords"},
+    {aiProcess_FindInstances, "FindInstances"},
+    {aiProcess_OptimizeMeshes, "OptimizeMeshes"},
+    {aiProcess_OptimizeGraph, "OptimizeGraph"},
+    {aiProcess_FlipUVs, "FlipUVs"},
+    {aiProcess_FlipWindingOrder, "FlipWindingOrder"},
+    {aiProcess_SplitByBoneCount, "SplitByBoneCount"},
+    {aiProcess_Debone, "Debone"},
+    {aiProcess_GlobalScale, "GlobalScale"},
+    {aiProcess_EmbedTextures, "EmbedTextures"},
+    {aiProcess_DropNormals, "DropNormals"},
+    {aiProcess_GenBoundingBoxes, "GenBoundingBoxes"},
+};
+
+static const char *step_name(const Assimp::BaseProcess *process) {
+    for (const auto &step : step_names) {
+        if (process->IsActive(step.flag)) return step.name;
+    }
+    return "Unknown";
+}
+
+void ImportProgressHandler::Reset(const Assimp::Importer *importer, unsigned int flags) {
+    mProgress->cancelled = 0;
+    mReported = false;
+    mImporter = importer;
+    mFlags = flags & ~aiProcess_ValidateDataStructure; // Run before the steps, as part of preprocessing
+    mReading = false;
+    mStep = -1;
+    mPostProcessed = false;
+    mStart = Clock::now();
+    if (mProgress->stats) {
+        std::memset(mProgress->stats, 0, sizeof(*mProgress->stats));
+    }
+}
+
+// Adds the time of the running step, if it is active, to the stats
+void ImportProgressHandler::EndStep(Clock::time_point now) {
+    if (mStep < 0) return;
+    const Assimp::ImporterPimpl *pimpl = mImporter->Pimpl();
+    const unsigned int index = static_cast<unsigned int>(mStep);
+    const Assimp::BaseProcess *process = pimpl->mPostProcessingSteps[index];
+    mStep = -1;
+    if (!process->IsActive(mFlags)) return;
+
+    ImportStats *stats = mProgress->stats;
+    const char *name = step_name(process);
+    // A fused mesh pass runs several steps from its first one
+    if (std::find(pimpl->mFusedMeshPasses.begin(), pimpl->mFusedMeshPasses.end(), index) != pimpl->mFusedMeshPasses.end()) {
+        name = "MeshPass";
+    }
+    double seconds = std::chrono::duration<double>(now - mStepStart).count();
+    // Several steps may share a flag: SplitLargeMeshes is split in two, and the
+    // spatial sort helpers run for CalcTangentSpace, GenSmoothNormals and
+    // JoinIdenticalVertices (named after the first)
+    for (unsigned int i = 0; i < stats->num_steps; ++i) {
+        if (stats->steps[i].name == name) {
+            stats->steps[i].seconds += seconds;
+            return;
+        }
+    }
+    if (stats->num_steps < IMPORT_STATS_MAX_STEPS) {
+        stats->steps[stats->num_steps].name = name;
+        stats->steps[stats->num_steps].seconds = seconds;
+        stats->num_steps++;
+    }
+}
+
+void ImportProgressHandler::UpdateFileRead(int currentStep, int numberOfSteps) {
+    if (mProgress->stats && mImporter) {
+        // Called once before the importer runs and once after, with calls in
+        // between from importers reporting their own progress
+        Clock::time_point now = Clock::now();
+        if (!mReading) {
+            mReading = true;
+            mReadStart = now;
+        }
+        mReadEnd = now;
+    }
+    ProgressHandler::UpdateFileRead(currentStep, numberOfSteps);
+}
+
+void ImportProgressHandler::UpdatePostProcess(int currentStep, int numberOfSteps) {
+    if (mProgress->stats && mImporter) {
+        // Called before each step, active or not, and once after the last
+        Clock::time_point now = Clock::now();
+        if (!mPostProcessed) {
+            mPostProcessed = true;
+            mProgress->stats->preprocess = std::chrono::duration<double>(now - mReadEnd).count();
+        }
+        EndStep(now);
+    }
+    ProgressHandler::UpdatePostProcess(currentStep, numberOfSteps);
+    // Started after the progress callback, so waiting for the GIL is not
+    // counted in the step
+    if (mProgress->stats && mImporter && currentStep < numberOfSteps &&
+        static_cast<size_t>(currentStep) < mImporter->Pimpl()->mPostProcessingSteps.size()) {
+        mStep = currentStep;
+        mStepStart = Clock::now();
+    }
+}
+
+void ImportProgressHandler::Finish() {
+    ImportStats *stats = mProgress->stats;
+    if (!stats || !mImporter) return;
+
+    Clock::time_point now = Clock::now();
+    EndStep(now);
+    if (mReading) {
+        stats->detect = std::chrono::duration<double>(mReadStart - mStart).count();
+        stats->read = std::chrono::duration<double>(mReadEnd - mReadStart).count();
+        if (!mPostProcessed) {
+            stats->preprocess = std::chrono::duration<double>(now - mReadEnd).count(); // No steps (flags 0)
+        }
+    }
+    stats->total = std::chrono::duration<double>(now - mStart).count();
+    mImporter->GetMemoryRequirements(stats->memory);
+}
+
+bool ImportProgressHandler::Update(float percentage) {
+    if (mProgress->cancelled) {
+        throw DeadlyImportError("Import cancelled");
+    }
+    if (mProgress->cancel && cancel_flag_is_set(mProgress->cancel)) {
+        mProgress->cancelled = 1;
+        throw DeadlyImportError("Import cancelled");
+    }
+    if (!mProgress->update) {
+        return true;
+    }
+
+    // Only call back every `interval` seconds: the OBJ parser reports after
+    // every line, and each report may have to wait for the GIL.
+    auto now = std::chrono::steady_clock::now();
+    if (mReported && std::chrono::duration<double>(now - mLastReport).count() < mProgress->interval) {
+        return true;
+    }
+    mReported = true;
+    mLastReport = now;
+    if (!mProgress->update(mProgress->ctx, percentage < 0.0f ? 0.0f : percentage)) {
+        mProgress->cancelled = 1;
+        throw DeadlyImportError("Import cancelled");
+    }
+    return true;
+}
+
+void apply_import_config(Assimp::Importer &importer, const ImportConfig *config) {
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, static_cast<int>(config->num_threads));
+    importer.SetPropertyBool(AI_CONFIG_PP_FUSE_MESH_STEPS, config->fuse_mesh_steps != 0);
+    if (config->map_files && importer.IsDefaultIOHandler()) {
+        importer.SetIOHandler(new Assimp::MMapIOSystem()); // Owned by the importer
+    }
+}
+
+void copy_error(const char *message, char *error, size_t error_size) {
+    if (error_size > 0) {
+        std::strncpy(error, message ? message : "", error_size - 1);
+        error[error_size - 1] = '\0';
+    }
+}
+
+ImportProgressHandler *attach_progress(Assimp::Importer &importer, ImportProgress *progress, unsigned int flags) {
+    if (!progress) return nullptr;
+    ImportProgressHandler *handler = new ImportProgressHandler(progress);
+    importer.SetProgressHandler(handler); // Owned by the importer
+    handler->Reset(&importer, flags);
+    return handler;
+}
+
+const aiScene *finish_import(Assimp::Importer &importer, const aiScene *scene, const ImportProgress *progress,
+                             ImportProgressHandler *handler, std::string &message) {
+    if (progress && progress->cancelled) {
+        message = "Import cancelled";
+        return nullptr; // Possibly half post-processed, freed with the importer
+    }
+    if (!scene || !scene->mRootNode || (scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE)) {
+        message = importer.GetErrorString();
+        return nullptr;
+    }
+    if (handler) handler->Finish();
+    return scene;
+}
+
+extern "C" const aiScene *import_path(const char *path, unsigned int flags, const ImportConfig *config,
+                                      ImportProgress *progress, char *error, size_t error_size) {
+    const aiScene *scene = nullptr;
+    std::string message;
+    try {
+        Assimp::Importer importer;
+        apply_import_config(importer, config);
+        ImportProgressHandler *handler = attach_progress(importer, progress, flags);
+        scene = finish_import(importer, importer.ReadFile(path, flags), progress, handler, message);
+        if (scene) scene = importer.GetOrphanedScene();
+    } catch (const std::exception &e) {
+        message = e.what();
+        scene = nullptr;
+    }
+
+    if (!scene) copy_error(message.c_str(), error, error_size);
+    return scene;
+}
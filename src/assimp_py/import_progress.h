@@ -0,0 +1,144 @@
+#ifndef ASSIMP_PY_IMPORT_PROGRESS_H
+#define ASSIMP_PY_IMPORT_PROGRESS_H
+
+// Progress reporting, cooperative cancellation and timing of imports, through
+// an Assimp::ProgressHandler. Imports check for cancellation at every progress
+// checkpoint Assimp reports: before and after parsing (the OBJ parser also
+// while it reads) and between post-processing steps. The same checkpoints
+// split the import into timed stages.
+// None of these functions touch Python, call them with the GIL released; the
+// update callback reacquires it if it needs to.
+
+#include <stddef.h>
+#include <assimp/scene.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Thread-safe flag shared between the thread asking to cancel and any number
+// of imports watching it
+typedef struct CancelFlag CancelFlag;
+
+CancelFlag *cancel_flag_create(void);
+void cancel_flag_set(CancelFlag *flag);
+int cancel_flag_is_set(const CancelFlag *flag);
+void cancel_flag_destroy(CancelFlag *flag);
+
+// Most post-processing steps an ImportStats records, one per aiProcess flag
+#define IMPORT_STATS_MAX_STEPS 32
+
+// Where an import spent its time, in seconds, and the memory of the scene
+typedef struct {
+    double detect;          // Finding an importer for the file
+    double read;            // The importer reading the file
+    double preprocess;      // Validation and scene preprocessing
+    double total;           // The whole import, including the above and the steps
+    unsigned int num_steps;
+    struct {
+        const char *name;   // Static name of the step's aiProcess flag, e.g. "Triangulate"
+        double seconds;
+    } steps[IMPORT_STATS_MAX_STEPS];    // Active post-processing steps, in the order they first ran, one per flag
+    struct aiMemoryInfo memory;         // Importer::GetMemoryRequirements of the imported scene
+} ImportStats;
+
+typedef struct {
+    // Called with the estimated progress, from 0 to 1, at most every
+    // `interval` seconds (the first checkpoint is always reported).
+    // Returns 0 to cancel the import. May be NULL.
+    int (*update)(void *ctx, float progress);
+    void *ctx;
+    double interval;
+    const CancelFlag *cancel;   // Checked at every checkpoint, may be NULL
+    ImportStats *stats;         // Filled in by successful imports, may be NULL
+    int cancelled;              // Set once the import was cancelled
+} ImportProgress;
+
+// Seconds on a monotonic clock, the one ImportStats is measured with
+double monotonic_seconds(void);
+
+// Importer properties of an import, none of which change the scene it returns
+typedef struct {
+    unsigned int num_threads;   // AI_CONFIG_IMPORT_NUM_THREADS
+    int fuse_mesh_steps;        // AI_CONFIG_PP_FUSE_MESH_STEPS
+    int map_files;              // Read files through memory mappings (MMapIOSystem)
+} ImportConfig;
+
+// Import the file at `path` like aiImportFile, reporting to `progress` (which
+// may be NULL), with the properties in `config`.
+// Returns a scene to be freed with aiReleaseImport, or NULL and fills `error`;
+// `progress->cancelled` tells whether it was cancelled.
+const struct aiScene *import_path(const char *path, unsigned int flags, const ImportConfig *config,
+                                  ImportProgress *progress, char *error, size_t error_size);
+
+#ifdef __cplusplus
+}
+
+#include <chrono>
+#include <string>
+#include <assimp/Importer.hpp>
+#include <assimp/ProgressHandler.hpp>
+
+class ImportProgressHandler;
+
+// Set the properties in `config` on `importer`, and its IO handler unless
+// it already has a custom one
+void apply_import_config(Assimp::Importer &importer, const ImportConfig *config);
+
+// Copy `message` into the `error_size` bytes of `error`, truncated and NUL
+// terminated. Does not throw.
+void copy_error(const char *message, char *error, size_t error_size);
+
+// Give `importer` a handler reporting to `progress` and start an import with
+// post-processing `flags`. Returns the handler (owned by the importer), or
+// nullptr if `progress` is NULL.
+ImportProgressHandler *attach_progress(Assimp::Importer &importer, ImportProgress *progress, unsigned int flags);
+
+// Check the `scene` an import by `importer` returned. Returns it, still owned
+// by the importer, once `handler` (may be nullptr) has filled in the stats.
+// Returns nullptr and sets `message` if the import failed or was cancelled;
+// a scene left half post-processed by cancelling is freed with the importer.
+const aiScene *finish_import(Assimp::Importer &importer, const aiScene *scene, const ImportProgress *progress,
+                             ImportProgressHandler *handler, std::string &message);
+
+// Handler for one import at a time. Assimp 5.4 ignores the value returned by
+// Update(), so cancelling throws a DeadlyImportError instead: the importer
+// catches it and fails the import. Cancelling during post-processing leaves
+// a partially processed scene, which callers must free when
+// `progress->cancelled` is set.
+class ImportProgressHandler : public Assimp::ProgressHandler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit ImportProgressHandler(ImportProgress *progress) : mProgress(progress) {}
+
+    bool Update(float percentage) override;
+    void UpdateFileRead(int currentStep, int numberOfSteps) override;
+    void UpdatePostProcess(int currentStep, int numberOfSteps) override;
+
+    // Start reporting a new import by `importer` with post-processing
+    // `flags` (resets the throttling and the timers)
+    void Reset(const Assimp::Importer *importer, unsigned int flags);
+
+    // Fill in `progress->stats` once the import returned, while `importer`
+    // still holds the scene
+    void Finish();
+
+private:
+    void EndStep(Clock::time_point now);
+
+    ImportProgress *mProgress;
+    bool mReported = false;
+    Clock::time_point mLastReport;
+
+    // Stage timing, when mProgress->stats is set
+    const Assimp::Importer *mImporter = nullptr;
+    unsigned int mFlags = 0;
+    Clock::time_point mStart, mReadStart, mReadEnd, mStepStart;
+    bool mReading = false;          // mReadStart is set
+    int mStep = -1;                 // Index of the running post-processing step
+    bool mPostProcessed = false;    // The post-processing steps started
+};
+#endif
+
+#endif // ASSIMP_PY_IMPORT_PROGRESS_H
@@ -0,0 +1,99 @@
+#include "memory_import.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+
+#include <assimp/config.h>
+#include <assimp/Importer.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/MemoryIOWrapper.h>
+
+namespace {
+
+// IOSystem answering every request from the resolver callbacks. The importer
+// puts it behind a MemoryIOSystem, which serves the main file itself.
+// Resolved files stay cached until the import is over, so Exists() followed
+// by Open() only asks the resolver once.
+class ResolverIOSystem : public Assimp::IOSystem {
+public:
+    explicit ResolverIOSystem(const ImportResolver *resolver) : mResolver(resolver) {}
+
+    ~ResolverIOSystem() override {
+        for (auto &entry : mFiles) {
+            if (entry.second.found) {
+                mResolver->release(mResolver->ctx, entry.second.handle);
+            }
+        }
+    }
+
+    bool Exists(const char *pFile) const override {
+        return Lookup(pFile).found;
+    }
+
+    char getOsSeparator() const override {
+        return '/';
+    }
+
+    Assimp::IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        if (std::strchr(pMode, 'w') || std::strchr(pMode, 'a')) {
+            return nullptr; // Read only
+        }
+        const File &file = Lookup(pFile);
+        if (!file.found) {
+            return nullptr;
+        }
+        return new Assimp::MemoryIOStream(static_cast<const uint8_t *>(file.data), file.size, false);
+    }
+
+    void Close(Assimp::IOStream *pFile) override {
+        delete pFile;
+    }
+
+private:
+    struct File {
+        bool found = false;
+        const void *data = nullptr;
+        size_t size = 0;
+        void *handle = nullptr;
+    };
+
+    const File &Lookup(const char *path) const {
+        auto it = mFiles.find(path);
+        if (it != mFiles.end()) {
+            return it->second;
+        }
+        File file;
+        if (mResolver) {
+            file.found = mResolver->open(mResolver->ctx, path, &file.data, &file.size, &file.handle) != 0;
+        }
+        return mFiles.emplace(path, file).first->second;
+    }
+
+    const ImportResolver *mResolver;
+    mutable std::map<std::string, File> mFiles;
+};
+
+} // namespace
+
+extern "C" const aiScene *import_memory(const void *data, size_t size, unsigned int flags, const char *hint,
+                                        const ImportResolver *resolver, const ImportConfig *config,
+                                        ImportProgress *progress, char *error, size_t error_size) {
+    const aiScene *scene = nullptr;
+    std::string message;
+    try {
+        Assimp::Importer importer;
+        importer.SetIOHandler(new ResolverIOSystem(resolver));
+        apply_import_config(importer, config);
+        ImportProgressHandler *handler = attach_progress(importer, progress, flags);
+        scene = finish_import(importer, importer.ReadFileFromMemory(data, size, flags, hint ? hint : ""), progress,
+                              handler, message);
+        if (scene) scene = importer.GetOrphanedScene();
+    } catch (const std::exception &e) {
+        message = e.what();
+        scene = nullptr;
+    }
+
+    if (!scene) copy_error(message.c_str(), error, error_size);
+    return scene;
+}
@@ -0,0 +1,39 @@
+#ifndef ASSIMP_PY_MEMORY_IMPORT_H
+#define ASSIMP_PY_MEMORY_IMPORT_H
+
+// C interface to Assimp::Importer::ReadFileFromMemory with a custom IOSystem
+// that serves secondary files (.mtl, .bin, textures, ...) through callbacks.
+// Call with the GIL released; the callbacks reacquire it if they need to.
+
+#include <stddef.h>
+#include <assimp/scene.h>
+
+#include "import_progress.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    // Look up a secondary file the importer wants to open. Returns 1 and
+    // sets `data`/`size` (which must stay valid until `release` is called
+    // with `handle`), or 0 if there is no such file.
+    int (*open)(void *ctx, const char *path, const void **data, size_t *size, void **handle);
+    void (*release)(void *ctx, void *handle);
+    void *ctx;
+} ImportResolver;
+
+// Import a model from `size` bytes at `data` without copying them. `hint` is
+// the file extension used to pick the importer ("" lets Assimp guess).
+// `resolver` may be NULL, in which case secondary files are never found, and
+// so may `progress`; `config` is as for import_path.
+// Returns a scene to be freed with aiReleaseImport, or NULL and fills `error`.
+const struct aiScene *import_memory(const void *data, size_t size, unsigned int flags, const char *hint,
+                                    const ImportResolver *resolver, const ImportConfig *config,
+                                    ImportProgress *progress, char *error, size_t error_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSIMP_PY_MEMORY_IMPORT_H
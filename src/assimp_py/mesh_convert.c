@@ -0,0 +1,177 @@
+#include "mesh_convert.h"
+
+#include <float.h>
+#include <string.h>
+
+// Rows are read through a byte pointer as aiMesh arrays may hold more
+// components per row (e.g. 2 component texcoords in aiVector3D).
+#define ROW(src, v, src_stride) ((const float *)((const char *)(src) + (v) * (src_stride)))
+
+static uint32_t float_bits(float f) {
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+static float bits_float(uint32_t u) {
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+// F. Giesen's float_to_half_fast3_rtne: bit arithmetic only, no lookup
+// tables, so the conversion loops stay cheap and easy for the compiler.
+uint16_t float_to_half(float value) {
+    const uint32_t f32_infinity = 255u << 23;
+    const uint32_t f16_overflow = (127u + 16u) << 23;    // Smallest float that overflows half
+    const uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+    uint32_t bits = float_bits(value);
+    uint32_t sign = bits & 0x80000000u;
+    uint16_t half;
+
+    bits ^= sign;
+    if (bits >= f16_overflow) {
+        half = bits > f32_infinity ? 0x7e00 : 0x7c00;   // NaN stays NaN, the rest becomes inf
+    } else if (bits < (113u << 23)) {
+        // Result is subnormal or zero: let the FPU do the rounding shift
+        half = (uint16_t)(float_bits(bits_float(bits) + bits_float(denorm_magic)) - denorm_magic);
+    } else {
+        uint32_t mantissa_odd = (bits >> 13) & 1;
+        bits += ((uint32_t)(15 - 127) << 23) + 0xfff;   // Rebias the exponent, round
+        bits += mantissa_odd;                            // Ties to even
+        half = (uint16_t)(bits >> 13);
+    }
+    return (uint16_t)(half | (sign >> 16));
+}
+
+void convert_to_f16(uint16_t *dst, const float *src, size_t num_rows, unsigned int ncomp, size_t src_stride) {
+    for (size_t v = 0; v < num_rows; ++v) {
+        const float *row = ROW(src, v, src_stride);
+        for (unsigned int k = 0; k < ncomp; ++k) {
+            *dst++ = float_to_half(row[k]);
+        }
+    }
+}
+
+void convert_to_snorm16(int16_t *dst, const float *src, size_t num_rows, unsigned int ncomp, size_t src_stride) {
+    for (size_t v = 0; v < num_rows; ++v) {
+        const float *row = ROW(src, v, src_stride);
+        for (unsigned int k = 0; k < ncomp; ++k) {
+            float x = row[k];
+            x = x < -1.0f ? -1.0f : (x > 1.0f ? 1.0f : x);
+            x *= 32767.0f;
+            *dst++ = (int16_t)(x + (x < 0.0f ? -0.5f : 0.5f));
+        }
+    }
+}
+
+void quantize_positions(uint16_t *dst, const float *src, size_t num_rows, size_t src_stride,
+                        float scale[3], float offset[3]) {
+    float lo[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+    float hi[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    float inv_scale[3];
+
+    for (size_t v = 0; v < num_rows; ++v) {
+        const float *row = ROW(src, v, src_stride);
+        for (int k = 0; k < 3; ++k) {
+            lo[k] = row[k] < lo[k] ? row[k] : lo[k];
+            hi[k] = row[k] > hi[k] ? row[k] : hi[k];
+        }
+    }
+
+    for (int k = 0; k < 3; ++k) {
+        float extent = num_rows ? hi[k] - lo[k] : 0.0f;
+        offset[k] = num_rows ? lo[k] : 0.0f;
+        scale[k] = extent / 65535.0f;
+        inv_scale[k] = extent > 0.0f ? 65535.0f / extent : 0.0f;   // Flat axes quantize to 0
+    }
+
+    for (size_t v = 0; v < num_rows; ++v) {
+        const float *row = ROW(src, v, src_stride);
+        for (int k = 0; k < 3; ++k) {
+            float q = (row[k] - offset[k]) * inv_scale[k] + 0.5f;
+            *dst++ = (uint16_t)(q > 65535.0f ? 65535.0f : q);
+        }
+    }
+}
+
+// Each face holds its own index allocation, so there is nothing contiguous to
+// bulk copy: the loops copy the 3 indices inline instead of calling memcpy.
+size_t flatten_triangles(void *dst, int compact, const struct aiFace *faces, size_t num_faces) {
+    size_t f = 0;
+    if (compact) {
+        uint16_t *out = (uint16_t *)dst;
+        for (; f < num_faces && faces[f].mNumIndices == 3; ++f, out += 3) {
+            const unsigned int *in = faces[f].mIndices;
+            out[0] = (uint16_t)in[0];
+            out[1] = (uint16_t)in[1];
+            out[2] = (uint16_t)in[2];
+        }
+    } else {
+        uint32_t *out = (uint32_t *)dst;
+        for (; f < num_faces && faces[f].mNumIndices == 3; ++f, out += 3) {
+            const unsigned int *in = faces[f].mIndices;
+            out[0] = in[0];
+            out[1] = in[1];
+            out[2] = in[2];
+        }
+    }
+    return f;
+}
+
+void flatten_polygons(void *dst, int compact, uint32_t *offsets, const struct aiFace *faces, size_t num_faces) {
+    uint32_t count = 0;
+    for (size_t f = 0; f < num_faces; ++f) {
+        const unsigned int *in = faces[f].mIndices;
+        unsigned int n = faces[f].mNumIndices;
+        offsets[f] = count;
+        if (compact) {
+            uint16_t *out = (uint16_t *)dst + count;
+            for (unsigned int k = 0; k < n; ++k) out[k] = (uint16_t)in[k];
+        } else {
+            memcpy((uint32_t *)dst + count, in, n * sizeof(uint32_t));
+        }
+        count += n;
+    }
+    offsets[num_faces] = count;
+}
+
+// Weights naming a vertex outside the mesh are skipped, a malformed file must
+// not write out of bounds.
+unsigned int max_bone_influences(const struct aiMesh *mesh, unsigned int *counts) {
+    unsigned int width = 0;
+    memset(counts, 0, mesh->mNumVertices * sizeof(unsigned int));
+    for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+        const struct aiBone *bone = mesh->mBones[b];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            unsigned int v = bone->mWeights[w].mVertexId;
+            if (v < mesh->mNumVertices && ++counts[v] > width) {
+                width = counts[v];
+            }
+        }
+    }
+    return width;
+}
+
+void pack_bone_weights(const struct aiMesh *mesh, unsigned int width, void *joints, int compact,
+                       float *weights, unsigned int *counts) {
+    size_t num_slots = (size_t)mesh->mNumVertices * width;
+    memset(joints, 0, num_slots * (compact ? sizeof(uint16_t) : sizeof(uint32_t)));
+    memset(weights, 0, num_slots * sizeof(float));
+    memset(counts, 0, mesh->mNumVertices * sizeof(unsigned int));
+
+    for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+        const struct aiBone *bone = mesh->mBones[b];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            unsigned int v = bone->mWeights[w].mVertexId;
+            if (v >= mesh->mNumVertices) continue;
+            size_t slot = (size_t)v * width + counts[v]++;
+            if (compact) {
+                ((uint16_t *)joints)[slot] = (uint16_t)b;
+            } else {
+                ((uint32_t *)joints)[slot] = b;
+            }
+            weights[slot] = bone->mWeights[w].mWeight;
+        }
+    }
+}
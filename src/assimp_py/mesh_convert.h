@@ -0,0 +1,55 @@
+#ifndef ASSIMP_PY_MESH_CONVERT_H
+#define ASSIMP_PY_MESH_CONVERT_H
+
+// Conversion kernels for compact mesh attribute output. They read rows of
+// `ncomp` floats `src_stride` bytes apart (the aiMesh layout) and write packed
+// rows. None of these functions touch Python, call them with the GIL released.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assimp/mesh.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// IEEE 754 half from a float, rounding to nearest even
+uint16_t float_to_half(float value);
+
+// float32 -> float16 ('e')
+void convert_to_f16(uint16_t *dst, const float *src, size_t num_rows, unsigned int ncomp, size_t src_stride);
+
+// float32 -> snorm16 ('h'): round(clamp(x, -1, 1) * 32767)
+void convert_to_snorm16(int16_t *dst, const float *src, size_t num_rows, unsigned int ncomp, size_t src_stride);
+
+// float32 x 3 -> unorm16 x 3 ('H') over the bounding box of the rows, so
+// that x ~= q * scale + offset per axis. Writes the scale and offset.
+void quantize_positions(uint16_t *dst, const float *src, size_t num_rows, size_t src_stride,
+                        float scale[3], float offset[3]);
+
+// Copies the indices of triangle faces into `dst` (room for num_faces * 3
+// indices, uint16 if `compact` else uint32), validating and copying in one
+// pass. Stops at the first face that is not a triangle and returns the number
+// of faces copied, i.e. num_faces if they are all triangles.
+size_t flatten_triangles(void *dst, int compact, const struct aiFace *faces, size_t num_faces);
+
+// Copies the indices of faces of any size into `dst` (room for the total
+// index count) and writes the CSR `offsets` (num_faces + 1 entries) of each
+// face's first index, the last one being the total.
+void flatten_polygons(void *dst, int compact, uint32_t *offsets, const struct aiFace *faces, size_t num_faces);
+
+// Largest number of bone weights on any vertex of `mesh`. `counts` is
+// scratch space for mNumVertices entries.
+unsigned int max_bone_influences(const struct aiMesh *mesh, unsigned int *counts);
+
+// Fills the (mNumVertices, width) joint index (uint16 if `compact` else
+// uint32) and weight arrays of `mesh`, one pass per bone. Unused slots get
+// joint 0 and weight 0. `counts` is scratch space for mNumVertices entries.
+void pack_bone_weights(const struct aiMesh *mesh, unsigned int width, void *joints, int compact,
+                       float *weights, unsigned int *counts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSIMP_PY_MESH_CONVERT_H
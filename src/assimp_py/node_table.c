@@ -0,0 +1,122 @@
+#include "node_table.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    const struct aiNode *node;
+    int32_t parent;
+} PendingNode;
+
+// Grows `*array` to hold at least `needed` items of `itemsize` bytes,
+// doubling its capacity. Returns -1 if out of memory, leaving it unchanged.
+static int reserve(void **array, size_t *capacity, size_t needed, size_t itemsize) {
+    if (needed <= *capacity) return 0;
+    size_t new_capacity = *capacity ? *capacity : 64;
+    while (new_capacity < needed) new_capacity *= 2;
+    void *grown = realloc(*array, new_capacity * itemsize);
+    if (!grown) return -1;
+    *array = grown;
+    *capacity = new_capacity;
+    return 0;
+}
+
+// Per node arrays all share one capacity, in nodes (+1 for the offsets)
+static int reserve_nodes(NodeTable *t, size_t *capacity, size_t needed) {
+    if (needed <= *capacity) return 0;
+    size_t c;
+    c = *capacity;
+    if (reserve((void **)&t->parent_index, &c, needed, sizeof(int32_t)) < 0) return -1;
+    c = *capacity;
+    if (reserve((void **)&t->transforms, &c, needed, 16 * sizeof(float)) < 0) return -1;
+    c = *capacity;
+    if (reserve((void **)&t->world_transforms, &c, needed, 16 * sizeof(float)) < 0) return -1;
+    c = *capacity;
+    if (reserve((void **)&t->name_offsets, &c, needed, sizeof(uint32_t)) < 0) return -1;
+    c = *capacity;
+    if (reserve((void **)&t->mesh_offsets, &c, needed, sizeof(uint32_t)) < 0) return -1;
+    *capacity = c;
+    return 0;
+}
+
+// out = a * b for row-major 4x4 matrices
+static void multiply4x4(const float *a, const float *b, float *out) {
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            out[4 * r + c] = a[4 * r] * b[c] + a[4 * r + 1] * b[4 + c] + a[4 * r + 2] * b[8 + c] + a[4 * r + 3] * b[12 + c];
+        }
+    }
+}
+
+int build_node_table(const struct aiNode *root, NodeTable *t) {
+    PendingNode *stack = NULL;
+    size_t stack_capacity = 0, stack_size = 0;
+    size_t node_capacity = 0, names_capacity = 0, meshes_capacity = 0;
+    size_t names_len = 0, meshes_len = 0, n = 0;
+
+    memset(t, 0, sizeof(*t));
+    if (reserve((void **)&stack, &stack_capacity, 1, sizeof(PendingNode)) < 0) goto fail;
+    if (root) stack[stack_size++] = (PendingNode){root, -1};
+
+    while (stack_size) {
+        PendingNode pending = stack[--stack_size];
+        const struct aiNode *node = pending.node;
+        if (reserve_nodes(t, &node_capacity, n + 2) < 0) goto fail;
+
+        t->parent_index[n] = pending.parent;
+        const ai_real *m = &node->mTransformation.a1;
+        float *local = t->transforms + 16 * n;
+        for (int k = 0; k < 16; ++k) local[k] = (float)m[k];
+        if (pending.parent < 0) {
+            memcpy(t->world_transforms + 16 * n, local, 16 * sizeof(float));
+        } else {
+            multiply4x4(t->world_transforms + 16 * (size_t)pending.parent, local, t->world_transforms + 16 * n);
+        }
+
+        size_t name_len = node->mName.length;
+        if (reserve((void **)&t->names, &names_capacity, names_len + name_len, 1) < 0) goto fail;
+        if (name_len) memcpy(t->names + names_len, node->mName.data, name_len);
+        t->name_offsets[n] = (uint32_t)names_len;
+        names_len += name_len;
+
+        unsigned int num_meshes = node->mMeshes ? node->mNumMeshes : 0;
+        if (reserve((void **)&t->mesh_indices, &meshes_capacity, meshes_len + num_meshes, sizeof(uint32_t)) < 0) goto fail;
+        if (num_meshes) memcpy(t->mesh_indices + meshes_len, node->mMeshes, num_meshes * sizeof(uint32_t));
+        t->mesh_offsets[n] = (uint32_t)meshes_len;
+        meshes_len += num_meshes;
+
+        // Children pushed last to first, so they are visited in order
+        unsigned int num_children = node->mChildren ? node->mNumChildren : 0;
+        if (reserve((void **)&stack, &stack_capacity, stack_size + num_children, sizeof(PendingNode)) < 0) goto fail;
+        for (unsigned int c = num_children; c-- > 0;) {
+            if (node->mChildren[c]) stack[stack_size++] = (PendingNode){node->mChildren[c], (int32_t)n};
+        }
+        ++n;
+    }
+
+    // Empty hierarchies still get their one offset
+    if (reserve_nodes(t, &node_capacity, n + 1) < 0) goto fail;
+    if (reserve((void **)&t->names, &names_capacity, 1, 1) < 0) goto fail;
+    if (reserve((void **)&t->mesh_indices, &meshes_capacity, 1, sizeof(uint32_t)) < 0) goto fail;
+    t->name_offsets[n] = (uint32_t)names_len;
+    t->mesh_offsets[n] = (uint32_t)meshes_len;
+    t->num_nodes = n;
+    free(stack);
+    return 0;
+
+fail:
+    free(stack);
+    free_node_table(t);
+    return -1;
+}
+
+void free_node_table(NodeTable *t) {
+    free(t->parent_index);
+    free(t->transforms);
+    free(t->world_transforms);
+    free(t->name_offsets);
+    free(t->names);
+    free(t->mesh_offsets);
+    free(t->mesh_indices);
+    memset(t, 0, sizeof(*t));
+}
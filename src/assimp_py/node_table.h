@@ -0,0 +1,40 @@
+#ifndef ASSIMP_PY_NODE_TABLE_H
+#define ASSIMP_PY_NODE_TABLE_H
+
+// Flat, array based form of an aiNode hierarchy. Nodes are stored in depth
+// first pre-order, so every parent comes before its children and each subtree
+// is contiguous. None of these functions touch Python, call them with the GIL
+// released.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assimp/scene.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    size_t num_nodes;
+    int32_t *parent_index;      // num_nodes, -1 for the root
+    float *transforms;          // num_nodes x 4 x 4, row-major aiMatrix4x4 relative to the parent
+    float *world_transforms;    // num_nodes x 4 x 4, parent world transform * transform
+    uint32_t *name_offsets;     // num_nodes + 1 offsets into names
+    char *names;                // UTF-8 names back to back, name_offsets[num_nodes] bytes
+    uint32_t *mesh_offsets;     // num_nodes + 1 offsets into mesh_indices (CSR)
+    uint32_t *mesh_indices;     // aiNode::mMeshes of all nodes back to back
+} NodeTable;
+
+// Flattens the hierarchy under `root` in a single iterative traversal, so
+// deep hierarchies cannot overflow the stack. The arrays are malloc'd.
+// Returns 0, or -1 if out of memory (nothing is left allocated).
+int build_node_table(const struct aiNode *root, NodeTable *table);
+
+// Frees the arrays still set in `table`
+void free_node_table(NodeTable *table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSIMP_PY_NODE_TABLE_H
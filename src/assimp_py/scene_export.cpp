@@ -0,0 +1,35 @@
+#include "scene_export.h"
+
+#include <assimp/Exporter.hpp>
+
+#include "import_progress.h"
+
+extern "C" int export_file(const aiScene *scene, const char *format_id, unsigned int flags, const char *path,
+                           char *error, size_t error_size) {
+    try {
+        Assimp::Exporter exporter;
+        if (exporter.Export(scene, format_id, path, flags) != AI_SUCCESS) {
+            copy_error(exporter.GetErrorString(), error, error_size);
+            return -1;
+        }
+    } catch (const std::exception &e) {
+        copy_error(e.what(), error, error_size);
+        return -1;
+    }
+    return 0;
+}
+
+extern "C" const aiExportDataBlob *export_blob(const aiScene *scene, const char *format_id, unsigned int flags,
+                                               char *error, size_t error_size) {
+    try {
+        Assimp::Exporter exporter;
+        if (!exporter.ExportToBlob(scene, format_id, flags)) {
+            copy_error(exporter.GetErrorString(), error, error_size);
+            return nullptr;
+        }
+        return exporter.GetOrphanedBlob(); // Freed by aiReleaseExportBlob
+    } catch (const std::exception &e) {
+        copy_error(e.what(), error, error_size);
+        return nullptr;
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef ASSIMP_PY_SCENE_EXPORT_H
+#define ASSIMP_PY_SCENE_EXPORT_H
+
+// C interface to Assimp::Exporter. The scene is only read: the exporter
+// works on its own copy. None of these functions touch Python, call them
+// with the GIL released.
+
+#include <stddef.h>
+#include <assimp/cexport.h>
+#include <assimp/scene.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Export `scene` in the format `format_id` (aiExportFormatDesc::id) to the
+// file at `path`. Formats writing auxiliary files (.mtl, .bin, ...) put them
+// next to it. `flags` are post-processing steps applied to the copy before
+// exporting. Returns 0, or -1 and fills `error`.
+int export_file(const struct aiScene *scene, const char *format_id, unsigned int flags, const char *path,
+                char *error, size_t error_size);
+
+// Export `scene` to memory, as aiExportSceneToBlob. Returns the chain of
+// blobs (primary file first) to be freed with aiReleaseExportBlob, or NULL
+// and fills `error`.
+const struct aiExportDataBlob *export_blob(const struct aiScene *scene, const char *format_id, unsigned int flags,
+                                           char *error, size_t error_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSIMP_PY_SCENE_EXPORT_H
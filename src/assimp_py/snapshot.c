@@ -0,0 +1,300 @@
+#include "snapshot.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common/assbin_chunks.h"
+
+#if SNAPSHOT_CHUNK_SCENE != ASSBIN_CHUNK_AISCENE || SNAPSHOT_CHUNK_MESH != ASSBIN_CHUNK_AIMESH || \
+    SNAPSHOT_CHUNK_BONE != ASSBIN_CHUNK_AIBONE || SNAPSHOT_CHUNK_NODE != ASSBIN_CHUNK_AINODE
+#error "Snapshot chunk ids must match the Assbin ones"
+#endif
+
+static void set_error(char *error, size_t error_size, const char *message, const char *detail) {
+    if (error_size > 0) {
+        snprintf(error, error_size, detail ? "%s: %s" : "%s", message, detail);
+    }
+}
+
+#ifdef _WIN32
+// UTF-8 `path` as a wide string for the W functions, NULL on failure; free() it
+static wchar_t *widen(const char *path) {
+    int length = MultiByteToWideChar(CP_UTF8, 0, path, -1, NULL, 0);
+    wchar_t *wpath = length > 0 ? (wchar_t *)malloc((size_t)length * sizeof(wchar_t)) : NULL;
+    if (wpath && !MultiByteToWideChar(CP_UTF8, 0, path, -1, wpath, length)) {
+        free(wpath);
+        wpath = NULL;
+    }
+    return wpath;
+}
+#endif
+
+// Create a new file "<path>.<random>.tmp" for writing, its name in `tmp`
+// (of `tmp_size` bytes). Returns NULL with errno set on failure.
+static FILE *open_temp(const char *path, char *tmp, size_t tmp_size) {
+    static unsigned int counter; // Races only cost a retry
+#ifdef _WIN32
+    unsigned int seed = (unsigned int)GetCurrentProcessId();
+#else
+    unsigned int seed = (unsigned int)getpid();
+#endif
+    seed ^= (unsigned int)time(NULL) * 2654435761u;
+    for (int attempt = 0; attempt < 100; ++attempt) {
+        unsigned int tag = seed ^ (++counter * 2246822519u) ^ ((unsigned int)clock() << 16);
+        snprintf(tmp, tmp_size, "%s.%08x.tmp", path, tag);
+        // "x" fails if the file exists, so no other writer shares it
+#ifdef _WIN32
+        wchar_t *wtmp = widen(tmp);
+        FILE *f = wtmp ? _wfopen(wtmp, L"wbx") : NULL;
+        free(wtmp);
+#else
+        FILE *f = fopen(tmp, "wbx");
+#endif
+        if (f || errno != EEXIST) return f;
+    }
+    return NULL;
+}
+
+static void remove_file(const char *path) {
+#ifdef _WIN32
+    wchar_t *wpath = widen(path);
+    if (wpath) DeleteFileW(wpath);
+    free(wpath);
+#else
+    remove(path);
+#endif
+}
+
+// Atomically replace `path` by `tmp`. Returns 0, or -1 with errno set.
+static int replace_file(const char *tmp, const char *path) {
+#ifdef _WIN32
+    wchar_t *wtmp = widen(tmp), *wpath = widen(path);
+    int ok = wtmp && wpath && MoveFileExW(wtmp, wpath, MOVEFILE_REPLACE_EXISTING);
+    free(wtmp);
+    free(wpath);
+    if (!ok) errno = EACCES;
+    return ok ? 0 : -1;
+#else
+    return rename(tmp, path);
+#endif
+}
+
+static uint64_t align_up(uint64_t offset) {
+    return (offset + SNAPSHOT_ALIGN - 1) / SNAPSHOT_ALIGN * SNAPSHOT_ALIGN;
+}
+
+const char *snapshot_format(const char *format, size_t *itemsize) {
+    static const struct {
+        const char *format;
+        size_t itemsize;
+    } formats[] = {
+        {"B", 1}, {"b", 1}, {"H", 2}, {"h", 2}, {"e", 2}, {"I", 4}, {"i", 4}, {"f", 4}, {"d", 8},
+    };
+    for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); ++i) {
+        if (strcmp(format, formats[i].format) == 0) {
+            *itemsize = formats[i].itemsize;
+            return formats[i].format;
+        }
+    }
+    return NULL;
+}
+
+int write_snapshot(const char *path, SnapshotChunk *chunks, const void *const *data, uint32_t num_chunks,
+                   char *error, size_t error_size) {
+    static const uint8_t padding[SNAPSHOT_ALIGN] = {0};
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.num_chunks = num_chunks;
+    header.chunks_offset = sizeof(SnapshotHeader);
+
+    uint64_t offset = header.chunks_offset + (uint64_t)num_chunks * sizeof(SnapshotChunk);
+    for (uint32_t i = 0; i < num_chunks; ++i) {
+        offset = align_up(offset);
+        chunks[i].offset = offset;
+        offset += chunks[i].size;
+    }
+    header.file_size = offset;
+
+    // Written next to `path` and renamed over it, so that mappings of the
+    // old file (load_snapshot views, here or in other processes) keep their
+    // data and readers never see a partial snapshot
+    size_t tmp_size = strlen(path) + 16;
+    char *tmp = (char *)malloc(tmp_size);
+    if (!tmp) {
+        set_error(error, error_size, "Out of memory", NULL);
+        return -1;
+    }
+    FILE *f = open_temp(path, tmp, tmp_size);
+    if (!f) {
+        set_error(error, error_size, "Cannot open the file for writing", strerror(errno));
+        free(tmp);
+        return -1;
+    }
+    int ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+             (num_chunks == 0 || fwrite(chunks, sizeof(SnapshotChunk), num_chunks, f) == num_chunks);
+    uint64_t written = header.chunks_offset + (uint64_t)num_chunks * sizeof(SnapshotChunk);
+    for (uint32_t i = 0; ok && i < num_chunks; ++i) {
+        size_t pad = (size_t)(chunks[i].offset - written);
+        ok = (pad == 0 || fwrite(padding, 1, pad, f) == pad) &&
+             (chunks[i].size == 0 || fwrite(data[i], 1, (size_t)chunks[i].size, f) == chunks[i].size);
+        written = chunks[i].offset + chunks[i].size;
+    }
+    if (fclose(f) != 0) ok = 0;
+    if (!ok || replace_file(tmp, path) != 0) {
+        set_error(error, error_size, "Cannot write the snapshot", strerror(errno));
+        remove_file(tmp);
+        free(tmp);
+        return -1;
+    }
+    free(tmp);
+    return 0;
+}
+
+// Checks the header and every chunk lie within the file, with consistent
+// sizes, so readers can trust them
+static int check_snapshot(const MappedFile *file, char *error, size_t error_size) {
+    const SnapshotHeader *header = (const SnapshotHeader *)file->data;
+    if (file->size < sizeof(SnapshotHeader) || memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0) {
+        set_error(error, error_size, "Not a snapshot file", NULL);
+        return -2;
+    }
+    if (header->version != SNAPSHOT_VERSION) {
+        set_error(error, error_size, "Unsupported snapshot version", NULL);
+        return -2;
+    }
+    if (header->file_size != file->size || header->chunks_offset % sizeof(uint64_t) != 0 ||
+        header->chunks_offset > file->size ||
+        header->num_chunks > (file->size - header->chunks_offset) / sizeof(SnapshotChunk) ||
+        header->num_chunks == 0) {
+        set_error(error, error_size, "Truncated or corrupt snapshot", NULL);
+        return -2;
+    }
+
+    uint32_t num_chunks;
+    const SnapshotChunk *chunks = snapshot_chunks(file, &num_chunks);
+    for (uint32_t i = 0; i < num_chunks; ++i) {
+        const SnapshotChunk *chunk = &chunks[i];
+        size_t itemsize = 0;
+        uint64_t items = 1;
+        int ok = memchr(chunk->format, '\0', sizeof(chunk->format)) && snapshot_format(chunk->format, &itemsize) &&
+                 chunk->ndim >= 1 && chunk->ndim <= SNAPSHOT_MAX_NDIM && chunk->offset % SNAPSHOT_ALIGN == 0 && chunk->offset <= file->size &&
+                 chunk->size <= file->size - chunk->offset;
+        for (uint32_t d = 0; ok && d < chunk->ndim; ++d) {
+            ok = chunk->shape[d] == 0 || items <= UINT64_MAX / chunk->shape[d];
+            items *= chunk->shape[d];
+        }
+        if (!ok || items > UINT64_MAX / itemsize || items * itemsize != chunk->size) {
+            set_error(error, error_size, "Truncated or corrupt snapshot", NULL);
+            return -2;
+        }
+    }
+    return 0;
+}
+
+const SnapshotChunk *snapshot_chunks(const MappedFile *file, uint32_t *num_chunks) {
+    const SnapshotHeader *header = (const SnapshotHeader *)file->data;
+    *num_chunks = header->num_chunks;
+    return (const SnapshotChunk *)(file->data + header->chunks_offset);
+}
+
+#ifdef _WIN32
+
+int map_snapshot(const char *path, MappedFile *file, char *error, size_t error_size) {
+    memset(file, 0, sizeof(*file));
+    wchar_t wpath[MAX_PATH * 4];
+    if (!MultiByteToWideChar(CP_UTF8, 0, path, -1, wpath, (int)(sizeof(wpath) / sizeof(wpath[0])))) {
+        set_error(error, error_size, "Invalid path", NULL);
+        return -1;
+    }
+    HANDLE handle = CreateFileW(wpath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) {
+        set_error(error, error_size, "Cannot open the file", NULL);
+        return -1;
+    }
+    LARGE_INTEGER size;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(handle, &size) && size.QuadPart >= (LONGLONG)sizeof(SnapshotHeader)) {
+        mapping = CreateFileMappingW(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    }
+    CloseHandle(handle);
+    if (!mapping) {
+        set_error(error, error_size, "Not a snapshot file", NULL);
+        return -2;
+    }
+    file->data = (const uint8_t *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping); // The view keeps the mapping alive
+    if (!file->data) {
+        set_error(error, error_size, "Cannot map the file", NULL);
+        return -1;
+    }
+    file->size = (size_t)size.QuadPart;
+    int status = check_snapshot(file, error, error_size);
+    if (status < 0) {
+        unmap_file(file);
+        return status;
+    }
+    return 0;
+}
+
+void unmap_file(MappedFile *file) {
+    if (file->data) UnmapViewOfFile(file->data);
+    memset(file, 0, sizeof(*file));
+}
+
+#else
+
+int map_snapshot(const char *path, MappedFile *file, char *error, size_t error_size) {
+    memset(file, 0, sizeof(*file));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        set_error(error, error_size, "Cannot open the file", strerror(errno));
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        set_error(error, error_size, "Cannot read the file", strerror(errno));
+        return -1;
+    }
+    if (st.st_size < (off_t)sizeof(SnapshotHeader)) {
+        close(fd);
+        set_error(error, error_size, "Not a snapshot file", NULL);
+        return -2;
+    }
+    // Private read-only pages: the file is paged in as the views are read
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file open
+    if (data == MAP_FAILED) {
+        set_error(error, error_size, "Cannot map the file", strerror(errno));
+        return -1;
+    }
+    file->data = (const uint8_t *)data;
+    file->size = (size_t)st.st_size;
+    int status = check_snapshot(file, error, error_size);
+    if (status < 0) {
+        unmap_file(file);
+        return status;
+    }
+    return 0;
+}
+
+void unmap_file(MappedFile *file) {
+    if (file->data) munmap((void *)file->data, file->size);
+    memset(file, 0, sizeof(*file));
+}
+
+#endif
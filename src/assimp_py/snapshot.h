@@ -0,0 +1,85 @@
+#ifndef ASSIMP_PY_SNAPSHOT_H
+#define ASSIMP_PY_SNAPSHOT_H
+
+// Snapshot files: the arrays of a converted Scene, laid out exactly as the
+// binding exposes them, so that loading maps the file and hands out views of
+// it. Like Assbin (code/Common/assbin_chunks.h) a snapshot is a sequence of
+// chunks, but a table of offsets at the start locates them instead of
+// reading them in sequence:
+//
+//   SnapshotHeader                          at 0
+//   SnapshotChunk[num_chunks]               at chunks_offset
+//   chunk data, each SNAPSHOT_ALIGN aligned at SnapshotChunk::offset
+//
+// Chunk 0 is the scene description (ASSBIN_CHUNK_AISCENE), which refers to
+// the other chunks by index. All fields are in native byte order.
+// None of these functions touch Python, call them with the GIL released.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SNAPSHOT_MAGIC "ASPYSNAP"
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_ALIGN 64
+#define SNAPSHOT_MAX_NDIM 3
+
+// Chunk ids, those of the matching Assbin chunks
+#define SNAPSHOT_CHUNK_SCENE 0x1239 // ASSBIN_CHUNK_AISCENE: the scene description
+#define SNAPSHOT_CHUNK_MESH 0x1237  // ASSBIN_CHUNK_AIMESH: vertex attributes and indices
+#define SNAPSHOT_CHUNK_BONE 0x123a  // ASSBIN_CHUNK_AIBONE: bone matrices and vertex weights
+#define SNAPSHOT_CHUNK_NODE 0x123c  // ASSBIN_CHUNK_AINODE: node table columns
+
+typedef struct {
+    char magic[8];          // SNAPSHOT_MAGIC, without the terminating NUL
+    uint32_t version;       // SNAPSHOT_VERSION
+    uint32_t num_chunks;
+    uint64_t chunks_offset;
+    uint64_t file_size;     // Catches truncated files
+    uint8_t reserved[32];
+} SnapshotHeader;
+
+typedef struct {
+    uint32_t id;            // SNAPSHOT_CHUNK_*
+    uint32_t ndim;          // 1 to SNAPSHOT_MAX_NDIM
+    uint64_t offset;        // From the start of the file, SNAPSHOT_ALIGN aligned
+    uint64_t size;          // Bytes, product(shape) * itemsize
+    uint64_t shape[SNAPSHOT_MAX_NDIM];
+    char format[8];         // struct format of the items, e.g. "f", NUL terminated
+    uint8_t reserved[8];
+} SnapshotChunk;
+
+// The static copy of the struct `format` and its item size, or NULL for
+// formats snapshots do not hold
+const char *snapshot_format(const char *format, size_t *itemsize);
+
+// Write a snapshot of `num_chunks` chunks to `path`. The offsets of `chunks`
+// are filled in, `data[i]` holds the `chunks[i].size` contiguous bytes of
+// chunk i. Returns 0, or -1 and fills `error`.
+int write_snapshot(const char *path, SnapshotChunk *chunks, const void *const *data, uint32_t num_chunks,
+                   char *error, size_t error_size);
+
+// Read-only mapping of a whole file
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+} MappedFile;
+
+// Map the snapshot at `path` and check its header and chunk table, so the
+// chunks can be used without further bounds checks. Returns 0, or fills
+// `error` and returns -1 if the file cannot be read, -2 if it is not a valid
+// snapshot.
+int map_snapshot(const char *path, MappedFile *file, char *error, size_t error_size);
+void unmap_file(MappedFile *file);
+
+// The chunk table of a mapped snapshot
+const SnapshotChunk *snapshot_chunks(const MappedFile *file, uint32_t *num_chunks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASSIMP_PY_SNAPSHOT_H
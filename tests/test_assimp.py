@@ -1,4 +1,10 @@
+import base64
+import collections.abc
+import json
 import math
+import os
+import struct
+import threading
 import pytest
 
 # Attempt import, skip if NumPy is not available for memoryview checks
@@ -168,6 +174,61 @@ class TestImportFile:
             assimp_py.import_file("dummy.obj", DEFAULT_FLAGS, "extra_arg") # Too many args
 
 
+class TestImportBytes:
+    def test_load_bytes_with_resolver(self, valid_obj_file, loaded_scene):
+        """Importing the same bytes from memory matches importing the file."""
+        folder = valid_obj_file.parent
+        requested = []
+
+        def resolver(name):
+            requested.append(name)
+            path = folder / name
+            return path.read_bytes() if path.is_file() else None
+
+        data = valid_obj_file.read_bytes()
+        scene = assimp_py.import_bytes(data, DEFAULT_FLAGS, "obj", resolver=resolver)
+        assert isinstance(scene, assimp_py.Scene)
+        assert scene.num_meshes == loaded_scene.num_meshes
+        assert scene.num_materials == loaded_scene.num_materials
+        assert scene.meshes[0].vertices.tolist() == loaded_scene.meshes[0].vertices.tolist()
+        assert any(name.endswith("cube.mtl") for name in requested)
+
+    def test_buffer_protocol_inputs(self, valid_obj_file):
+        """Any contiguous buffer-protocol object is accepted."""
+        data = valid_obj_file.read_bytes()
+        for buf in (bytearray(data), memoryview(data), memoryview(data)[0:]):
+            scene = assimp_py.import_bytes(buf, DEFAULT_FLAGS, hint="obj")
+            assert scene.num_meshes == 1
+
+    def test_no_resolver_skips_secondary_files(self, valid_obj_file):
+        """Without a resolver the .mtl is not found, so its textures are missing."""
+        scene = assimp_py.import_bytes(valid_obj_file.read_bytes(), DEFAULT_FLAGS, "obj")
+        for mat in scene.materials:
+            assert assimp_py.TextureType_DIFFUSE not in mat["TEXTURES"]
+
+    def test_resolver_errors_propagate(self, valid_obj_file):
+        """Exceptions raised by the resolver are re-raised by import_bytes."""
+        def resolver(name):
+            raise KeyError(name)
+
+        with pytest.raises(KeyError) as excinfo:
+            assimp_py.import_bytes(valid_obj_file.read_bytes(), DEFAULT_FLAGS, "obj", resolver=resolver)
+        # The traceback still reaches into the resolver
+        assert excinfo.traceback[-1].name == "resolver"
+
+    def test_invalid_data(self):
+        """Garbage raises RuntimeError, empty data and wrong types are rejected."""
+        with pytest.raises(RuntimeError) as excinfo:
+            assimp_py.import_bytes(b"This is not a valid 3D model.", DEFAULT_FLAGS, "obj2")
+        assert "Assimp error" in str(excinfo.value)
+        with pytest.raises(ValueError):
+            assimp_py.import_bytes(b"", DEFAULT_FLAGS)
+        with pytest.raises(TypeError):
+            assimp_py.import_bytes("not bytes", DEFAULT_FLAGS)
+        with pytest.raises(TypeError):
+            assimp_py.import_bytes(b"v 0 0 0", DEFAULT_FLAGS, resolver=42)
+
+
 class TestSceneObject:
     def test_scene_attributes(self, loaded_scene):
         """Test Scene object attributes existence and basic types."""
@@ -380,9 +441,9 @@ class TestMeshObject:
         """Test Mesh vertices memoryview."""
         assert hasattr(mesh, "vertices")
         if mesh.num_vertices > 0:
-            self._check_memoryview(mesh.vertices, 'f', 4) # 'f' = float
-            arr = self._check_numpy_array(mesh.vertices, np.float32, mesh.num_vertices * 3)
-            assert arr.shape == (mesh.num_vertices * 3,) # Flat array
+            self._check_memoryview(mesh.vertices, 'f', 4, expected_ndim=2) # 'f' = float
+            arr = self._check_numpy_array(mesh.vertices, np.float32, mesh.num_vertices)
+            assert arr.shape == (mesh.num_vertices, 3) # (N, 3), no reshape needed
             # Reshape for easier checking
             vertices_reshaped = arr.reshape((mesh.num_vertices, 3))
             assert vertices_reshaped.shape == (mesh.num_vertices, 3)
@@ -402,9 +463,9 @@ class TestMeshObject:
         assert hasattr(mesh, "normals")
         assert mesh.normals is not None, "Normals should exist due to Process_GenSmoothNormals flag"
         if mesh.num_vertices > 0:
-            self._check_memoryview(mesh.normals, 'f', 4)
-            arr = self._check_numpy_array(mesh.normals, np.float32, mesh.num_vertices * 3)
-            assert arr.shape == (mesh.num_vertices * 3,)
+            self._check_memoryview(mesh.normals, 'f', 4, expected_ndim=2)
+            arr = self._check_numpy_array(mesh.normals, np.float32, mesh.num_vertices)
+            assert arr.shape == (mesh.num_vertices, 3)
             normals_reshaped = arr.reshape((mesh.num_vertices, 3))
             assert normals_reshaped.shape == (mesh.num_vertices, 3)
             # Check normals point roughly in +Z
@@ -421,15 +482,15 @@ class TestMeshObject:
         assert mesh.bitangents is not None, "Bitangents should exist due to Process_CalcTangentSpace flag"
 
         if mesh.num_vertices > 0:
-            self._check_memoryview(mesh.tangents, 'f', 4)
-            arr_t = self._check_numpy_array(mesh.tangents, np.float32, mesh.num_vertices * 3)
-            assert arr_t.shape == (mesh.num_vertices * 3,)
+            self._check_memoryview(mesh.tangents, 'f', 4, expected_ndim=2)
+            arr_t = self._check_numpy_array(mesh.tangents, np.float32, mesh.num_vertices)
+            assert arr_t.shape == (mesh.num_vertices, 3)
             tangents_reshaped = arr_t.reshape((mesh.num_vertices, 3))
             assert tangents_reshaped.shape == (mesh.num_vertices, 3)
 
-            self._check_memoryview(mesh.bitangents, 'f', 4)
-            arr_b = self._check_numpy_array(mesh.bitangents, np.float32, mesh.num_vertices * 3)
-            assert arr_b.shape == (mesh.num_vertices * 3,)
+            self._check_memoryview(mesh.bitangents, 'f', 4, expected_ndim=2)
+            arr_b = self._check_numpy_array(mesh.bitangents, np.float32, mesh.num_vertices)
+            assert arr_b.shape == (mesh.num_vertices, 3)
             bitangents_reshaped = arr_b.reshape((mesh.num_vertices, 3))
             assert bitangents_reshaped.shape == (mesh.num_vertices, 3)
 
@@ -461,9 +522,9 @@ class TestMeshObject:
         if mesh.num_vertices > 0:
             uv_set = mesh.texcoords[0]
             num_components = mesh.num_uv_components[0]
-            self._check_memoryview(uv_set, 'f', 4)
-            arr = self._check_numpy_array(uv_set, np.float32, mesh.num_vertices * num_components)
-            assert arr.shape == (mesh.num_vertices * num_components,)
+            self._check_memoryview(uv_set, 'f', 4, expected_ndim=2)
+            arr = self._check_numpy_array(uv_set, np.float32, mesh.num_vertices)
+            assert arr.shape == (mesh.num_vertices, num_components)
             uv_reshaped = arr.reshape((mesh.num_vertices, num_components))
             assert uv_reshaped.shape == (mesh.num_vertices, num_components)
 
@@ -485,6 +546,1164 @@ class TestMeshObject:
         assert mesh.colors is None or mesh.colors == [], "Expected no vertex color sets for this file"
 
 
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestZeroCopy:
+    @pytest.fixture(scope="class")
+    def zc_scene(self, valid_obj_file):
+        """Loads the valid OBJ file keeping the Assimp scene alive."""
+        return assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, zero_copy=True)
+
+    def test_zero_copy_is_keyword_only(self, valid_obj_file):
+        """zero_copy can only be passed as a keyword."""
+        with pytest.raises(TypeError):
+            assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, True)
+
+    def test_zero_copy_matches_copy(self, loaded_scene, zc_scene):
+        """Borrowed buffers hold the same data as the copied ones."""
+        assert zc_scene.num_meshes == loaded_scene.num_meshes
+        for a, b in zip(loaded_scene.meshes, zc_scene.meshes):
+            for attr in ("indices", "vertices", "normals", "tangents", "bitangents"):
+                np.testing.assert_array_equal(np.asarray(getattr(a, attr)), np.asarray(getattr(b, attr)))
+            for ta, tb in zip(a.texcoords, b.texcoords):
+                np.testing.assert_array_equal(np.asarray(ta), np.asarray(tb))
+
+    def test_buffers_are_read_only(self, zc_scene):
+        """Views into the Assimp scene can't be written to."""
+        mv = zc_scene.meshes[0].vertices
+        assert mv.readonly
+        with pytest.raises(TypeError):
+            mv[0] = 1.0
+
+    def test_views_outlive_scene(self, valid_obj_file):
+        """Memoryviews keep the underlying memory alive after the Scene is gone."""
+        for zero_copy in (False, True):
+            scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, zero_copy=zero_copy)
+            vertices = scene.meshes[0].vertices
+            expected = vertices.tolist()
+            del scene
+            import gc; gc.collect()
+            assert vertices.tolist() == expected
+            assert np.frombuffer(vertices, dtype=np.float32).size == 3 * len(expected)
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestBufferProtocol:
+    def test_vertex_attribute_shapes(self, loaded_scene):
+        """Vertex attributes are 2-D with C-contiguous strides."""
+        mesh = loaded_scene.meshes[0]
+        for mv, ncomp in ((mesh.vertices, 3), (mesh.normals, 3), (mesh.texcoords[0], 2)):
+            assert mv.shape == (mesh.num_vertices, ncomp)
+            assert mv.strides == (ncomp * 4, 4)
+            assert mv.c_contiguous
+            assert mv.nbytes == mesh.num_vertices * ncomp * 4
+
+    def test_cast_and_frombuffer(self, loaded_scene):
+        """Contiguous buffers can be cast and consumed without copies."""
+        mesh = loaded_scene.meshes[0]
+        flat = mesh.vertices.cast('B').cast('f')
+        assert len(flat) == mesh.num_vertices * 3
+        arr = np.frombuffer(mesh.vertices, dtype=np.float32)
+        np.testing.assert_array_equal(arr.reshape(-1, 3), np.asarray(mesh.vertices))
+
+    def test_asarray_shares_memory(self, loaded_scene):
+        """NumPy views the buffer memory instead of copying it."""
+        mesh = loaded_scene.meshes[0]
+        a = np.asarray(mesh.vertices)
+        b = np.asarray(mesh.vertices)
+        assert np.shares_memory(a, b)
+        assert not a.flags.writeable
+
+    def test_zero_copy_texcoords_are_strided(self, valid_obj_file):
+        """Borrowed 2 component texcoords keep the aiVector3D row stride."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, zero_copy=True)
+        mesh = scene.meshes[0]
+        uv = mesh.texcoords[0]
+        assert uv.shape == (mesh.num_vertices, 2)
+        assert uv.strides == (12, 4)
+        assert not uv.c_contiguous
+        np.testing.assert_allclose(np.asarray(uv), [[0, 0], [1, 0], [1, 1], [0, 1]], atol=1e-6)
+        assert len(uv.tobytes()) == mesh.num_vertices * 2 * 4
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestInterleaved:
+    def test_default_layout(self, loaded_scene):
+        """P3N3T2 packs positions, normals and uvs per vertex."""
+        mesh = loaded_scene.meshes[0]
+        buf, stride, offsets = mesh.interleaved()
+        assert stride == 8 * 4
+        assert offsets == {"P": 0, "N": 12, "T": 24}
+        assert buf.shape == (mesh.num_vertices, 8)
+        assert buf.c_contiguous
+
+        arr = np.asarray(buf)
+        np.testing.assert_array_equal(arr[:, 0:3], np.asarray(mesh.vertices))
+        np.testing.assert_array_equal(arr[:, 3:6], np.asarray(mesh.normals))
+        np.testing.assert_array_equal(arr[:, 6:8], np.asarray(mesh.texcoords[0]))
+
+    def test_custom_layout(self, loaded_scene):
+        """Attributes can be reordered and truncated."""
+        mesh = loaded_scene.meshes[0]
+        buf, stride, offsets = mesh.interleaved("T1X3P2", dtype="f32")
+        assert stride == 6 * 4
+        assert offsets == {"T": 0, "X": 4, "P": 16}
+        arr = np.asarray(buf)
+        np.testing.assert_array_equal(arr[:, 0], np.asarray(mesh.texcoords[0])[:, 0])
+        np.testing.assert_array_equal(arr[:, 1:4], np.asarray(mesh.tangents))
+        np.testing.assert_array_equal(arr[:, 4:6], np.asarray(mesh.vertices)[:, :2])
+
+    def test_strided_source(self, valid_obj_file):
+        """Strided zero-copy texcoords are packed correctly."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, zero_copy=True)
+        mesh = scene.meshes[0]
+        arr = np.asarray(mesh.interleaved("T2P3")[0])
+        np.testing.assert_array_equal(arr[:, 0:2], np.asarray(mesh.texcoords[0]))
+
+    def test_invalid_layouts(self, loaded_scene):
+        """Malformed layouts, missing attributes and unknown dtypes raise ValueError."""
+        mesh = loaded_scene.meshes[0]
+        for layout in ("", "P", "P5", "Q3", "P3P3", "T3", "C4"):
+            with pytest.raises(ValueError):
+                mesh.interleaved(layout)
+        with pytest.raises(ValueError):
+            mesh.interleaved("P3", dtype="f64")
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestCompactOutput:
+    @pytest.fixture(scope="class")
+    def compact_scene(self, valid_obj_file):
+        """Loads the valid OBJ file with every compact output option."""
+        return assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, compact_indices=True,
+                                     normals="f16", texcoords="f16", quantize_positions=True)
+
+    def test_compact_indices(self, loaded_scene, compact_scene):
+        """Small meshes get uint16 indices with the same values."""
+        mesh, ref = compact_scene.meshes[0], loaded_scene.meshes[0]
+        assert mesh.indices.format == "H"
+        np.testing.assert_array_equal(np.asarray(mesh.indices), np.asarray(ref.indices))
+
+    def test_half_attributes(self, loaded_scene, compact_scene):
+        """f16 normals, tangents and texcoords round like numpy's float16."""
+        mesh, ref = compact_scene.meshes[0], loaded_scene.meshes[0]
+        for attr in ("normals", "tangents", "bitangents"):
+            mv = getattr(mesh, attr)
+            assert mv.format == "e" and mv.shape == (mesh.num_vertices, 3)
+            np.testing.assert_array_equal(np.asarray(mv), np.asarray(getattr(ref, attr)).astype(np.float16))
+        np.testing.assert_array_equal(np.asarray(mesh.texcoords[0]), np.asarray(ref.texcoords[0]).astype(np.float16))
+
+    def test_snorm16_normals(self, valid_obj_file, loaded_scene):
+        """snorm16 normals are value * 32767 rounded to int16."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, normals="snorm16")
+        mesh, ref = scene.meshes[0], loaded_scene.meshes[0]
+        assert mesh.normals.format == "h"
+        np.testing.assert_array_equal(np.asarray(mesh.normals), np.round(np.asarray(ref.normals) * 32767).astype(np.int16))
+        assert mesh.position_scale is None and mesh.position_offset is None
+
+    def test_quantized_positions(self, loaded_scene, compact_scene):
+        """Quantized positions dequantize to within half a step of the originals."""
+        mesh, ref = compact_scene.meshes[0], loaded_scene.meshes[0]
+        assert mesh.vertices.format == "H"
+        q = np.asarray(mesh.vertices)
+        scale, offset = np.array(mesh.position_scale), np.array(mesh.position_offset)
+        original = np.asarray(ref.vertices)
+        np.testing.assert_allclose(offset, original.min(axis=0))
+        assert q.max(axis=0)[scale > 0].tolist() == [65535] * int((scale > 0).sum())
+        np.testing.assert_allclose(q * scale + offset, original, atol=float(scale.max()) * 0.5 + 1e-6)
+
+    def test_options_everywhere(self, valid_obj_file):
+        """import_bytes and import_files take the same options."""
+        data = valid_obj_file.read_bytes()
+        scene = assimp_py.import_bytes(data, DEFAULT_FLAGS, "obj", compact_indices=True, normals="snorm16")
+        assert scene.meshes[0].indices.format == "H" and scene.meshes[0].normals.format == "h"
+        (_, scene), = assimp_py.import_files([str(valid_obj_file)], DEFAULT_FLAGS, quantize_positions=True)
+        assert scene.meshes[0].vertices.format == "H"
+
+    def test_interleaved(self, loaded_scene, compact_scene):
+        """interleaved packs float16 output but needs float32 sources."""
+        ref = loaded_scene.meshes[0]
+        buf, stride, offsets = ref.interleaved("P3N3", dtype="f16")
+        assert buf.format == "e" and stride == 12 and offsets == {"P": 0, "N": 6}
+        np.testing.assert_array_equal(np.asarray(buf)[:, 0:3], np.asarray(ref.vertices).astype(np.float16))
+        with pytest.raises(ValueError):
+            compact_scene.meshes[0].interleaved("P3")
+
+    def test_invalid_options(self, valid_obj_file):
+        """Unknown formats raise ValueError."""
+        with pytest.raises(ValueError):
+            assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, normals="f64")
+        with pytest.raises(ValueError):
+            assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, texcoords="snorm16")
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestLazy:
+    def test_lazy_matches_eager(self, valid_obj_file, loaded_scene):
+        """Lazy meshes and materials hold the same data as eager ones."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, lazy=True)
+        assert len(scene.meshes) == scene.num_meshes == loaded_scene.num_meshes
+        assert len(scene.materials) == loaded_scene.num_materials
+        for a, b in zip(loaded_scene.meshes, scene.meshes):
+            assert isinstance(b, assimp_py.Mesh)
+            for attr in ("indices", "vertices", "normals", "tangents"):
+                np.testing.assert_array_equal(np.asarray(getattr(a, attr)), np.asarray(getattr(b, attr)))
+        assert list(scene.materials) == loaded_scene.materials
+        assert isinstance(scene.meshes, collections.abc.Sequence)
+        assert isinstance(scene.meshes, assimp_py.LazySequence)
+
+    def test_converted_on_first_access(self, valid_obj_file):
+        """Items are converted once, when first indexed, and then cached."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, lazy=True)
+        assert "0 converted" in repr(scene.meshes)
+        mesh = scene.meshes[-1]
+        assert scene.meshes[0] is mesh
+        assert "1 converted" in repr(scene.meshes)
+        assert scene.meshes[:] == [mesh]
+        with pytest.raises(IndexError):
+            scene.meshes[len(scene.meshes)]
+
+    def test_conversion_errors_are_deferred(self, valid_obj_file):
+        """Mesh errors are raised on access instead of by the import."""
+        scene = assimp_py.import_file(str(valid_obj_file), 0, lazy=True)
+        assert scene.num_meshes == 1 and scene.root_node is not None
+        with pytest.raises(ValueError):
+            scene.meshes[0]
+
+    def test_sequences_outlive_scene(self, valid_obj_file):
+        """The lazy sequences keep the Assimp scene alive, also with zero_copy."""
+        meshes = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, lazy=True, zero_copy=True).meshes
+        verts = np.asarray(meshes[0].vertices)
+        del meshes
+        assert verts.shape == (4, 3)
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestPolygons:
+    def test_quad_as_csr(self, valid_obj_file):
+        """Without triangulation the quad is kept as one 4 index face."""
+        scene = assimp_py.import_file(str(valid_obj_file), 0, polygons=True)
+        mesh = scene.meshes[0]
+        assert mesh.num_faces == 1 and mesh.num_indices == 4
+        assert np.asarray(mesh.face_offsets).tolist() == [0, 4]
+        assert sorted(np.asarray(mesh.indices).tolist()) == [0, 1, 2, 3]
+
+    def test_triangles_have_offsets(self, loaded_scene, valid_obj_file):
+        """Triangulated meshes get regular offsets and unchanged indices."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, polygons=True, compact_indices=True)
+        mesh = scene.meshes[0]
+        assert mesh.face_offsets.format == "I" and mesh.indices.format == "H"
+        assert np.asarray(mesh.face_offsets).tolist() == [0, 3, 6]
+        np.testing.assert_array_equal(np.asarray(mesh.indices), np.asarray(loaded_scene.meshes[0].indices))
+        assert loaded_scene.meshes[0].face_offsets is None
+
+    def test_quad_without_polygons(self, valid_obj_file):
+        """Non-triangle faces still raise ValueError by default."""
+        with pytest.raises(ValueError, match="polygons=True"):
+            assimp_py.import_file(str(valid_obj_file), 0)
+
+
+# Valve SMD with 5 bones; the first vertex is weighted to all of them
+SKINNED_SMD = b"""version 1
+nodes
+0 "root" -1
+1 "b1" 0
+2 "b2" 1
+3 "b3" 2
+4 "b4" 3
+end
+skeleton
+time 0
+0 0 0 0 0 0 0
+1 0 1 0 0 0 0
+2 0 1 0 0 0 0
+3 0 1 0 0 0 0
+4 0 1 0 0 0 0
+end
+triangles
+skin.bmp
+0 0 0 0 0 0 1 0 0 5 0 0.1 1 0.2 2 0.3 3 0.15 4 0.25
+0 1 0 0 0 0 1 1 0 1 0 1.0
+0 0 1 0 0 0 1 0 1 2 1 0.5 2 0.5
+end
+"""
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestBones:
+    def _vertex_weights(self, mesh):
+        """Sorted list of each vertex's {bone name: weight} items."""
+        joints, weights = np.asarray(mesh.joint_indices), np.asarray(mesh.joint_weights)
+        return sorted(
+            sorted((mesh.bone_names[j], round(float(w), 5)) for j, w in zip(joints[v], weights[v]) if w > 0)
+            for v in range(mesh.num_vertices)
+        )
+
+    def test_skin_arrays(self):
+        """Bones, offset matrices and per-vertex weights are packed into arrays."""
+        mesh = assimp_py.import_bytes(SKINNED_SMD, assimp_py.Process_Triangulate, "smd").meshes[0]
+        assert mesh.num_bones == 5
+        assert sorted(mesh.bone_names) == ["b1", "b2", "b3", "b4", "root"]
+        assert mesh.bone_offset_matrices.shape == (5, 4, 4)
+        assert mesh.joint_indices.format == "H" and mesh.joint_indices.shape == (3, 5)
+        assert mesh.joint_weights.format == "f" and mesh.joint_weights.shape == (3, 5)
+
+        assert self._vertex_weights(mesh) == [
+            [("b1", 0.2), ("b2", 0.3), ("b3", 0.15), ("b4", 0.25), ("root", 0.1)],
+            [("b1", 0.5), ("b2", 0.5)],
+            [("root", 1.0)],
+        ]
+
+        # b1 sits 1 unit up the y axis, its offset matrix moves it back to the origin
+        b1 = np.asarray(mesh.bone_offset_matrices)[mesh.bone_names.index("b1")]
+        np.testing.assert_allclose(b1 @ [0.0, 1.0, 0.0, 1.0], [0.0, 0.0, 0.0, 1.0], atol=1e-6)
+
+    def test_limit_bone_weights(self):
+        """Process_LimitBoneWeights caps the number of weights per vertex at 4."""
+        flags = assimp_py.Process_Triangulate | assimp_py.Process_LimitBoneWeights
+        mesh = assimp_py.import_bytes(SKINNED_SMD, flags, "smd").meshes[0]
+        assert mesh.joint_indices.shape == (3, 4)
+        np.testing.assert_allclose(np.asarray(mesh.joint_weights).sum(axis=1), 1.0, rtol=1e-6)
+
+    def test_no_bones(self, loaded_scene):
+        """Meshes without bones have empty names and None arrays."""
+        mesh = loaded_scene.meshes[0]
+        assert mesh.num_bones == 0 and mesh.bone_names == []
+        assert mesh.bone_offset_matrices is None
+        assert mesh.joint_indices is None and mesh.joint_weights is None
+
+
+# glTF triangle with a PBR material whose textures all use one image
+PBR_GLTF = b"""{
+    "asset": {"version": "2.0"},
+    "scenes": [{"nodes": [0]}],
+    "nodes": [{"mesh": 0}],
+    "meshes": [{"primitives": [{"attributes": {"POSITION": 0, "TEXCOORD_0": 1}, "indices": 2, "material": 0}]}],
+    "materials": [{"name": "pbr", "doubleSided": true, "alphaMode": "MASK", "alphaCutoff": 0.3, "pbrMetallicRoughness": {"baseColorFactor": [0.1, 0.2, 0.3, 0.4], "metallicFactor": 0.7, "roughnessFactor": 0.2, "baseColorTexture": {"index": 0}, "metallicRoughnessTexture": {"index": 0}}, "normalTexture": {"index": 0, "scale": 0.5}, "emissiveFactor": [1, 0.5, 0.25], "occlusionTexture": {"index": 0}, "emissiveTexture": {"index": 0}}],
+    "textures": [{"source": 0}],
+    "images": [{"uri": "tex.png"}],
+    "buffers": [{"byteLength": 68, "uri": "data:application/octet-stream;base64,AAAAAAAAAAAAAAAAAACAPwAAAAAAAAAAAAAAAAAAgD8AAAAAAAAAAAAAAAAAAIA/AAAAAAAAAAAAAIA/AAABAAIAAAA="}],
+    "bufferViews": [{"buffer": 0, "byteOffset": 0, "byteLength": 36}, {"buffer": 0, "byteOffset": 36, "byteLength": 24}, {"buffer": 0, "byteOffset": 60, "byteLength": 6}],
+    "accessors": [{"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3", "min": [0, 0, 0], "max": [1, 1, 0]}, {"bufferView": 1, "componentType": 5126, "count": 3, "type": "VEC2"}, {"bufferView": 2, "componentType": 5123, "count": 3, "type": "SCALAR"}]
+}"""
+
+
+class TestTypedMaterials:
+    @pytest.fixture(scope="class")
+    def typed_scene(self, valid_obj_file):
+        return assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, typed_materials=True)
+
+    @pytest.fixture(scope="class")
+    def material(self, typed_scene):
+        return next(m for m in typed_scene.materials if m.name == "TestMaterial")
+
+    def test_phong_slots(self, material):
+        """Common Phong parameters are typed attributes, missing ones are None."""
+        assert isinstance(material, assimp_py.Material)
+        assert material.diffuse == pytest.approx((0.8, 0.7, 0.6, 1.0))
+        assert material.specular == pytest.approx((0.9, 0.9, 0.9, 1.0))
+        assert material.shininess == pytest.approx(32.0)
+        assert material.opacity == pytest.approx(1.0)
+        assert material.base_color is None and material.metallic is None
+
+    def test_texture_slots(self, material):
+        """Texture slots are ordered by type and carry assimp's defaults."""
+        slots = material.textures
+        assert [(t.type, t.path) for t in slots] == [
+            (1, "texture_diffuse.png"), (2, "texture_specular.png"), (5, "bumpmap.png")]
+        assert all(t.index == 0 and t.uv_index == 0 and t.mapping == 0 for t in slots)
+        assert material.textures is slots
+
+    def test_properties_match_dicts(self, typed_scene, loaded_scene):
+        """The lazily built property dictionaries equal untyped materials."""
+        assert [m.properties for m in typed_scene.materials] == loaded_scene.materials
+
+    def test_pbr_gltf(self):
+        """glTF PBR factors, double sidedness and textures are read."""
+        scene = assimp_py.import_bytes(PBR_GLTF, 0, "gltf", typed_materials=True, lazy=True)
+        material = scene.materials[0]
+        assert material.name == "pbr"
+        assert material.base_color == pytest.approx((0.1, 0.2, 0.3, 0.4))
+        assert material.emissive == pytest.approx((1.0, 0.5, 0.25, 1.0))
+        assert material.metallic == pytest.approx(0.7)
+        assert material.roughness == pytest.approx(0.2)
+        assert material.two_sided is True
+        assert {t.type for t in material.textures} >= {12, 15, 16}
+        assert all(t.path == "tex.png" for t in material.textures)
+
+    @pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+    def test_material_table(self, typed_scene):
+        """material_table() gathers the typed slots into columns."""
+        table = typed_scene.material_table()
+        n = typed_scene.num_materials
+        row = table["name"].index("TestMaterial")
+        assert np.asarray(table["diffuse"]).shape == (n, 4)
+        assert np.asarray(table["diffuse"])[row] == pytest.approx([0.8, 0.7, 0.6, 1.0])
+        assert np.isnan(np.asarray(table["base_color"])[row]).all()
+        assert np.isnan(np.asarray(table["metallic"])[row])
+        assert np.asarray(table["shininess"])[row] == pytest.approx(32.0)
+        assert table["shading_model"].format == "i" and table["two_sided"][row] == -1
+
+    def test_material_table_needs_typed(self, loaded_scene):
+        """Dictionary materials cannot be gathered into a table."""
+        with pytest.raises(TypeError, match="typed_materials=True"):
+            loaded_scene.material_table()
+
+
+class TestEmbeddedTextures:
+    PNG = b"\x89PNG\r\n\x1a\n" + bytes(range(40))
+
+    def embedded_gltf(self):
+        """PBR_GLTF with its image embedded as a data URI."""
+        gltf = json.loads(PBR_GLTF)
+        gltf["images"] = [{"uri": "data:image/png;base64," + base64.b64encode(self.PNG).decode()}]
+        return json.dumps(gltf).encode()
+
+    @pytest.mark.parametrize("options", [{}, {"zero_copy": True}, {"lazy": True}])
+    def test_compressed_texture(self, options):
+        """Compressed images are exposed as their file bytes, without a copy."""
+        scene = assimp_py.import_bytes(self.embedded_gltf(), 0, "gltf", **options)
+        assert scene.num_textures == len(scene.textures) == 1
+        texture = scene.textures[0]
+        assert isinstance(texture, assimp_py.Texture)
+        assert (texture.width, texture.height, texture.format_hint) == (len(self.PNG), 0, "png")
+        assert texture.data.format == "B" and texture.data.readonly
+        assert bytes(texture.data) == self.PNG
+
+        data = texture.data
+        del scene, texture
+        assert bytes(data) == self.PNG
+
+    def test_resolve_material_paths(self):
+        """'*N' material paths resolve to the embedded textures."""
+        scene = assimp_py.import_bytes(self.embedded_gltf(), 0, "gltf", typed_materials=True)
+        path = scene.materials[0].textures[0].path
+        assert path == "*0"
+        assert scene.embedded_texture(path) is scene.textures[0]
+        assert scene.embedded_texture("*1") is None
+        assert scene.embedded_texture("tex.png") is None
+        with pytest.raises(TypeError):
+            scene.embedded_texture(0)
+
+    def test_no_embedded_textures(self, loaded_scene):
+        """Files referencing external images have no embedded textures."""
+        assert loaded_scene.textures == [] and loaded_scene.num_textures == 0
+
+
+# BVH with a root and a knee joint, 3 frames half a second apart
+ANIMATED_BVH = b"""HIERARCHY
+ROOT hips
+{
+  OFFSET 0 0 0
+  CHANNELS 6 Xposition Yposition Zposition Zrotation Xrotation Yrotation
+  JOINT knee
+  {
+    OFFSET 0 -1 0
+    CHANNELS 3 Zrotation Xrotation Yrotation
+    End Site
+    {
+      OFFSET 0 -1 0
+    }
+  }
+}
+MOTION
+Frames: 3
+Frame Time: 0.5
+0 0 0 0 0 0 0 0 0
+1 2 3 0 0 0 0 0 45
+2 4 6 0 0 0 0 0 90
+"""
+
+
+def morph_gltf():
+    """glTF triangle with one morph target whose weight is animated over 2 seconds."""
+    buf = struct.pack("9f", 0, 0, 0, 1, 0, 0, 0, 1, 0) + struct.pack("9f", 0, 0, 1, 0, 0, 1, 0, 0, 1)
+    buf += struct.pack("3f", 0, 1, 2) + struct.pack("3f", 0, 1, 0.25)
+    gltf = {
+        "asset": {"version": "2.0"},
+        "scenes": [{"nodes": [0]}],
+        "nodes": [{"mesh": 0, "name": "blob"}],
+        "meshes": [{"name": "blob", "primitives": [{"attributes": {"POSITION": 0}, "targets": [{"POSITION": 1}]}], "weights": [0]}],
+        "animations": [{"name": "breathe", "samplers": [{"input": 2, "output": 3}],
+                        "channels": [{"sampler": 0, "target": {"node": 0, "path": "weights"}}]}],
+        "buffers": [{"byteLength": len(buf), "uri": "data:application/octet-stream;base64," + base64.b64encode(buf).decode()}],
+        "bufferViews": [{"buffer": 0, "byteOffset": offset, "byteLength": size}
+                        for offset, size in ((0, 36), (36, 36), (72, 12), (84, 12))],
+        "accessors": [
+            {"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3", "min": [0, 0, 0], "max": [1, 1, 0]},
+            {"bufferView": 1, "componentType": 5126, "count": 3, "type": "VEC3", "min": [0, 0, 1], "max": [0, 0, 1]},
+            {"bufferView": 2, "componentType": 5126, "count": 3, "type": "SCALAR", "min": [0], "max": [2]},
+            {"bufferView": 3, "componentType": 5126, "count": 3, "type": "SCALAR"},
+        ],
+    }
+    return json.dumps(gltf).encode()
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestAnimations:
+    @pytest.fixture(scope="class")
+    def animation(self):
+        scene = assimp_py.import_bytes(ANIMATED_BVH, 0, "bvh")
+        assert scene.num_animations == len(scene.animations) == 1
+        return scene.animations[0]
+
+    def test_node_channels(self, animation):
+        """Channel keys are packed float64 times and float32 values."""
+        assert (animation.duration, animation.ticks_per_second) == (2.0, 2.0)
+        hips, knee = animation.channels
+        assert (hips.node_name, knee.node_name) == ("hips", "knee")
+        assert hips.position_times.format == "d" and hips.positions.format == "f"
+        assert np.asarray(hips.position_times).tolist() == [0.0, 1.0, 2.0]
+        assert np.asarray(hips.positions).tolist() == [[0, 0, 0], [1, 2, 3], [2, 4, 6]]
+        rotations = np.asarray(knee.rotations)
+        assert rotations.shape == (3, 4)
+        np.testing.assert_allclose(rotations[2], [math.sqrt(0.5), 0, math.sqrt(0.5), 0], atol=1e-6)  # w, x, y, z
+
+    def test_resample(self, animation):
+        """Resampling bakes all nodes into a (frames, nodes, 10) array."""
+        baked = np.asarray(animation.resample(4))
+        assert baked.shape == (5, 2, 10) and baked.dtype == np.float32
+        np.testing.assert_allclose(baked[:, 0, :3], np.outer([0, 0.5, 1, 1.5, 2], [1, 2, 3]))
+        np.testing.assert_allclose(baked[1, 1, 3:7], [math.cos(math.pi / 16), 0, math.sin(math.pi / 16), 0], atol=1e-6)
+        np.testing.assert_allclose(baked[:, :, 7:], 1.0)
+
+    def test_resample_node_order(self, animation):
+        """Requested nodes are reordered, unknown ones get the identity transform."""
+        baked = np.asarray(animation.resample(2, nodes=["knee", "missing", "hips"]))
+        assert baked.shape == (3, 3, 10)
+        np.testing.assert_array_equal(baked[:, 1], [[0, 0, 0, 1, 0, 0, 0, 1, 1, 1]] * 3)
+        np.testing.assert_array_equal(baked[:, 2, :3], [[0, 0, 0], [1, 2, 3], [2, 4, 6]])
+        with pytest.raises(ValueError):
+            animation.resample(0)
+
+    def test_morph_channels(self):
+        """Morph weight keys are packed per key, also on lazy imports."""
+        scene = assimp_py.import_bytes(morph_gltf(), 0, "gltf", lazy=True)
+        animation = scene.animations[0]
+        assert animation.name == "breathe" and animation.channels == ()
+        (morph,) = animation.morph_channels
+        assert np.asarray(morph.times).tolist() == [0.0, 1000.0, 2000.0]
+        assert np.asarray(morph.targets).tolist() == [[0], [0], [0]]
+        assert np.asarray(morph.weights).tolist() == [[0.0], [1.0], [0.25]]
+
+    def test_no_animations(self, loaded_scene):
+        """Static files have no animations."""
+        assert loaded_scene.animations == [] and loaded_scene.num_animations == 0
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestNodeTable:
+    @staticmethod
+    def preorder(node, parent=-1, out=None):
+        """(node, parent index) pairs of the Node tree in depth first pre-order."""
+        out = [] if out is None else out
+        out.append((node, parent))
+        index = len(out) - 1
+        for child in node.children:
+            TestNodeTable.preorder(child, index, out)
+        return out
+
+    @pytest.mark.parametrize("data, hint", [(ANIMATED_BVH, "bvh"), (None, "obj")])
+    def test_matches_node_tree(self, data, hint, valid_obj_file):
+        """The flat arrays hold the same hierarchy as the Node objects."""
+        if data is None:
+            data = valid_obj_file.read_bytes()
+        tree = self.preorder(assimp_py.import_bytes(data, DEFAULT_FLAGS, hint).root_node)
+        scene = assimp_py.import_bytes(data, DEFAULT_FLAGS, hint, node_table=True)
+        table = scene.node_table
+        assert scene.root_node is None
+
+        assert np.asarray(table["parent_index"]).tolist() == [parent for _, parent in tree]
+        offsets = np.asarray(table["name_offsets"])
+        names = bytes(table["names"])
+        assert [names[a:b].decode() for a, b in zip(offsets[:-1], offsets[1:])] == [n.name for n, _ in tree]
+        mesh_offsets = np.asarray(table["mesh_offsets"])
+        mesh_indices = np.asarray(table["mesh_indices"]).tolist()
+        assert [mesh_indices[a:b] for a, b in zip(mesh_offsets[:-1], mesh_offsets[1:])] == [list(n.mesh_indices) for n, _ in tree]
+
+        local = np.asarray(table["transforms"])
+        world = np.asarray(table["world_transforms"])
+        assert local.shape == world.shape == (len(tree), 4, 4)
+        for i, (node, parent) in enumerate(tree):
+            np.testing.assert_allclose(local[i], node.transformation, rtol=1e-6)
+            expected = local[i] if parent < 0 else world[parent] @ local[i]
+            np.testing.assert_allclose(world[i], expected, rtol=1e-6)
+
+    def test_world_transforms(self):
+        """World transforms accumulate the offsets down the BVH chain."""
+        table = assimp_py.import_bytes(ANIMATED_BVH, 0, "bvh", node_table=True).node_table
+        assert np.asarray(table["world_transforms"])[:, 1, 3].tolist() == [0.0, -1.0, -2.0]
+        assert assimp_py.import_bytes(ANIMATED_BVH, 0, "bvh").node_table is None
+
+
+class TestProgress:
+    @staticmethod
+    def big_obj(num_quads=20000):
+        """OBJ large enough for the parser to report progress many times."""
+        lines = []
+        for i in range(num_quads):
+            lines.append(f"v {i} 0 0\nv {i} 1 0\nv {i + 1} 1 0\nv {i + 1} 0 0")
+        lines += [f"f {4 * i + 1} {4 * i + 2} {4 * i + 3} {4 * i + 4}" for i in range(num_quads)]
+        return "\n".join(lines).encode()
+
+    def test_progress_reported(self, valid_obj_file):
+        """The callback gets fractions from 0 to 1 and the import succeeds."""
+        reported = []
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, progress=reported.append)
+        assert scene.num_meshes == 1
+        assert reported and all(0.0 <= p <= 1.0 for p in reported)
+        assert reported == sorted(reported)
+
+    def test_callback_cancels(self, valid_obj_file):
+        """Returning False cancels, exceptions propagate."""
+        with pytest.raises(assimp_py.ImportCancelled):
+            assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, progress=lambda p: False)
+        with pytest.raises(KeyError):
+            assimp_py.import_bytes(valid_obj_file.read_bytes(), DEFAULT_FLAGS, "obj", progress={}.__getitem__)
+
+        def progress(p):
+            raise ZeroDivisionError(p)
+
+        with pytest.raises(ZeroDivisionError) as excinfo:
+            assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, progress=progress)
+        assert excinfo.traceback[-1].name == "progress"
+
+    def test_cancel_token(self, valid_obj_file):
+        """A cancelled token stops every import it is passed to."""
+        token = assimp_py.CancelToken()
+        assert not token.cancelled
+        token.cancel()
+        assert token.cancelled
+        assert issubclass(assimp_py.ImportCancelled, RuntimeError)
+        with pytest.raises(assimp_py.ImportCancelled):
+            assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, cancel=token)
+        with pytest.raises(assimp_py.ImportCancelled):
+            assimp_py.import_bytes(valid_obj_file.read_bytes(), DEFAULT_FLAGS, "obj", cancel=token)
+        results = list(assimp_py.import_files([str(valid_obj_file)] * 3, DEFAULT_FLAGS, cancel=token))
+        assert len(results) == 3
+        assert all(isinstance(r, assimp_py.ImportCancelled) for _, r in results)
+
+    def test_cancel_from_other_thread(self):
+        """Cancelling while an import runs stops it at the next checkpoint."""
+        token = assimp_py.CancelToken()
+        started = threading.Event()
+        resumed = threading.Event()
+        reported = []
+
+        def progress(p):
+            reported.append(p)
+            if not started.is_set():
+                started.set()
+                resumed.wait()  # Until the token is cancelled
+
+        def cancel():
+            started.wait()
+            token.cancel()
+            resumed.set()
+
+        canceller = threading.Thread(target=cancel)
+        canceller.start()
+        with pytest.raises(assimp_py.ImportCancelled):
+            assimp_py.import_bytes(self.big_obj(), DEFAULT_FLAGS, "obj", progress=progress, cancel=token)
+        canceller.join()
+        assert len(reported) == 1
+
+    def test_invalid_arguments(self, valid_obj_file):
+        with pytest.raises(TypeError):
+            assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, progress=42)
+        with pytest.raises(TypeError):
+            assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, cancel=object())
+        with pytest.raises(TypeError):
+            assimp_py.import_files([str(valid_obj_file)], DEFAULT_FLAGS, cancel=True)
+        with pytest.raises(TypeError):
+            assimp_py.CancelToken(1)
+
+
+class TestImportStats:
+    def test_stats(self, valid_obj_file):
+        """Every stage is timed and the scene memory is reported."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, stats=True)
+        stats = scene.import_stats
+        for key in ("detect", "read", "preprocess", "import", "convert"):
+            assert stats[key] >= 0.0
+        assert list(stats["postprocess"]) == ["Triangulate", "CalcTangentSpace", "GenSmoothNormals", "JoinIdenticalVertices"]
+        assert stats["import"] >= stats["read"] + sum(stats["postprocess"].values())
+        mesh = scene.meshes[0]
+        assert stats["convert_allocated"] == sum(getattr(mesh, name).nbytes for name in
+                                                 ("indices", "vertices", "normals", "tangents", "bitangents")) + \
+            sum(uv.nbytes for uv in mesh.texcoords)
+        memory = stats["memory"]
+        assert memory["meshes"] > 0 and memory["materials"] > 0
+        assert memory["total"] >= memory["meshes"] + memory["materials"] + memory["nodes"]
+
+    def test_concurrent_conversions(self, valid_obj_file):
+        """Conversions on other threads do not count towards convert_allocated."""
+        expected = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, stats=True).import_stats["convert_allocated"]
+        results = []
+
+        def work():
+            for _ in range(5):
+                scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, stats=True)
+                results.append(scene.import_stats["convert_allocated"])
+
+        threads = [threading.Thread(target=work) for _ in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        assert results == [expected] * 20
+
+    def test_all_import_functions(self, valid_obj_file):
+        """import_bytes and import_files report stats too, and only when asked."""
+        data = valid_obj_file.read_bytes()
+        assert assimp_py.import_bytes(data, 0, "obj", polygons=True, stats=True).import_stats["postprocess"] == {}
+        (_, scene), = assimp_py.import_files([str(valid_obj_file)], DEFAULT_FLAGS, stats=True)
+        assert "Triangulate" in scene.import_stats["postprocess"]
+        assert assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS).import_stats is None
+
+
+class TestExport:
+    def test_export_to_memory(self, valid_obj_file):
+        """In-memory exports are views of Assimp's output that import back."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, retain_scene=True)
+        glb = assimp_py.export(scene, None, "glb2")
+        assert isinstance(glb, memoryview) and glb.readonly
+        assert bytes(glb[:4]) == b"glTF"
+        back = assimp_py.import_bytes(glb, DEFAULT_FLAGS, "glb")
+        assert back.num_meshes == 1
+        assert back.meshes[0].num_faces == scene.meshes[0].num_faces
+
+        stl = assimp_py.export(scene, None, "stlb")
+        assert len(stl) == 84 + 50 * scene.meshes[0].num_faces
+
+    def test_export_to_file(self, valid_obj_file, tmp_path):
+        """Paths get every file of the format, file objects get the one file."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, lazy=True)
+        assert assimp_py.export(scene, tmp_path / "cube.gltf", "gltf2") is None
+        assert (tmp_path / "cube.bin").exists()
+        assert assimp_py.import_file(str(tmp_path / "cube.gltf"), DEFAULT_FLAGS).num_meshes == 1
+
+        with open(tmp_path / "cube.ply", "wb") as f:
+            assert assimp_py.export(scene, f, "plyb") is None
+        assert (tmp_path / "cube.ply").read_bytes().startswith(b"ply")
+
+    def test_errors(self, valid_obj_file):
+        """Scenes must be retained, formats known and single-file in memory."""
+        with pytest.raises(ValueError, match="retain_scene"):
+            assimp_py.export(assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS), None, "glb2")
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, retain_scene=True)
+        with pytest.raises(ValueError, match="Unknown export format"):
+            assimp_py.export(scene, None, "nope")
+        with pytest.raises(ValueError, match="several files"):
+            assimp_py.export(scene, None, "gltf2")
+
+    def test_glb_round_trip(self, valid_obj_file, tmp_path):
+        """GLB BIN chunks read in place, from mapped files and from memory, match the scene."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, retain_scene=True)
+        assimp_py.export(scene, tmp_path / "cube.glb", "glb2")
+        from_file = assimp_py.import_file(str(tmp_path / "cube.glb"), DEFAULT_FLAGS)
+        from_bytes = assimp_py.import_bytes((tmp_path / "cube.glb").read_bytes(), DEFAULT_FLAGS, "glb")
+        for back in (from_file, from_bytes):
+            assert bytes(back.meshes[0].vertices) == bytes(scene.meshes[0].vertices)
+            assert bytes(back.meshes[0].indices) == bytes(scene.meshes[0].indices)
+            assert bytes(back.meshes[0].normals) == bytes(scene.meshes[0].normals)
+
+    def test_export_formats(self):
+        ids = [format_id for format_id, _, _ in assimp_py.export_formats()]
+        for format_id in ("gltf2", "glb2", "obj", "objnomtl", "ply", "plyb", "stl", "stlb"):
+            assert format_id in ids
+
+
+class TestImportCache:
+    @pytest.fixture
+    def model(self, valid_obj_file, tmp_path):
+        """A copy of the OBJ and its MTL that tests may change."""
+        for path in (valid_obj_file, valid_obj_file.with_name("cube.mtl")):
+            (tmp_path / path.name).write_bytes(path.read_bytes())
+        return tmp_path / valid_obj_file.name
+
+    def test_hit(self, model, tmp_path):
+        """The second import reads the stored scene, identical to the first."""
+        cache = assimp_py.ImportCache(tmp_path / "cache")
+        first = assimp_py.import_file(str(model), DEFAULT_FLAGS, cache=cache)
+        assert cache.stats["misses"] == 1 and cache.stats["stores"] == 1
+        second = assimp_py.import_file(str(model), DEFAULT_FLAGS, cache=cache)
+        assert cache.stats["hits"] == 1 and cache.stats["entries"] == 1
+        assert [m.name for m in second.meshes] == [m.name for m in first.meshes]
+        assert bytes(second.meshes[0].vertices) == bytes(first.meshes[0].vertices)
+        assert bytes(second.meshes[0].indices) == bytes(first.meshes[0].indices)
+        assert second.materials[second.meshes[0].material_index]["NAME"] == "TestMaterial"
+
+        # Entries outlive the cache object, temporary files of crashed writers do not
+        entry = next((tmp_path / "cache").iterdir())
+        stale = entry.with_name(entry.name + ".1234abcd.tmp")
+        stale.write_bytes(b"partial")
+        reopened = assimp_py.ImportCache(tmp_path / "cache")
+        assert reopened.stats["entries"] == 1 and not stale.exists()
+        assimp_py.import_file(str(model), DEFAULT_FLAGS, cache=reopened)
+        assert reopened.stats["hits"] == 1
+
+    def test_key(self, model, tmp_path):
+        """Other flags, model contents or referenced files miss."""
+        cache = assimp_py.ImportCache(tmp_path / "cache")
+        assimp_py.import_file(str(model), DEFAULT_FLAGS, cache=cache)
+        assimp_py.import_file(str(model), assimp_py.Process_Triangulate, cache=cache)
+        assert cache.stats["misses"] == 2
+
+        mtl = model.with_name("cube.mtl")
+        mtl.write_text(mtl.read_text().replace("Ns 32", "Ns 64"))
+        scene = assimp_py.import_file(str(model), DEFAULT_FLAGS, cache=cache)
+        assert cache.stats["misses"] == 3
+        assert scene.materials[scene.meshes[0].material_index]["SHININESS"] == pytest.approx(64.0)
+
+        model.write_text(model.read_text() + "\n# comment\n")
+        assimp_py.import_file(str(model), DEFAULT_FLAGS, cache=cache)
+        assert cache.stats["misses"] == 4 and cache.stats["hits"] == 0
+
+    def test_eviction(self, model, tmp_path):
+        """Least recently used entries are evicted beyond max_bytes."""
+        cache = assimp_py.ImportCache(tmp_path / "cache")
+        assimp_py.import_file(str(model), DEFAULT_FLAGS, cache=cache)
+        entry = cache.stats["bytes"]
+        small = assimp_py.ImportCache(tmp_path / "small", max_bytes=entry * 2 + entry // 2)
+        flags = [DEFAULT_FLAGS, assimp_py.Process_Triangulate, assimp_py.Process_Triangulate | assimp_py.Process_FlipUVs]
+        assimp_py.import_file(str(model), flags[0], cache=small)
+        assimp_py.import_file(str(model), flags[1], cache=small)
+        assimp_py.import_file(str(model), flags[0], cache=small)  # Now the most recent
+        assimp_py.import_file(str(model), flags[2], cache=small)  # Evicts flags[1]
+        assert small.stats["evictions"] == 1 and small.stats["entries"] == 2
+        assert small.stats["bytes"] <= small.stats["max_bytes"]
+        assimp_py.import_file(str(model), flags[0], cache=small)
+        assert small.stats["hits"] == 2
+
+        small.clear()
+        assert small.stats["entries"] == 0 and not list((tmp_path / "small").iterdir())
+
+    def test_errors(self, tmp_path):
+        cache = assimp_py.ImportCache(tmp_path / "cache")
+        with pytest.raises(FileNotFoundError):
+            assimp_py.import_file(str(tmp_path / "missing.obj"), DEFAULT_FLAGS, cache=cache)
+        with pytest.raises(TypeError):
+            assimp_py.import_file(str(tmp_path / "missing.obj"), DEFAULT_FLAGS, cache=str(tmp_path))
+        (tmp_path / "file").write_text("")
+        with pytest.raises(OSError):
+            assimp_py.ImportCache(tmp_path / "file")
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping memoryview tests")
+class TestSnapshot:
+    @pytest.mark.parametrize("options", [{}, {"zero_copy": True, "compact_indices": True}, {"node_table": True}])
+    def test_round_trip(self, valid_obj_file, tmp_path, options):
+        """Loaded scenes match the saved ones, their arrays 64-byte aligned views of the file."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, **options)
+        assimp_py.save_snapshot(scene, tmp_path / "cube.snap")
+        loaded = assimp_py.load_snapshot(tmp_path / "cube.snap")
+
+        mesh, saved = loaded.meshes[0], scene.meshes[0]
+        assert mesh.name == saved.name and mesh.num_faces == saved.num_faces
+        for attr in ("vertices", "indices", "normals"):
+            view = getattr(mesh, attr)
+            assert view.readonly and view.format == getattr(saved, attr).format
+            assert np.array_equal(np.asarray(view), np.asarray(getattr(saved, attr)))
+            assert np.asarray(view).ctypes.data % 64 == 0
+        assert np.array_equal(np.asarray(mesh.texcoords[0]), np.asarray(saved.texcoords[0]))
+        assert loaded.materials == scene.materials
+        if options.get("node_table"):
+            assert loaded.root_node is None
+            assert bytes(loaded.node_table["names"]) == bytes(scene.node_table["names"])
+        else:
+            assert loaded.root_node.name == scene.root_node.name
+            child = loaded.root_node.children[0]
+            assert child.parent_name == scene.root_node.name
+            assert child.mesh_indices == scene.root_node.children[0].mesh_indices
+
+        # Views keep the mapping alive
+        vertices = mesh.vertices
+        del loaded, mesh
+        assert np.asarray(vertices).tolist() == np.asarray(saved.vertices).tolist()
+
+    def test_save_over_loaded(self, valid_obj_file, tmp_path):
+        """Saving over a loaded snapshot leaves the views of the old file intact."""
+        path = tmp_path / "cube.snap"
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS)
+        assimp_py.save_snapshot(scene, path)
+        loaded = assimp_py.load_snapshot(path)
+        vertices = loaded.meshes[0].vertices
+        expected = np.asarray(scene.meshes[0].vertices).tolist()
+
+        assimp_py.save_snapshot(loaded, path)
+        assert np.asarray(vertices).tolist() == expected
+        assimp_py.save_snapshot(assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, node_table=True), path)
+        assert np.asarray(vertices).tolist() == expected
+        assert assimp_py.load_snapshot(path).root_node is None
+        assert [f.name for f in tmp_path.iterdir()] == ["cube.snap"]
+
+    def test_errors(self, valid_obj_file, tmp_path):
+        with pytest.raises(ValueError, match="animations"):
+            assimp_py.save_snapshot(assimp_py.import_bytes(morph_gltf(), 0, "gltf"), tmp_path / "anim.snap")
+        with pytest.raises(ValueError, match="typed_materials"):
+            scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, typed_materials=True)
+            assimp_py.save_snapshot(scene, tmp_path / "typed.snap")
+        with pytest.raises(ValueError, match="Not a snapshot"):
+            assimp_py.load_snapshot(valid_obj_file)
+        with pytest.raises(FileNotFoundError):
+            assimp_py.load_snapshot(tmp_path / "missing.snap")
+
+        assimp_py.save_snapshot(assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS), tmp_path / "cube.snap")
+        data = (tmp_path / "cube.snap").read_bytes()
+        (tmp_path / "cube.snap").write_bytes(data[:-1])
+        with pytest.raises(ValueError, match="corrupt"):
+            assimp_py.load_snapshot(tmp_path / "cube.snap")
+        with pytest.raises(ValueError, match="without meshes"):
+            assimp_py.save_snapshot(assimp_py.Scene(), tmp_path / "empty.snap")
+
+    def test_corrupt_description(self, valid_obj_file, tmp_path):
+        """Damaged scene descriptions raise ValueError, or load as other valid values."""
+        path = tmp_path / "cube.snap"
+        assimp_py.save_snapshot(assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS), path)
+        data = path.read_bytes()
+        # Chunk 0 of the table at chunks_offset is the description
+        (chunks_offset,) = struct.unpack_from("=Q", data, 16)
+        offset, size = struct.unpack_from("=QQ", data, chunks_offset + 8)
+        for i in range(offset, offset + size, max(1, size // 200)):
+            for value in (0x00, 0xFF, data[i] ^ 0x01):
+                damaged = bytearray(data)
+                damaged[i] = value
+                path.write_bytes(damaged)
+                try:
+                    assimp_py.load_snapshot(path)
+                except ValueError as e:
+                    assert "Corrupt snapshot" in str(e)
+
+
+QUAD_DAE = b"""<?xml version="1.0"?>
+<COLLADA xmlns="http://www.collada.org/2005/11/COLLADASchema" version="1.4.1">
+<library_geometries><geometry id="g"><mesh>
+<source id="p"><float_array id="pa" count="12">0 0 0 1 0 0 1 1 0 0 1 0</float_array><technique_common><accessor source="#pa" count="4" stride="3"><param name="X" type="float"/><param name="Y" type="float"/><param name="Z" type="float"/></accessor></technique_common></source>
+<vertices id="v"><input semantic="POSITION" source="#p"/></vertices>
+<triangles count="2"><input semantic="VERTEX" source="#v" offset="0"/><p>0 1 2 0 2 3</p></triangles>
+</mesh></geometry></library_geometries>
+<library_visual_scenes><visual_scene id="s"><node id="n"><instance_geometry url="#g"/></node></visual_scene></library_visual_scenes>
+<scene><instance_visual_scene url="#s"/></scene>
+</COLLADA>
+"""
+
+
+def binary_fbx():
+    """A binary FBX 7.4 file of one model with a quad mesh."""
+
+    def prop(value):
+        if isinstance(value, bytes):
+            return b"S" + struct.pack("<I", len(value)) + value
+        if isinstance(value, float):
+            return b"D" + struct.pack("<d", value)
+        if isinstance(value, list):
+            code, fmt = (b"d", "d") if isinstance(value[0], float) else (b"i", "i")
+            data = struct.pack(f"<{len(value)}{fmt}", *value)
+            return code + struct.pack("<III", len(value), 0, len(data)) + data
+        if isinstance(value, tuple):  # (id,): 64-bit object id
+            return b"L" + struct.pack("<q", value[0])
+        return b"I" + struct.pack("<i", value)
+
+    def node(offset, name, props=(), children=()):
+        body = b"".join(prop(p) for p in props)
+        head_len = 13 + len(name)
+        out, child_offset = [], offset + head_len + len(body)
+        for child in children:
+            data = child(child_offset)
+            out.append(data)
+            child_offset += len(data)
+        nested = b"".join(out) + (b"\0" * 13 if children else b"")
+        end = offset + head_len + len(body) + len(nested)
+        return struct.pack("<IIIB", end, len(props), len(body), len(name)) + name + body + nested
+
+    def n(name, props=(), children=()):
+        return lambda offset: node(offset, name, props, children)
+
+    top = [
+        n(b"FBXHeaderExtension", (), [n(b"FBXHeaderVersion", [1003]), n(b"FBXVersion", [7400])]),
+        n(b"Objects", (), [
+            n(b"Geometry", [(10001,), b"quad\0\1Geometry", b"Mesh"], [
+                n(b"Vertices", [[0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0]]),
+                n(b"PolygonVertexIndex", [[0, 1, 2, -4]]),
+            ]),
+            n(b"Model", [(10002,), b"quad\0\1Model", b"Mesh"], [n(b"Version", [232])]),
+        ]),
+        n(b"Connections", (), [
+            n(b"C", [b"OO", (10001,), (10002,)]),
+            n(b"C", [b"OO", (10002,), (0,)]),
+        ]),
+    ]
+    header = b"Kaydara FBX Binary  \0\x1a\0" + struct.pack("<I", 7400)
+    out, offset = [header], len(header)
+    for t in top:
+        data = t(offset)
+        out.append(data)
+        offset += len(data)
+    return b"".join(out) + b"\0" * 13 + b"\xfa\xbc\xab\x09\xd0\xc8\xd4\x66\xb1\x76\xfb\x83\x1c\xf7\x26\x7e" + b"\0" * 4
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping tests requiring it")
+class TestMappedFiles:
+    """import_file(mmap=True) reads files through memory mappings, import_bytes from memory."""
+
+    @pytest.mark.parametrize("fmt,ext", [("stlb", "stl"), ("plyb", "ply")])
+    def test_binary_formats(self, valid_obj_file, tmp_path, fmt, ext):
+        """Binary formats read with StreamReader, in place from the mapping."""
+        scene = assimp_py.import_file(str(valid_obj_file), DEFAULT_FLAGS, retain_scene=True)
+        path = tmp_path / f"cube.{ext}"
+        assimp_py.export(scene, str(path), fmt)
+        mapped = assimp_py.import_file(str(path), 0, mmap=True)
+        copied = assimp_py.import_bytes(path.read_bytes(), 0, ext)
+        assert bytes(mapped.meshes[0].vertices) == bytes(copied.meshes[0].vertices)
+        read = assimp_py.import_file(str(path), 0)
+        assert bytes(read.meshes[0].vertices) == bytes(mapped.meshes[0].vertices)
+        cached = assimp_py.import_file(str(path), 0, mmap=True, cache=assimp_py.ImportCache(tmp_path / "cache"))
+        assert bytes(cached.meshes[0].vertices) == bytes(mapped.meshes[0].vertices)
+        positions = lambda mesh: np.unique(np.asarray(mesh.vertices).round(5), axis=0)
+        assert np.array_equal(positions(mapped.meshes[0]), positions(scene.meshes[0]))
+
+    def test_xml(self, tmp_path):
+        """XML formats hand the mapping to the XML parser."""
+        path = tmp_path / "quad.dae"
+        path.write_bytes(QUAD_DAE)
+        mapped = assimp_py.import_file(str(path), 0, mmap=True)
+        copied = assimp_py.import_bytes(QUAD_DAE, 0, "dae")
+        assert mapped.meshes[0].num_faces == 2
+        assert bytes(mapped.meshes[0].vertices) == bytes(copied.meshes[0].vertices)
+
+    def test_binary_fbx(self, tmp_path):
+        """Binary FBX is tokenized in place, bounded by the file size."""
+        data = binary_fbx()
+        path = tmp_path / "quad.fbx"
+        path.write_bytes(data)
+        mapped = assimp_py.import_file(str(path), assimp_py.Process_Triangulate, mmap=True)
+        copied = assimp_py.import_bytes(data, assimp_py.Process_Triangulate, "fbx")
+        assert mapped.meshes[0].vertices.tolist() == [[0, 0, 0], [1, 0, 0], [1, 1, 0], [0, 1, 0]]
+        assert bytes(mapped.meshes[0].vertices) == bytes(copied.meshes[0].vertices)
+        assert bytes(mapped.meshes[0].indices) == bytes(copied.meshes[0].indices)
+
+        # Truncated files fail instead of reading past the end of the mapping
+        for size in (len(data) // 2, len(data) - 40):
+            path.write_bytes(data[:size])
+            with pytest.raises(RuntimeError):
+                assimp_py.import_file(str(path), 0, mmap=True)
+            with pytest.raises(RuntimeError):
+                assimp_py.import_bytes(data[:size], 0, "fbx")
+
+    @pytest.mark.parametrize("ext", ["obj", "stl", "ply", "dae", "fbx"])
+    def test_empty_file(self, tmp_path, ext):
+        """Empty files cannot be mapped and fall back to stdio."""
+        path = tmp_path / f"empty.{ext}"
+        path.write_bytes(b"")
+        with pytest.raises(RuntimeError):
+            assimp_py.import_file(str(path), 0, mmap=True)
+
+    @pytest.mark.skipif(not os.path.exists("/dev/null"), reason="needs /dev/null")
+    def test_not_a_regular_file(self):
+        """Devices are not mapped either."""
+        with pytest.raises(RuntimeError):
+            assimp_py.import_file("/dev/null", 0, mmap=True)
+
+
+MESH_STEP_FLAGS = (assimp_py.Process_Triangulate | assimp_py.Process_GenSmoothNormals |
+                   assimp_py.Process_JoinIdenticalVertices | assimp_py.Process_CalcTangentSpace |
+                   assimp_py.Process_ImproveCacheLocality)
+
+
+def strips_obj(num_strips):
+    """An OBJ of `num_strips` objects, folded quad strips of 8 vertices with UVs."""
+    lines = []
+    for m in range(num_strips):
+        lines += [f"o strip{m}"] + [f"v {x % 4} {x // 4} {(x * m) % 3 * 0.1}\nvt {x % 4 / 3} {x // 4}" for x in range(8)]
+        lines += [f"f {' '.join(f'{8 * m + i}/{8 * m + i}' for i in (x + 1, x + 2, x + 6, x + 5))}" for x in range(3)]
+    return "\n".join(lines) + "\n"
+
+
+def primitives_gltf(num_primitives):
+    """glTF mesh of `num_primitives` triangles, every other one indexed, each with its own accessors."""
+    buf, views, accessors, primitives = b"", [], [], []
+    for p in range(num_primitives):
+        for data, kind in ((struct.pack("9f", p, 0, 0, p + 1, 0, 0, p, 1, 0), "VEC3"), (struct.pack("3I", 0, 1, 2), "SCALAR")):
+            views.append({"buffer": 0, "byteOffset": len(buf), "byteLength": len(data)})
+            accessors.append({"bufferView": len(views) - 1, "componentType": 5126 if kind == "VEC3" else 5125,
+                              "count": 3, "type": kind})
+            buf += data
+        accessors[-2].update({"min": [p, 0, 0], "max": [p + 1, 1, 0]})
+        primitives.append({"attributes": {"POSITION": len(accessors) - 2}, **({"indices": len(accessors) - 1} if p % 2 else {})})
+    gltf = {
+        "asset": {"version": "2.0"},
+        "scenes": [{"nodes": [0]}],
+        "nodes": [{"mesh": 0}],
+        "meshes": [{"name": "strip", "primitives": primitives}],
+        "buffers": [{"byteLength": len(buf), "uri": "data:application/octet-stream;base64," + base64.b64encode(buf).decode()}],
+        "bufferViews": views,
+        "accessors": accessors,
+    }
+    return json.dumps(gltf).encode()
+
+
+@pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping tests requiring it")
+class TestThreads:
+    def test_same_scene(self, tmp_path):
+        """Primitives built on several threads keep their order and contents."""
+        path = tmp_path / "strip.gltf"
+        path.write_bytes(primitives_gltf(64))
+        serial = assimp_py.import_file(str(path), DEFAULT_FLAGS)
+        for threads in (4, 0):
+            for scene in (assimp_py.import_file(str(path), DEFAULT_FLAGS, threads=threads),
+                          assimp_py.import_bytes(path.read_bytes(), DEFAULT_FLAGS, "gltf", threads=threads)):
+                assert [m.name for m in scene.meshes] == [f"strip-{p}" for p in range(64)]
+                for mesh, expected in zip(scene.meshes, serial.meshes):
+                    assert bytes(mesh.vertices) == bytes(expected.vertices)
+                    assert bytes(mesh.indices) == bytes(expected.indices)
+        assert np.asarray(serial.meshes[63].vertices)[:, 0].min() == 63
+
+    def test_invalid_threads(self, tmp_path):
+        """Negative or out of range thread counts are rejected."""
+        path = tmp_path / "strip.gltf"
+        path.write_bytes(primitives_gltf(2))
+        with pytest.raises(ValueError, match="threads"):
+            assimp_py.import_file(str(path), DEFAULT_FLAGS, threads=-1)
+        with pytest.raises(ValueError, match="threads"):
+            assimp_py.import_bytes(path.read_bytes(), DEFAULT_FLAGS, "gltf", threads=-1)
+        with pytest.raises(OverflowError):
+            assimp_py.import_file(str(path), DEFAULT_FLAGS, threads=2**32 - 1)
+
+    def test_post_processing(self, tmp_path):
+        """Per-mesh post-processing steps give the same scene on several threads."""
+        path = tmp_path / "strips.obj"
+        path.write_text(strips_obj(32))
+        serial = assimp_py.import_file(str(path), MESH_STEP_FLAGS)
+        assert len(serial.meshes) == 32 and serial.meshes[0].tangents is not None
+        for threads in (4, 0):
+            threaded = assimp_py.import_file(str(path), MESH_STEP_FLAGS, threads=threads)
+            assert len(threaded.meshes) == 32
+            for mesh, expected in zip(threaded.meshes, serial.meshes):
+                for name in ("vertices", "normals", "tangents", "bitangents", "indices"):
+                    assert bytes(getattr(mesh, name)) == bytes(getattr(expected, name))
+
+    def test_fused_steps(self, tmp_path):
+        """Fusing the per-mesh steps into one pass gives the same scene."""
+        path = tmp_path / "strips.obj"
+        path.write_text(strips_obj(32))
+        serial = assimp_py.import_file(str(path), MESH_STEP_FLAGS)
+        for threads in (1, 4):
+            fused = assimp_py.import_file(str(path), MESH_STEP_FLAGS, fuse_steps=True, threads=threads, stats=True)
+            assert len(fused.meshes) == 32
+            for mesh, expected in zip(fused.meshes, serial.meshes):
+                for name in ("vertices", "normals", "tangents", "bitangents", "indices"):
+                    assert bytes(getattr(mesh, name)) == bytes(getattr(expected, name))
+            steps = fused.import_stats["postprocess"]
+            assert "MeshPass" in steps and "JoinIdenticalVertices" not in steps
+        # A step with no mesh pass step next to it runs on its own, under its own name
+        alone = assimp_py.import_file(str(path), assimp_py.Process_Triangulate | assimp_py.Process_SortByPType,
+                                      fuse_steps=True, stats=True)
+        steps = alone.import_stats["postprocess"]
+        assert "Triangulate" in steps and "MeshPass" not in steps
+        scene = assimp_py.import_bytes(path.read_bytes(), MESH_STEP_FLAGS, "obj", fuse_steps=True)
+        assert bytes(scene.meshes[5].tangents) == bytes(serial.meshes[5].tangents)
+
+
 @pytest.mark.skipif(not NUMPY_AVAILABLE, reason="NumPy not found, skipping tests requiring it")
 class TestMaterials:
 
@@ -583,3 +1802,11 @@ class TestMaterials:
              found_bump = True
 
         assert found_bump, "Bump map 'bumpmap.png' not found in expected texture types (NORMALS or HEIGHT)"
+
+    def test_material_value_types(self, material):
+        """Values are decoded by property type, unknown keys are grouped under NONE."""
+        assert material["COLOR_DIFFUSE"] == pytest.approx([0.8, 0.7, 0.6])
+        assert material["OPACITY"] == 1.0
+        assert isinstance(material["SHADING_MODEL"], int)
+        assert "NONE" in material
+        assert all(isinstance(k, str) for k in material)
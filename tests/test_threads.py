@@ -0,0 +1,184 @@
+import os
+import time
+import threading
+import pytest
+from pathlib import Path
+from concurrent.futures import ThreadPoolExecutor
+
+try:
+    import assimp_py
+except ImportError as e:
+    pytest.fail(f"Failed to import the compiled assimp_py module: {e}", pytrace=False)
+
+
+MODELS_DIR = Path(__file__).parent.joinpath("models")
+POST_FLAGS = (
+    assimp_py.Process_Triangulate | assimp_py.Process_GenNormals | assimp_py.Process_CalcTangentSpace
+)
+
+
+@pytest.fixture(scope="module")
+def model_files():
+    """All OBJ models bundled with the tests."""
+    files = sorted(str(p.absolute()) for p in MODELS_DIR.rglob("*.obj"))
+    assert files, "No bundled models found"
+    return files
+
+
+def _summary(scene):
+    """Cheap fingerprint of a scene used to compare threaded and sequential imports."""
+    return (
+        scene.num_meshes,
+        scene.num_materials,
+        tuple(m.num_vertices for m in scene.meshes),
+        tuple(m.num_indices for m in scene.meshes),
+        tuple(bytes(m.vertices[:12]) for m in scene.meshes),
+    )
+
+
+def _grid_obj(n):
+    """An OBJ of one n x n vertex grid, two triangles per cell."""
+    lines = [f"v {x} {y} {(x * y) % 7}" for y in range(n) for x in range(n)]
+    for y in range(n - 1):
+        for x in range(n - 1):
+            a = y * n + x + 1
+            lines.append(f"f {a} {a + 1} {a + n}")
+            lines.append(f"f {a + 1} {a + n + 1} {a + n}")
+    return "\n".join(lines) + "\n"
+
+
+def _timed_imports(files, num_threads):
+    start = time.perf_counter()
+    with ThreadPoolExecutor(max_workers=num_threads) as pool:
+        list(pool.map(lambda f: assimp_py.import_file(f, POST_FLAGS), files))
+    return time.perf_counter() - start
+
+
+class TestThreadedImport:
+    def test_concurrent_imports_match_sequential(self, model_files):
+        """Imports running on many threads at once produce the same data as sequential ones."""
+        expected = {f: _summary(assimp_py.import_file(f, POST_FLAGS)) for f in model_files}
+
+        jobs = model_files * 4
+        with ThreadPoolExecutor(max_workers=8) as pool:
+            results = list(pool.map(lambda f: (f, _summary(assimp_py.import_file(f, POST_FLAGS))), jobs))
+
+        assert len(results) == len(jobs)
+        for f, summary in results:
+            assert summary == expected[f]
+
+    def test_concurrent_errors_are_per_thread(self, model_files, tmp_path):
+        """Failing imports on other threads do not clobber each other's error messages."""
+        bad = [tmp_path / f"broken{i}.obj.txt" for i in range(16)]
+        for path in bad:
+            path.write_text("This is not a valid 3D model.")
+
+        def run(i):
+            if i % 2:
+                with pytest.raises(RuntimeError) as excinfo:
+                    assimp_py.import_file(str(bad[i]), POST_FLAGS)
+                return str(excinfo.value)
+            return _summary(assimp_py.import_file(model_files[0], POST_FLAGS))
+
+        with ThreadPoolExecutor(max_workers=8) as pool:
+            results = list(pool.map(run, range(16)))
+
+        for i, res in enumerate(results):
+            if i % 2:
+                # The binding names the file itself, Assimp's own message must too
+                prefix = f"Assimp error loading '{bad[i]}': "
+                assert res.startswith(prefix)
+                assert f'"{bad[i]}"' in res[len(prefix):]
+            else:
+                assert res[0] >= 1
+
+    def test_import_releases_gil(self, tmp_path):
+        """Other Python threads keep running during a single long import."""
+        path = tmp_path / "grid.obj"
+        path.write_text(_grid_obj(300))
+        stamps = []
+        done = threading.Event()
+
+        def ticker():
+            while not done.is_set():
+                stamps.append(time.perf_counter())
+                time.sleep(0)
+
+        t = threading.Thread(target=ticker)
+        t.start()
+        try:
+            start = time.perf_counter()
+            assimp_py.import_file(str(path), POST_FLAGS)
+            end = time.perf_counter()
+        finally:
+            done.set()
+            t.join()
+
+        # Holding the GIL, the ticker could only run right before or after the
+        # call, so count only its ticks in the middle half of it
+        quarter = (end - start) / 4
+        assert any(start + quarter < s < end - quarter for s in stamps)
+
+    @pytest.mark.skipif((os.cpu_count() or 1) < 4, reason="Needs at least 4 cores to measure scaling")
+    def test_threaded_scaling(self, model_files):
+        """Importing from 4 threads is substantially faster than from 1."""
+        files = model_files * 8
+        _timed_imports(model_files, 1)  # warm up file cache
+
+        single = _timed_imports(files, 1)
+        multi = _timed_imports(files, 4)
+        assert single / multi > 1.5, f"Expected threaded speedup, got {single / multi:.2f}x"
+
+
+class TestImportFiles:
+    def test_results_match_import_file(self, model_files):
+        """Every file is returned once, with the same data as import_file."""
+        expected = {f: _summary(assimp_py.import_file(f, POST_FLAGS)) for f in model_files}
+
+        jobs = model_files * 3
+        results = list(assimp_py.import_files(jobs, POST_FLAGS, 4))
+
+        assert len(results) == len(jobs)
+        assert sorted(path for path, _ in results) == sorted(jobs)
+        for path, scene in results:
+            assert isinstance(scene, assimp_py.Scene)
+            assert _summary(scene) == expected[path]
+
+    def test_per_file_errors(self, model_files, tmp_path):
+        """Failures are returned as exception objects without stopping the batch."""
+        bad = tmp_path / "broken.obj.txt"
+        bad.write_text("This is not a valid 3D model.")
+        missing = str(tmp_path / "missing.obj")
+
+        results = dict(assimp_py.import_files([model_files[0], str(bad), missing], POST_FLAGS, 2))
+
+        assert isinstance(results[model_files[0]], assimp_py.Scene)
+        assert isinstance(results[str(bad)], RuntimeError)
+        assert "Assimp error" in str(results[str(bad)])
+        assert isinstance(results[missing], FileNotFoundError)
+
+    def test_accepts_pathlike(self, model_files):
+        """Paths can be any os.PathLike and are returned as passed in."""
+        paths = [Path(f) for f in model_files]
+        results = list(assimp_py.import_files(paths, POST_FLAGS, zero_copy=True))
+        assert {p for p, _ in results} == set(paths)
+        assert all(isinstance(s, assimp_py.Scene) for _, s in results)
+
+    def test_empty_and_abandoned(self, model_files):
+        """Empty batches finish at once and dropping a running iterator is safe."""
+        assert list(assimp_py.import_files([], POST_FLAGS)) == []
+
+        it = assimp_py.import_files(model_files * 8, POST_FLAGS, 2)
+        next(it)
+        del it
+
+    def test_invalid_arguments(self):
+        """Non-path items, bad flags and bad thread counts raise up front."""
+        with pytest.raises(TypeError):
+            assimp_py.import_files([123], POST_FLAGS)
+        with pytest.raises(TypeError):
+            assimp_py.import_files(["a.obj"], "not_an_int")
+        with pytest.raises(ValueError, match="num_threads"):
+            assimp_py.import_files(["a.obj"], POST_FLAGS, -1)
+        with pytest.raises(OverflowError):
+            assimp_py.import_files(["a.obj"], POST_FLAGS, 2**32 - 1)